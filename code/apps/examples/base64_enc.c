@@ -1,3 +1,7 @@
+//
+// Encodes the given string to base64, or with --bench measures the encoding and decoding throughput
+// of each instruction set on a random buffer of the given size in MB.
+//
 #define ZPL_IMPL
 #define ZPL_NANO
 #define ZPL_ENABLE_OPTS
@@ -6,13 +10,62 @@
 
 void exit_with_help(zpl_opts *opts);
 
+zpl_internal void bench(zpl_isize size) {
+    zpl_simd_level levels[] = { ZPL_SIMD_SCALAR, ZPL_SIMD_SSE2, ZPL_SIMD_AVX2, ZPL_SIMD_NEON };
+    char const *names[] = { "scalar", "sse2", "avx2", "neon" };
+    zpl_simd_level best = zpl_simd_level_get();
+    zpl_u8 *data = cast(zpl_u8 *)zpl_alloc(zpl_heap(), size);
+    zpl_u8 *dec = cast(zpl_u8 *)zpl_alloc(zpl_heap(), size);
+    zpl_u8 *enc = cast(zpl_u8 *)zpl_alloc(zpl_heap(), zpl_base64_encoded_len(size, 0));
+    zpl_random rng;
+    zpl_random_init(&rng);
+    for (zpl_isize i = 0; i < size; i++) data[i] = cast(zpl_u8)zpl_random_gen_u32(&rng);
+
+    for (zpl_isize l = 0; l < zpl_count_of(levels); l++) {
+        if (zpl_simd_level_set(levels[l]) != levels[l]) continue;
+
+        zpl_f64 time = zpl_time_rel();
+        zpl_isize n = zpl_base64_encode_to(enc, data, size, 0);
+        zpl_f64 enc_time = zpl_time_rel() - time;
+
+        time = zpl_time_rel();
+        zpl_isize m = zpl_base64_decode_to(dec, enc, n, 0);
+        zpl_f64 dec_time = zpl_time_rel() - time;
+
+        zpl_printf("%-8s encode %10.2f MB/s, decode %10.2f MB/s%s\n", names[l], (size / (1024.0*1024.0)) / enc_time,
+                   (size / (1024.0*1024.0)) / dec_time, (m == size && zpl_memcompare(dec, data, size) == 0) ? "" : " (MISMATCH)");
+    }
+
+    /* the allocating calls, fed the same data in 64KB pieces through the streaming encoder */
+    zpl_simd_level_set(best);
+    zpl_base64_stream stream;
+    zpl_base64_stream_init(&stream, 0);
+    zpl_f64 time = zpl_time_rel();
+    zpl_isize n = 0;
+    for (zpl_isize off = 0; off < size; off += 65536) {
+        n += zpl_base64_stream_encode(&stream, enc + n, data + off, zpl_min(65536, size - off));
+    }
+    n += zpl_base64_stream_finish(&stream, enc + n);
+    zpl_printf("%-8s encode %10.2f MB/s in 64KB pieces\n", "stream", (size / (1024.0*1024.0)) / (zpl_time_rel() - time));
+
+    zpl_free(zpl_heap(), enc);
+    zpl_free(zpl_heap(), dec);
+    zpl_free(zpl_heap(), data);
+}
+
 int main(int argc, char **argv) {
     zpl_opts opts={0};
 
     zpl_opts_init(&opts, zpl_heap(), argv[0]);
     zpl_opts_add(&opts, "s", "string", "input string.", ZPL_OPTS_STRING);
+    zpl_opts_add(&opts, "b", "bench", "benchmark with a buffer of the given size in MB.", ZPL_OPTS_INT);
     zpl_opts_positional_add(&opts, "string");
     zpl_b32 ok = zpl_opts_compile(&opts, argc, argv);
+    if (ok && zpl_opts_has_arg(&opts, "bench")) {
+        bench(cast(zpl_isize)zpl_opts_integer(&opts, "bench", 64) * 1024 * 1024);
+        zpl_opts_free(&opts);
+        return 0;
+    }
     if (!ok || !zpl_opts_positionals_filled(&opts))
         exit_with_help(&opts);
 
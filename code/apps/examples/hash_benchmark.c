@@ -0,0 +1,74 @@
+//
+// Measures the hashing functions over keys of growing size, from short table keys up to large buffers.
+// Optionally accepts the number of MB to hash per measurement.
+//
+#define ZPL_IMPLEMENTATION
+#define ZPL_NANO
+#define ZPL_ENABLE_HASHING
+#include <zpl.h>
+
+typedef zpl_u64 hash_proc(void const *data, zpl_isize len);
+
+zpl_internal zpl_u64 hash_crc32c(void const *data, zpl_isize len) { return zpl_crc32c(data, len); }
+zpl_internal zpl_u64 hash_hash128(void const *data, zpl_isize len) { zpl_hash128 h = zpl_hash128_seed(data, len, 0); return h.lo ^ h.hi; }
+
+int main(int argc, char **argv) {
+    zpl_isize sizes[] = { 3, 8, 16, 32, 64, 128, 1024, 64 * 1024 };
+    struct { char const *name; hash_proc *proc; } procs[] = {
+        { "hash64", zpl_hash64 }, { "hash128", hash_hash128 }, { "murmur64", zpl_murmur64 },
+        { "fnv64a", zpl_fnv64a }, { "crc32c", hash_crc32c },
+    };
+    zpl_isize total = 64, buffer = 1024 * 1024;
+    if (argc > 1) total = cast(zpl_isize)zpl_str_to_i64(argv[1], NULL, 10);
+    total *= 1024 * 1024;
+
+    zpl_u8 *data = cast(zpl_u8 *)zpl_alloc(zpl_heap(), buffer);
+    zpl_random rng;
+    zpl_random_init(&rng);
+    for (zpl_isize i = 0; i < buffer; i++) data[i] = cast(zpl_u8)zpl_random_gen_u32(&rng);
+
+    zpl_u64 sink = 0;
+    zpl_printf("%-10s", "bytes");
+    for (zpl_isize p = 0; p < zpl_count_of(procs); p++) zpl_printf("%18s", procs[p].name);
+    zpl_printf("\n");
+
+    for (zpl_isize s = 0; s < zpl_count_of(sizes); s++) {
+        zpl_isize size = sizes[s];
+        /* the keys move through the buffer, so they are not all served from the same cache lines */
+        zpl_isize count = zpl_max(total / size, 1), span = buffer - size;
+        zpl_printf("%-10td", size);
+
+        for (zpl_isize p = 0; p < zpl_count_of(procs); p++) {
+            zpl_isize at = 0;
+            zpl_f64 time = zpl_time_rel();
+            for (zpl_isize i = 0; i < count; i++) {
+                sink += procs[p].proc(data + at, size);
+                at += size + 1;
+                if (at >= span) at = 0;
+            }
+            time = zpl_time_rel() - time;
+
+            if (size < 1024)
+                zpl_printf("%13.2f ns/op", time * 1e9 / count);
+            else
+                zpl_printf("%13.2f MB/s", (cast(zpl_f64)size * count / (1024.0*1024.0)) / time);
+        }
+        zpl_printf("\n");
+    }
+
+    /* the same 64KB buffers handed over in pieces of 100 bytes */
+    zpl_isize count = zpl_max(total / (64 * 1024), 1);
+    zpl_f64 time = zpl_time_rel();
+    for (zpl_isize i = 0; i < count; i++) {
+        zpl_hash_state state;
+        zpl_hash_state_init(&state, 0);
+        for (zpl_isize at = 0; at < 64 * 1024; at += 100) zpl_hash_state_update(&state, data + at, zpl_min(100, 64 * 1024 - at));
+        sink += zpl_hash_state_digest(&state);
+    }
+    time = zpl_time_rel() - time;
+    zpl_printf("%-10s%13.2f MB/s in 100 byte pieces\n", "stream", (count * 64.0 / 1024.0) / time);
+
+    zpl_printf("(checksum %llx)\n", cast(unsigned long long)sink);
+    zpl_free(zpl_heap(), data);
+    return 0;
+}
@@ -38,14 +38,14 @@ main(void) {
     userbl users;
     tbl_user_init(&users, zpl_heap_allocator());
 
-    // NOTE(ZaKlaus): Create hash key
-    zpl_u64 key = 0x29;
-
     // NOTE(ZaKlaus): Create new user
     user user1;
     user1.name  = zpl_string_make(zpl_heap_allocator(), "John Doe");
     user1.score = 2674;
 
+    // NOTE: Create hash key from the name
+    zpl_u64 key = ZPL_TABLE_HASH(user1.name, zpl_string_length(user1.name));
+
     // NOTE(ZaKlaus): Add user to the hash table
     tbl_user_set(&users, key, user1);
 
@@ -55,7 +55,7 @@ main(void) {
     user2.score = 303312;
 
     // NOTE(ZaKlaus): Add user to the hash table
-    tbl_user_set(&users, key+0xDEADBEEF, user2);
+    tbl_user_set(&users, ZPL_TABLE_HASH(user2.name, zpl_string_length(user2.name)), user2);
 
     // NOTE(ZaKlaus): Retrieve the first user
     user user3 = *tbl_user_get(&users, key);
@@ -0,0 +1,122 @@
+//
+// Generates a numeric-heavy JSON document and measures how fast zpl parses and writes it back.
+// Optionally accepts the number of generated values as the first argument.
+//
+#define ZPL_IMPLEMENTATION
+#define ZPL_NANO
+#define ZPL_ENABLE_PARSER
+#define ZPL_PARSER_DISABLE_ANALYSIS
+#include <zpl.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+    zpl_isize count = 1000000;
+    if (argc > 1) count = (zpl_isize)zpl_str_to_i64(argv[1], NULL, 10);
+
+    zpl_random rng;
+    zpl_random_init(&rng);
+
+    zpl_string doc = zpl_string_make_reserve(zpl_heap(), count * 32);
+    doc = zpl_string_appendc(doc, "[");
+    for (zpl_isize i = 0; i < count; i++) {
+        zpl_i64 whole = zpl_random_range_i64(&rng, -100000, 100000);
+        zpl_u64 frac = zpl_random_gen_u64(&rng) % 10000000000000ull;
+        zpl_i64 exp = zpl_random_range_i64(&rng, -30, 30);
+        doc = zpl_string_append_fmt(doc, "%lld.%013llue%lld%s", (long long)whole, (unsigned long long)frac, (long long)exp, (i + 1 < count) ? "," : "]");
+    }
+
+    zpl_isize size = zpl_string_length(doc);
+    zpl_printf("Generated %td numbers, document size: %td bytes\n", count, size);
+
+    /* raw conversion throughput, compared against the C runtime */
+    {
+        zpl_f64 *ours = (zpl_f64 *)zpl_alloc(zpl_heap(), count * zpl_size_of(zpl_f64));
+        zpl_f64 *libc = (zpl_f64 *)zpl_alloc(zpl_heap(), count * zpl_size_of(zpl_f64));
+        char const *p = doc + 1;
+        zpl_f64 time = zpl_time_rel();
+        for (zpl_isize i = 0; i < count; i++) {
+            char *end;
+            ours[i] = zpl_str_to_f64(p, &end);
+            p = end + 1;
+        }
+        zpl_f64 delta = zpl_time_rel() - time;
+        zpl_printf("zpl_str_to_f64: %fms (%f MB/s)\n", delta*1000, (size / (1024.0*1024.0)) / delta);
+
+        p = doc + 1;
+        time = zpl_time_rel();
+        for (zpl_isize i = 0; i < count; i++) {
+            char *end;
+            libc[i] = strtod(p, &end);
+            p = end + 1;
+        }
+        delta = zpl_time_rel() - time;
+        zpl_printf("strtod:         %fms (%f MB/s)\n", delta*1000, (size / (1024.0*1024.0)) / delta);
+
+        zpl_isize mismatches = 0;
+        for (zpl_isize i = 0; i < count; i++) {
+            if (zpl_memcompare(ours + i, libc + i, zpl_size_of(zpl_f64))) mismatches++;
+        }
+        zpl_printf("Values differing from strtod: %td\n", mismatches);
+
+        /* shortest round-trip formatting, compared against the C runtime's 17 digits */
+        char buf[64];
+        time = zpl_time_rel();
+        for (zpl_isize i = 0; i < count; i++) {
+            zpl_f64_to_str(ours[i], buf);
+        }
+        delta = zpl_time_rel() - time;
+        zpl_printf("zpl_f64_to_str: %fms\n", delta*1000);
+
+        time = zpl_time_rel();
+        for (zpl_isize i = 0; i < count; i++) {
+            snprintf(buf, sizeof(buf), "%.17g", ours[i]);
+        }
+        delta = zpl_time_rel() - time;
+        zpl_printf("snprintf:       %fms\n", delta*1000);
+
+        mismatches = 0;
+        for (zpl_isize i = 0; i < count; i++) {
+            zpl_f64 back;
+            zpl_f64_to_str(ours[i], buf);
+            back = zpl_str_to_f64(buf, NULL);
+            if (zpl_memcompare(ours + i, &back, zpl_size_of(zpl_f64))) mismatches++;
+        }
+        zpl_printf("Values not surviving a round-trip: %td\n", mismatches);
+
+        zpl_mfree(ours);
+        zpl_mfree(libc);
+    }
+
+    /* full document parse, the parser works in-place so we hand it a copy */
+    {
+        zpl_string text = zpl_string_duplicate(zpl_heap(), doc);
+        zpl_json_object root = {0};
+
+        zpl_f64 time = zpl_time_rel();
+        zpl_u8 err = zpl_json_parse(&root, text, zpl_heap());
+        zpl_f64 delta = zpl_time_rel() - time;
+        zpl_printf("zpl_json_parse: %fms (%f MB/s)\nNo. of nodes: %td\nError code: %d\n", delta*1000, (size / (1024.0*1024.0)) / delta, zpl_array_count(root.nodes), err);
+
+        time = zpl_time_rel();
+        zpl_string out = zpl_json_write_string(zpl_heap(), &root, 0);
+        delta = zpl_time_rel() - time;
+        zpl_printf("zpl_json_write_string: %fms (%td bytes)\n", delta*1000, zpl_string_length(out));
+
+        /* second pass reuses the already grown buffer */
+        zpl_string_clear(out);
+        time = zpl_time_rel();
+        zpl_json_write_append(&out, &root, 0);
+        delta = zpl_time_rel() - time;
+        zpl_printf("zpl_json_write_append (reused): %fms\n", delta*1000);
+
+        zpl_string_free(out);
+
+        zpl_json_free(&root);
+        zpl_string_free(text);
+    }
+
+    zpl_string_free(doc);
+    return 0;
+}
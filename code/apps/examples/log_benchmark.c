@@ -0,0 +1,100 @@
+//
+// Writes log lines to a file with the asynchronous logger and with a synchronous zpl_fprintf per line,
+// measuring the time spent in the logging threads and until the lines are on disk.
+// Optionally accepts the number of lines per thread and the thread count as arguments.
+//
+#define ZPL_IMPLEMENTATION
+#include <zpl.h>
+
+typedef struct {
+    zpl_logger *logger;
+    zpl_file   *file;
+    zpl_mutex  *lock;
+    zpl_isize   count;
+    zpl_f64     elapsed;
+} producer;
+
+zpl_internal zpl_isize log_async(struct zpl_thread *thread) {
+    producer *p = cast(producer *)thread->user_data;
+    zpl_f64 time = zpl_time_rel();
+    for (zpl_isize i = 0; i < p->count; i++) {
+        ZPL_LOG_INFO(p->logger, "request %u from 10.0.%d.%d took %lldus, %zu bytes, user %s", cast(zpl_u32)i * 2654435761u,
+                     cast(int)(i & 255), cast(int)((i >> 8) & 255), cast(long long)(i * 37), cast(zpl_usize)(i * 1021), "guest");
+    }
+    p->elapsed = zpl_time_rel() - time;
+    return 0;
+}
+
+zpl_internal zpl_isize log_sync(struct zpl_thread *thread) {
+    producer *p = cast(producer *)thread->user_data;
+    zpl_f64 time = zpl_time_rel();
+    for (zpl_isize i = 0; i < p->count; i++) {
+        /* a shared file needs the lines serialised, as the logger does on its own */
+        zpl_mutex_lock(p->lock);
+        zpl_fprintf(p->file, "INFO  request %u from 10.0.%d.%d took %lldus, %zu bytes, user %s\n", cast(zpl_u32)i * 2654435761u,
+                    cast(int)(i & 255), cast(int)((i >> 8) & 255), cast(long long)(i * 37), cast(zpl_usize)(i * 1021), "guest");
+        zpl_mutex_unlock(p->lock);
+    }
+    p->elapsed = zpl_time_rel() - time;
+    return 0;
+}
+
+zpl_internal void run(char const *title, zpl_thread_proc proc, producer *producers, zpl_isize threads) {
+    zpl_thread workers[16];
+    zpl_f64 busy = 0;
+    zpl_f64 time = zpl_time_rel();
+
+    for (zpl_isize i = 0; i < threads; i++) {
+        zpl_thread_init(&workers[i]);
+        zpl_thread_start(&workers[i], proc, producers + i);
+    }
+    for (zpl_isize i = 0; i < threads; i++) {
+        zpl_thread_destroy(&workers[i]);
+        busy += producers[i].elapsed;
+    }
+    if (producers[0].logger) zpl_logger_flush(producers[0].logger);
+
+    zpl_f64 delta = zpl_time_rel() - time;
+    zpl_isize lines = producers[0].count * threads;
+    zpl_printf("%-10s %10.3fms total %8.1f ns/line in the caller\n", title, delta*1000, busy*1e9 / lines);
+}
+
+int main(int argc, char **argv) {
+    zpl_isize count = 500000, threads = 2;
+    if (argc > 1) count = cast(zpl_isize)zpl_str_to_i64(argv[1], NULL, 10);
+    if (argc > 2) threads = zpl_clamp(cast(zpl_isize)zpl_str_to_i64(argv[2], NULL, 10), 1, 16);
+
+    producer producers[16] = {0};
+    zpl_mutex lock;
+    zpl_logger logger;
+    zpl_file file;
+
+    zpl_file_create(&file, "build/log_benchmark.log");
+    zpl_logger_init(&logger, zpl_heap(), &file, ZPL_LOG_LEVEL_NAME | ZPL_LOG_BLOCK);
+    for (zpl_isize i = 0; i < threads; i++) {
+        producers[i].logger = &logger;
+        producers[i].count = count;
+    }
+    run("zpl_logger", log_async, producers, threads);
+
+    zpl_log_stats stats;
+    zpl_logger_stats(&logger, &stats);
+    zpl_printf("           %lld records, %lld dropped, %lld waits for space, %lld writes\n", cast(long long)stats.records,
+               cast(long long)stats.dropped, cast(long long)stats.blocked, cast(long long)stats.writes);
+    zpl_logger_free(&logger);
+    zpl_file_close(&file);
+
+    zpl_mutex_init(&lock);
+    zpl_file_create(&file, "build/log_benchmark.log");
+    for (zpl_isize i = 0; i < threads; i++) {
+        producers[i].logger = NULL;
+        producers[i].file = &file;
+        producers[i].lock = &lock;
+    }
+    run("zpl_fprintf", log_sync, producers, threads);
+    zpl_file_close(&file);
+    zpl_mutex_destroy(&lock);
+
+    zpl_fs_remove("build/log_benchmark.log");
+    return 0;
+}
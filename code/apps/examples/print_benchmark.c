@@ -0,0 +1,67 @@
+//
+// Formats typical log lines with zpl_snprintf, with a pre-compiled zpl_fmt plan and with the C runtime.
+// Optionally accepts the number of formatted lines as the first argument.
+//
+#define ZPL_IMPLEMENTATION
+#define ZPL_NANO
+#include <zpl.h>
+
+#include <stdio.h>
+
+#define LINE_FMT "%s [%s] request %u from %d.%d.%d.%d took %lldus, %zu bytes, ratio %.3f\n"
+
+int main(int argc, char **argv) {
+    zpl_isize count = 2000000;
+    if (argc > 1) count = cast(zpl_isize)zpl_str_to_i64(argv[1], NULL, 10);
+
+    char const *levels[] = { "INFO", "DEBUG", "WARN", "ERROR" };
+    char buf[256];
+    zpl_isize total = 0;
+    zpl_f64 time, delta;
+
+    time = zpl_time_rel();
+    for (zpl_isize i = 0; i < count; i++) {
+        total += zpl_snprintf(buf, zpl_size_of(buf), LINE_FMT, "2024-05-01 12:00:00", levels[i & 3], cast(zpl_u32)i * 2654435761u,
+                              10, cast(int)(i & 255), cast(int)((i >> 8) & 255), 7, cast(long long)(i * 37), cast(zpl_usize)(i * 1021), i / 7.0);
+    }
+    delta = zpl_time_rel() - time;
+    zpl_printf("%-20s %10.3fms %8.1f ns/line (%td bytes)\n", "zpl_snprintf", delta*1000, delta*1e9 / count, total);
+
+    zpl_fmt plan;
+    zpl_fmt_compile(&plan, LINE_FMT);
+    total = 0;
+    time = zpl_time_rel();
+    for (zpl_isize i = 0; i < count; i++) {
+        total += zpl_fmt_snprintf(buf, zpl_size_of(buf), &plan, "2024-05-01 12:00:00", levels[i & 3], cast(zpl_u32)i * 2654435761u,
+                                  10, cast(int)(i & 255), cast(int)((i >> 8) & 255), 7, cast(long long)(i * 37), cast(zpl_usize)(i * 1021), i / 7.0);
+    }
+    delta = zpl_time_rel() - time;
+    zpl_printf("%-20s %10.3fms %8.1f ns/line (%td bytes)\n", "zpl_fmt_snprintf", delta*1000, delta*1e9 / count, total);
+
+    total = 0;
+    time = zpl_time_rel();
+    for (zpl_isize i = 0; i < count; i++) {
+        total += snprintf(buf, sizeof(buf), LINE_FMT, "2024-05-01 12:00:00", levels[i & 3], cast(zpl_u32)i * 2654435761u,
+                          10, cast(int)(i & 255), cast(int)((i >> 8) & 255), 7, cast(long long)(i * 37), cast(zpl_usize)(i * 1021), i / 7.0) + 1;
+    }
+    delta = zpl_time_rel() - time;
+    zpl_printf("%-20s %10.3fms %8.1f ns/line (%td bytes)\n", "snprintf", delta*1000, delta*1e9 / count, total);
+
+    /* integers only, where the digit conversion dominates */
+    total = 0;
+    time = zpl_time_rel();
+    for (zpl_isize i = 0; i < count; i++) {
+        total += zpl_snprintf(buf, zpl_size_of(buf), "%lld %lld %u", cast(long long)(i * 2654435761ll), -cast(long long)i, cast(zpl_u32)i);
+    }
+    delta = zpl_time_rel() - time;
+    zpl_printf("%-20s %10.3fms %8.1f ns/line (%td bytes)\n", "zpl_snprintf ints", delta*1000, delta*1e9 / count, total);
+
+    total = 0;
+    time = zpl_time_rel();
+    for (zpl_isize i = 0; i < count; i++) {
+        total += snprintf(buf, sizeof(buf), "%lld %lld %u", cast(long long)(i * 2654435761ll), -cast(long long)i, cast(zpl_u32)i) + 1;
+    }
+    delta = zpl_time_rel() - time;
+    zpl_printf("%-20s %10.3fms %8.1f ns/line (%td bytes)\n", "snprintf ints", delta*1000, delta*1e9 / count, total);
+    return 0;
+}
@@ -0,0 +1,98 @@
+//
+// Compares the scalar and vectorized string scans against the C runtime on small and large inputs,
+// then generates a large report with zpl_string_append_fmt and with zpl_string_builder.
+// Optionally accepts the large input size in bytes as the first argument.
+//
+#define ZPL_IMPLEMENTATION
+#define ZPL_NANO
+#include <zpl.h>
+
+#include <string.h>
+
+#define SMALL_SIZE 24
+#define SMALL_ROUNDS 2000000
+
+zpl_global volatile zpl_isize sink;
+
+#define BENCH(name, rounds, expr) do { \
+        zpl_f64 time = zpl_time_rel(); \
+        for (zpl_isize r = 0; r < (rounds); r++) sink += cast(zpl_isize)(expr); \
+        zpl_f64 delta = zpl_time_rel() - time; \
+        zpl_printf("  %-22s %10.3fms %10.2f MB/s\n", name, delta*1000, (cast(zpl_f64)(rounds) * size / (1024.0*1024.0)) / delta); \
+    } while (0)
+
+zpl_internal void run(char const *title, char *text, char *spaces, zpl_isize size, zpl_isize rounds) {
+    char const *levels[] = { "scalar", "sse2", "avx2", "neon" };
+    zpl_printf("%s (%td bytes):\n", title, size);
+
+    BENCH("libc strlen", rounds, strlen(text));
+    BENCH("libc memchr", rounds, memchr(text, '#', size));
+    BENCH("libc strchr", rounds, strchr(text, '#'));
+    BENCH("libc strspn", rounds, strspn(spaces, " \t\n\v\f\r"));
+    BENCH("libc strcspn", rounds, strcspn(text, "#,;"));
+
+    for (zpl_isize l = ZPL_SIMD_SCALAR; l <= ZPL_SIMD_NEON; l++) {
+        if (zpl_simd_level_set(cast(zpl_simd_level)l) != l) continue;
+        zpl_printf(" %s\n", levels[l]);
+        BENCH("zpl_strlen", rounds, zpl_strlen(text));
+        BENCH("zpl_memchr", rounds, zpl_memchr(text, '#', size));
+        BENCH("zpl_memrchr", rounds, zpl_memrchr(text, '#', size));
+        BENCH("zpl_str_skip", rounds, zpl_str_skip(text, '#'));
+        BENCH("zpl_str_trim", rounds, zpl_str_trim(spaces, false));
+        BENCH("zpl_str_skip_any", rounds, zpl_str_skip_any(text, "#,;"));
+    }
+    zpl_printf("\n");
+}
+
+int main(int argc, char **argv) {
+    zpl_isize large = 16 * 1024 * 1024;
+    if (argc > 1) large = cast(zpl_isize)zpl_str_to_i64(argv[1], NULL, 10);
+
+    zpl_simd_level detected = zpl_simd_level_get();
+
+    /* none of the searched bytes occur so every scan runs to the end, trimming crosses the whole whitespace run */
+    char *text = cast(char *)zpl_alloc(zpl_heap(), large + 1);
+    char *spaces = cast(char *)zpl_alloc(zpl_heap(), large + 1);
+    for (zpl_isize i = 0; i < large; i++) text[i] = 'a' + cast(char)(i % 26);
+    for (zpl_isize i = 0; i < large; i++) spaces[i] = " \t\r\n"[i % 4];
+    text[large] = spaces[large] = '\0';
+
+    char small[SMALL_SIZE + 1], small_spaces[SMALL_SIZE + 1];
+    zpl_memcopy(small, text, SMALL_SIZE + 1);
+    zpl_memcopy(small_spaces, spaces, SMALL_SIZE + 1);
+    small[SMALL_SIZE] = small_spaces[SMALL_SIZE] = '\0';
+
+    run("small input", small, small_spaces, SMALL_SIZE, SMALL_ROUNDS);
+    run("large input", text, spaces, large, zpl_max(1, (256 * 1024 * 1024) / large));
+
+    zpl_simd_level_set(detected);
+
+    /* report generation, growing a single string against accumulating chunks */
+    {
+        // NOTE: Growing a single string copies it on each resize, keep the row count modest
+        zpl_isize rows = zpl_min(large / 32, 20000);
+        zpl_printf("report (%td rows):\n", rows);
+
+        zpl_f64 time = zpl_time_rel();
+        zpl_string str = zpl_string_make(zpl_heap(), "");
+        for (zpl_isize i = 0; i < rows; i++) str = zpl_string_append_fmt(str, "INSERT INTO t VALUES (%td, %.2f);\n", i, i * 0.25);
+        zpl_f64 delta = zpl_time_rel() - time;
+        zpl_printf("  %-22s %10.3fms (%td bytes)\n", "zpl_string_append_fmt", delta*1000, zpl_string_length(str));
+
+        time = zpl_time_rel();
+        zpl_string_builder b;
+        zpl_string_builder_init(&b, zpl_heap(), 0);
+        for (zpl_isize i = 0; i < rows; i++) zpl_string_builder_append_fmt(&b, "INSERT INTO t VALUES (%td, %.2f);\n", i, i * 0.25);
+        zpl_string built = zpl_string_builder_to_string(&b, zpl_heap());
+        delta = zpl_time_rel() - time;
+        zpl_printf("  %-22s %10.3fms (%td bytes, %s)\n", "zpl_string_builder", delta*1000, zpl_string_length(built), zpl_string_are_equal(str, built) ? "identical" : "MISMATCH");
+
+        zpl_string_builder_free(&b);
+        zpl_string_free(built);
+        zpl_string_free(str);
+    }
+
+    zpl_mfree(spaces);
+    zpl_mfree(text);
+    return 0;
+}
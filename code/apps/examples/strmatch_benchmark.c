@@ -0,0 +1,98 @@
+//
+// Scans a generated log for a handful and for a few hundred keywords at once with zpl_strmatch,
+// compared against one strstr pass per keyword.
+// Optionally accepts the log size in bytes as the first argument.
+//
+#define ZPL_IMPLEMENTATION
+#define ZPL_NANO
+#define ZPL_ENABLE_REGEX
+#include <zpl.h>
+
+#include <string.h>
+
+typedef struct {
+    zpl_isize hits;
+} counter;
+
+zpl_internal zpl_b32 count_hit(zpl_strmatch_hit const *hit, void *user_data) {
+    (void)hit;
+    (cast(counter *)user_data)->hits++;
+    return true;
+}
+
+zpl_internal void run(char const *title, char const *log, zpl_isize size, zpl_strview *words, zpl_isize count) {
+    zpl_strmatch m;
+    counter c = {0};
+    zpl_isize naive = 0;
+    char word[64];
+
+    zpl_printf("%s (%td keywords):\n", title, count);
+    if (!zpl_strmatch_compile(&m, zpl_heap(), words, count, 0)) {
+        zpl_printf("  failed to compile the keywords\n");
+        return;
+    }
+
+    zpl_f64 time = zpl_time_rel();
+    /* fed in 64KB pieces, as if read from a file */
+    for (zpl_isize off = 0; off < size; off += 65536) {
+        zpl_strmatch_feed(&m, log + off, zpl_min(65536, size - off), count_hit, &c);
+    }
+    zpl_f64 delta = zpl_time_rel() - time;
+    zpl_printf("  %-16s %10.3fms %10.2f MB/s (%td matches, %td states, prefilter %s)\n", "zpl_strmatch", delta*1000,
+               (size / (1024.0*1024.0)) / delta, c.hits, m.state_count, m.prefilter_len ? "on" : "off");
+
+    time = zpl_time_rel();
+    for (zpl_isize i = 0; i < count; i++) {
+        char const *p = log;
+        zpl_memcopy(word, words[i].ptr, words[i].len);
+        word[words[i].len] = '\0';
+        while ((p = strstr(p, word)) != NULL) {
+            naive++;
+            p++;
+        }
+    }
+    delta = zpl_time_rel() - time;
+    zpl_printf("  %-16s %10.3fms %10.2f MB/s (%td matches)\n", "strstr", delta*1000, (size / (1024.0*1024.0)) / delta, naive);
+
+    zpl_strmatch_destroy(&m);
+}
+
+int main(int argc, char **argv) {
+    zpl_isize size = 32 * 1024 * 1024;
+    if (argc > 1) size = cast(zpl_isize)zpl_str_to_i64(argv[1], NULL, 10);
+
+    char const *levels[] = { "INFO", "DEBUG", "WARN", "ERROR" };
+    char const *services[] = { "auth", "billing", "gateway", "search", "storage", "mailer" };
+    zpl_random rng;
+    zpl_random_init(&rng);
+
+    zpl_string_builder b;
+    zpl_string_builder_init(&b, zpl_heap(), 0);
+    while (zpl_string_builder_length(&b) < size) {
+        zpl_string_builder_append_fmt(&b, "2024-05-%02d %s [%s] request %u took %ums from 10.0.%u.%u\n",
+                                      cast(int)zpl_random_range_i64(&rng, 1, 28),
+                                      levels[zpl_random_range_i64(&rng, 0, 3)],
+                                      services[zpl_random_range_i64(&rng, 0, 5)],
+                                      zpl_random_gen_u32(&rng), zpl_random_gen_u32(&rng) % 5000,
+                                      zpl_random_gen_u32(&rng) % 256, zpl_random_gen_u32(&rng) % 256);
+    }
+    zpl_string log = zpl_string_builder_to_string(&b, zpl_heap());
+    zpl_string_builder_free(&b);
+    size = zpl_string_length(log);
+
+    /* a few rare keywords, the prefilter skips most of the input */
+    zpl_strview few[] = { ZPL_STRVIEW_LIT("ERROR [billing]"), ZPL_STRVIEW_LIT("timeout"), ZPL_STRVIEW_LIT("10.0.255.255") };
+    run("few keywords", log, size, few, zpl_count_of(few));
+
+    /* many keywords, the automaton alone */
+    zpl_strview many[256];
+    char pool[256 * 16];
+    for (zpl_isize i = 0; i < zpl_count_of(many); i++) {
+        zpl_isize len = zpl_snprintf(pool + i * 16, 16, "took %ums", cast(zpl_u32)(i * 17)) - 1;
+        many[i] = zpl_strview_make(pool + i * 16, len);
+    }
+    run("many keywords", log, size, many, zpl_count_of(many));
+
+    zpl_string_free(log);
+    return 0;
+}
@@ -0,0 +1,98 @@
+//
+// Validates and transcodes ASCII, mixed and CJK text with every available instruction set.
+// Optionally accepts the text size in bytes as the first argument.
+//
+#define ZPL_IMPLEMENTATION
+#define ZPL_NANO
+#include <zpl.h>
+
+zpl_internal void run(char const *title, zpl_u8 const *text, zpl_isize size) {
+    zpl_simd_level levels[] = { ZPL_SIMD_SCALAR, ZPL_SIMD_SSE2, ZPL_SIMD_AVX2, ZPL_SIMD_NEON };
+    char const *names[] = { "scalar", "sse2", "avx2", "neon" };
+    zpl_simd_level prev = zpl_simd_level_get();
+    zpl_f64 mb = size / (1024.0*1024.0);
+
+    zpl_printf("%s (%td bytes):\n", title, size);
+    for (zpl_isize l = 0; l < zpl_count_of(levels); l++) {
+        if (zpl_simd_level_set(levels[l]) != levels[l]) continue;
+        zpl_f64 time = zpl_time_rel();
+        zpl_isize valid = zpl_utf8_validate(text, size);
+        zpl_f64 delta = zpl_time_rel() - time;
+        zpl_printf("  validate %-8s %10.3fms %10.2f MB/s (%s)\n", names[l], delta*1000, mb / delta, valid == size ? "valid" : "invalid");
+    }
+    zpl_simd_level_set(prev);
+
+    zpl_f64 time = zpl_time_rel();
+    zpl_isize units = zpl_utf8_utf16_length(text, size);
+    zpl_f64 delta = zpl_time_rel() - time;
+    zpl_printf("  %-17s %10.3fms %10.2f MB/s (%td units)\n", "utf16 length", delta*1000, mb / delta, units);
+
+    /* the buffers are touched once up front, so page faults don't end up in the timings */
+    zpl_u16 *wide = cast(zpl_u16 *)zpl_alloc(zpl_heap(), units * zpl_size_of(zpl_u16));
+    zpl_u8 *back = cast(zpl_u8 *)zpl_alloc(zpl_heap(), size);
+    zpl_memset(wide, 0, units * zpl_size_of(zpl_u16));
+    zpl_memset(back, 0, size);
+
+    time = zpl_time_rel();
+    zpl_utf8_to_utf16(wide, text, size);
+    delta = zpl_time_rel() - time;
+    zpl_printf("  %-17s %10.3fms %10.2f MB/s\n", "utf8 -> utf16", delta*1000, mb / delta);
+
+    time = zpl_time_rel();
+    zpl_isize written = zpl_utf16_to_utf8(back, wide, units);
+    delta = zpl_time_rel() - time;
+    zpl_printf("  %-17s %10.3fms %10.2f MB/s (%s)\n", "utf16 -> utf8", delta*1000, mb / delta,
+               (written == size && !zpl_memcompare(back, text, size)) ? "round-trips" : "differs");
+
+    /* the codepoint at a time decoder, for reference */
+    time = zpl_time_rel();
+    zpl_isize count = 0;
+    for (zpl_isize i = 0; i < size; count++) {
+        zpl_rune c;
+        i += zpl_utf8_decode(text + i, size - i, &c);
+    }
+    delta = zpl_time_rel() - time;
+    zpl_printf("  %-17s %10.3fms %10.2f MB/s (%td codepoints)\n", "zpl_utf8_decode", delta*1000, mb / delta, count);
+
+    zpl_mfree(back);
+    zpl_mfree(wide);
+}
+
+zpl_internal zpl_u8 *generate(zpl_isize size, char const *const *words, zpl_isize count) {
+    zpl_random rng;
+    zpl_u8 *text = cast(zpl_u8 *)zpl_alloc(zpl_heap(), size);
+    zpl_isize len = 0;
+    zpl_random_init(&rng);
+    for (;;) {
+        char const *w = words[zpl_random_range_i64(&rng, 0, count - 1)];
+        zpl_isize n = zpl_strlen(w);
+        if (len + n + 1 > size) break;
+        zpl_memcopy(text + len, w, n);
+        len += n;
+        text[len++] = ' ';
+    }
+    while (len < size) text[len++] = ' ';
+    return text;
+}
+
+int main(int argc, char **argv) {
+    zpl_isize size = 64 * 1024 * 1024;
+    if (argc > 1) size = cast(zpl_isize)zpl_str_to_i64(argv[1], NULL, 10);
+
+    char const *ascii[] = { "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "{\"id\": 42}" };
+    char const *mixed[] = { "p\xc5\x99\xc3\xad\xc5\xa1" "ern\xc4\x9b", "\xc5\xbe" "lu\xc5\xa5ou\xc4\x8dk\xc3\xbd", "k\xc5\xaf\xc5\x88", "\xc3\xbap\xc4\x9bl", "\xc4\x8f\xc3\xa1" "belsk\xc3\xa9", "\xc3\xb3" "dy", "text", "\xe2\x82\xac" };
+    char const *cjk[] = { "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "\xe4\xb8\xad\xe6\x96\x87", "\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4", "\xf0\x9f\x98\x80" };
+
+    zpl_u8 *text = generate(size, ascii, zpl_count_of(ascii));
+    run("ascii", text, size);
+    zpl_mfree(text);
+
+    text = generate(size, mixed, zpl_count_of(mixed));
+    run("mixed", text, size);
+    zpl_mfree(text);
+
+    text = generate(size, cjk, zpl_count_of(cjk));
+    run("cjk", text, size);
+    zpl_mfree(text);
+    return 0;
+}
@@ -2,6 +2,11 @@
 
 ZPL_BEGIN_C_DECLS
 
+/* size of the staging buffer serialisers flush to a file in one write */
+#ifndef ZPL_ADT_WRITER_BUFFER_SIZE
+#define ZPL_ADT_WRITER_BUFFER_SIZE 16384
+#endif
+
 typedef enum zpl_adt_type {
     ZPL_ADT_TYPE_UNINITIALISED, /* node was not initialised, this is a programming error! */
     ZPL_ADT_TYPE_ARRAY,
@@ -158,6 +163,16 @@ ZPL_DEF zpl_adt_node *zpl_adt_query(zpl_adt_node *node, char const *uri);
  */
 ZPL_DEF zpl_adt_node *zpl_adt_find(zpl_adt_node *node, char const *name, zpl_b32 deep_search);
 
+/**
+ * @brief Find a field node within an object by a name that doesn't have to be NUL-terminated.
+ *
+ * @param node
+ * @param name
+ * @param deep_search Perform search recursively
+ * @return zpl_adt_node * node
+ */
+ZPL_DEF zpl_adt_node *zpl_adt_find_view(zpl_adt_node *node, zpl_strview name, zpl_b32 deep_search);
+
 /**
  * @brief Allocate an unitialised node within a container at a specified index.
  *
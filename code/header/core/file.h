@@ -285,11 +285,33 @@ ZPL_DEF_INLINE zpl_b32 zpl_file_read(zpl_file *file, void *buffer, zpl_isize siz
  */
 ZPL_DEF_INLINE zpl_b32 zpl_file_write(zpl_file *file, void const *buffer, zpl_isize size);
 
+typedef struct zpl_file_iovec {
+    void const *data;
+    zpl_isize   size;
+} zpl_file_iovec;
+
+/**
+ * Writes a list of buffers at the file cursor, OS files issue a single writev per batch
+ * @param  file
+ * @param  iov   Buffers to write, in order
+ * @param  count Number of buffers
+ */
+ZPL_DEF zpl_b32 zpl_file_writev(zpl_file *file, zpl_file_iovec const *iov, zpl_isize count);
+
+
+#ifndef ZPL_FILE_BUFFER_SIZE
+#define ZPL_FILE_BUFFER_SIZE (64 * 1024) // NOTE: default for buffered files and line iteration
+#endif
+
+#ifndef ZPL_FILE_MAP_MIN_SIZE
+#define ZPL_FILE_MAP_MIN_SIZE (64 * 1024) // NOTE: smaller files are read, a mapping costs more than the copy
+#endif
 
 typedef struct zpl_file_contents {
     zpl_allocator allocator;
     void *data;
     zpl_isize size;
+    zpl_isize mapped_size; // NOTE: non-zero when data is a file mapping
 } zpl_file_contents;
 
 /**
@@ -307,6 +329,22 @@ ZPL_DEF zpl_file_contents zpl_file_read_contents(zpl_allocator a, zpl_b32 zero_t
  */
 ZPL_DEF void              zpl_file_free_contents(zpl_file_contents *fc);
 
+/**
+ * Maps the whole file contents into memory, falls back to zpl_file_read_contents when mapping is not possible
+ * @param  a              Allocator used by the fallback
+ * @param  writable       Map copy-on-write so the data can be modified in place (e.g. by the JSON/CSV parsers), the file is left untouched
+ * @param  zero_terminate End the data with null terminator
+ * @param  filepath       Path to the file
+ * @return                File contents data
+ */
+ZPL_DEF zpl_file_contents zpl_file_map_contents(zpl_allocator a, zpl_b32 writable, zpl_b32 zero_terminate, char const *filepath);
+
+/**
+ * Releases file contents previously obtained by zpl_file_map_contents
+ * @param  fc
+ */
+ZPL_DEF void              zpl_file_unmap(zpl_file_contents *fc);
+
 /**
  * Writes content to a file
  */
@@ -324,6 +362,44 @@ ZPL_DEF zpl_b32           zpl_file_write_contents(char const* filepath, void con
  */
 ZPL_DEF char *zpl_file_read_lines(zpl_allocator alloc, zpl_array(char *)*lines, char const *filename, zpl_b32 strip_whitespace);
 
+typedef struct zpl_file_line_iter {
+    zpl_file *file;
+    zpl_allocator allocator;
+    char *buf;
+    zpl_isize cap;
+    zpl_isize start, scan, end; // NOTE: unread window and where the newline search resumes
+    zpl_i64 offset;
+    zpl_b32 eof;
+} zpl_file_line_iter;
+
+/**
+ * Prepares streaming iteration over the lines of a file, starting at its current position
+ *
+ * Only a rolling buffer is kept in memory, it grows to fit the longest line
+ * @param  it
+ * @param  alloc       Allocator used for the buffer
+ * @param  file        File to read from
+ * @param  buffer_size Initial buffer size, 0 uses ZPL_FILE_BUFFER_SIZE
+ */
+ZPL_DEF zpl_b32 zpl_file_line_iter_init(zpl_file_line_iter *it, zpl_allocator alloc, zpl_file *file, zpl_isize buffer_size);
+
+/**
+ * Yields the next line without its line ending
+ *
+ * The line points into the iterator's buffer and is valid until the next call
+ * @param  it
+ * @param  line Start of the line (not null-terminated)
+ * @param  len  Length of the line
+ * @return      false once the file is exhausted
+ */
+ZPL_DEF zpl_b32 zpl_file_line_next(zpl_file_line_iter *it, char const **line, zpl_isize *len);
+
+/**
+ * Releases the iterator's buffer, the file is left open
+ * @param  it
+ */
+ZPL_DEF void    zpl_file_line_iter_free(zpl_file_line_iter *it);
+
 //! @}
 
 /* inlines */
@@ -0,0 +1,45 @@
+// file: header/core/file_buffered.h
+
+/** @file file_buffered.c
+@brief Buffered file I/O
+@defgroup fileio Buffered file I/O
+
+User-space buffering on top of any zpl_file. Reads are served from a read-ahead buffer and
+sequential writes are coalesced into one write per buffer, so small zpl_file_read/zpl_file_write
+and zpl_fprintf calls no longer cost a syscall each. Buffered files are used through the regular zpl_file API.
+
+@{
+*/
+
+ZPL_BEGIN_C_DECLS
+
+/**
+ * Opens a file with buffered I/O
+ * @param  file
+ * @param  allocator   Allocator used for the buffer
+ * @param  mode        Open mode
+ * @param  filename    Path to the file
+ * @param  buffer_size Buffer size, 0 uses ZPL_FILE_BUFFER_SIZE
+ */
+ZPL_DEF zpl_file_error zpl_file_buffered_open(zpl_file *file, zpl_allocator allocator, zpl_file_mode mode, char const *filename, zpl_isize buffer_size);
+
+/**
+ * Adds buffering to an already opened file, the buffered file takes ownership and closes it
+ * @param  file
+ * @param  allocator   Allocator used for the buffer
+ * @param  inner       File to buffer
+ * @param  buffer_size Buffer size, 0 uses ZPL_FILE_BUFFER_SIZE
+ */
+ZPL_DEF zpl_b8 zpl_file_buffered_wrap(zpl_file *file, zpl_allocator allocator, zpl_file *inner, zpl_isize buffer_size);
+
+/**
+ * Writes out pending buffered data, does nothing for unbuffered files
+ * @param  file
+ */
+ZPL_DEF zpl_b32 zpl_file_flush(zpl_file *file);
+
+extern zpl_file_operations const zpl_buffered_file_operations;
+
+//! @}
+
+ZPL_END_C_DECLS
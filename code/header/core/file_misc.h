@@ -47,6 +47,43 @@ ZPL_DEF zpl_file_time zpl_fs_last_write_time(char const *filepath);
  */
 ZPL_DEF zpl_b32       zpl_fs_copy(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists);
 
+#ifndef ZPL_FS_COPY_CHUNK_SIZE
+#define ZPL_FS_COPY_CHUNK_SIZE 0x40000000 // largest single kernel transfer request
+#endif
+
+typedef enum zpl_fs_copy_method {
+    ZPL_FS_COPY_METHOD_NONE,
+    ZPL_FS_COPY_METHOD_SYSTEM,      // delegated to the OS copy routine
+    ZPL_FS_COPY_METHOD_COPY_RANGE,  // copy_file_range, in-kernel and reflink capable
+    ZPL_FS_COPY_METHOD_SENDFILE,
+    ZPL_FS_COPY_METHOD_READ_WRITE,
+} zpl_fs_copy_method;
+
+typedef struct zpl_fs_copy_stats {
+    zpl_i64 file_size;
+    zpl_i64 bytes_copied; // data actually transferred, holes in sparse files are skipped
+    zpl_f64 elapsed;      // in seconds
+    zpl_u8  method;       // zpl_fs_copy_method the copy ended up using
+} zpl_fs_copy_stats;
+
+/**
+ * Copies the file, preferring in-kernel transfers (copy_file_range, then sendfile) over
+ * a read/write loop. Files of any size are copied in chunks and holes of sparse files are preserved.
+ * Copying a file onto itself, or onto a hard link to it, fails and leaves it untouched.
+ * A source that gets shorter while it is being copied makes the copy fail.
+ * @param  existing_filename
+ * @param  new_filename
+ * @param  fail_if_exists
+ * @param  stats             optional, receives the transfer statistics
+ */
+ZPL_DEF zpl_b32       zpl_fs_copy_ex(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists, zpl_fs_copy_stats *stats);
+
+/**
+ * Returns the copy throughput in bytes per second
+ * @param  stats
+ */
+ZPL_DEF_INLINE zpl_f64 zpl_fs_copy_throughput(zpl_fs_copy_stats const *stats);
+
 /**
  * Moves the file to a directory
  * @param  existing_filename
@@ -98,9 +135,56 @@ ZPL_DEF void zpl_dirinfo_free(zpl_dir_info *dir);
  */
 ZPL_DEF void zpl_dirinfo_step(zpl_dir_entry *dir_entry);
 
+typedef enum zpl_dir_walk_flags {
+    ZPL_DIR_WALK_FILES   = ZPL_BIT(0),
+    ZPL_DIR_WALK_FOLDERS = ZPL_BIT(1),
+    ZPL_DIR_WALK_HIDDEN  = ZPL_BIT(2), // include entries starting with a dot
+} zpl_dir_walk_flags;
+
+typedef struct zpl_dir_walk_entry {
+    char const *path;   // full path, only valid for the duration of the callback
+    char const *name;   // points into path
+    zpl_isize   depth;  // 0 for direct children of the root
+    zpl_u8      type;   // zpl_dir_type
+} zpl_dir_walk_entry;
+
+/**
+ * Return false to stop the walk
+ */
+typedef zpl_b32 (*zpl_dir_walk_proc)(zpl_dir_walk_entry const *entry, void *user_data);
+
+typedef struct zpl_dir_walk_opts {
+    zpl_u32       flags;        // zpl_dir_walk_flags, 0 reports both files and folders
+    zpl_isize     max_depth;    // negative means unlimited, 0 lists the root only
+    char const   *pattern;      // glob (*, ?, [a-z], [!a]) matched against the entry name, NULL matches all
+    zpl_u32       thread_count; // >1 walks sub-directories on a job pool (requires ZPL_MODULE_JOBS)
+    zpl_allocator allocator;    // used for path buffers, defaults to zpl_heap(), must be thread-safe when walking in parallel
+} zpl_dir_walk_opts;
+
+/**
+ * Recursively walks a directory tree and reports every entry to the callback
+ * without building an intermediate listing. Entry types come from the directory
+ * stream itself, so no stat() is issued per entry on file systems that provide them.
+ * Symbolic links are reported but never followed.
+ *
+ * With thread_count > 1 sub-directories are walked concurrently and the callback
+ * may be invoked from several threads at once, in no particular order.
+ * @param  root      directory to walk
+ * @param  opts      walk options, NULL uses the defaults
+ * @param  proc      callback invoked per matching entry
+ * @param  user_data passed through to the callback
+ * @return           false if the root can't be opened
+ */
+ZPL_DEF zpl_b32 zpl_path_walk(char const *root, zpl_dir_walk_opts const *opts, zpl_dir_walk_proc proc, void *user_data);
+
 
 /* inlines */
 
+ZPL_IMPL_INLINE zpl_f64 zpl_fs_copy_throughput(zpl_fs_copy_stats const *stats) {
+    ZPL_ASSERT_NOT_NULL(stats);
+    return (stats->elapsed > 0.0) ? cast(zpl_f64)stats->file_size / stats->elapsed : 0.0;
+}
+
 ZPL_IMPL_INLINE zpl_b32 zpl_path_is_absolute(char const *path) {
     zpl_b32 result = false;
     ZPL_ASSERT_NOT_NULL(path);
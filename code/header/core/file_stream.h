@@ -44,7 +44,46 @@ ZPL_DEF zpl_b8 zpl_file_stream_open(zpl_file* file, zpl_allocator allocator, zpl
  */
 ZPL_DEF zpl_u8 *zpl_file_stream_buf(zpl_file* file, zpl_isize *size);
 
+#ifndef ZPL_FILE_ROPE_CHUNK_SIZE
+#define ZPL_FILE_ROPE_CHUNK_SIZE (64 * 1024)
+#endif
+
+/**
+ * Opens a new rope stream. Data lives in a list of chunks, so growing the stream
+ * never reallocates or copies what has been written already.
+ * @param file
+ * @param allocator
+ * @param chunk_size Minimum size of newly allocated chunks, 0 uses ZPL_FILE_ROPE_CHUNK_SIZE
+ */
+ZPL_DEF zpl_b8 zpl_file_rope_new(zpl_file *file, zpl_allocator allocator, zpl_isize chunk_size);
+
+/**
+ * Appends an external buffer to the rope without copying it and moves the cursor past it.
+ * The buffer has to outlive the stream, it is only copied if a later write overwrites a part of it.
+ * @param file   rope stream
+ * @param buffer
+ * @param size
+ */
+ZPL_DEF zpl_b32 zpl_file_rope_append_ref(zpl_file *file, void const *buffer, zpl_isize size);
+
+/**
+ * Exposes the rope's chunks in order, ready to be passed to zpl_file_writev.
+ * @param  file  rope stream
+ * @param  iov   (Optional) receives up to count chunks
+ * @param  count capacity of iov
+ * @return       total number of chunks
+ */
+ZPL_DEF zpl_isize zpl_file_rope_iovec(zpl_file *file, zpl_file_iovec *iov, zpl_isize count);
+
+/**
+ * Writes the rope's whole contents to another file at its cursor, without flattening it first.
+ * @param  file rope stream
+ * @param  dest
+ */
+ZPL_DEF zpl_b32 zpl_file_rope_write_to(zpl_file *file, zpl_file *dest);
+
 extern zpl_file_operations const zpl_memory_file_operations;
+extern zpl_file_operations const zpl_rope_file_operations;
 
 //! @}
 
@@ -9,6 +9,7 @@ Based on: https://github.com/rxi/microtar/
 
 Disclaimer: The pack method does not support file permissions nor GID/UID information. Only regular files are supported.
 Use zpl_tar_pack_dir to pack an entire directory recursively. Empty folders are ignored.
+Archives are written in the ustar format, paths or sizes that don't fit are stored in PAX extended headers.
 
 @{
 */
@@ -32,9 +33,16 @@ typedef enum {
     ZPL_TAR_TYPE_CHR        = '3',
     ZPL_TAR_TYPE_BLK        = '4',
     ZPL_TAR_TYPE_DIR        = '5',
-    ZPL_TAR_TYPE_FIFO       = '6'
+    ZPL_TAR_TYPE_FIFO       = '6',
+    ZPL_TAR_TYPE_PAX        = 'x',
+    ZPL_TAR_TYPE_PAX_GLOBAL = 'g',
+    ZPL_TAR_TYPE_GNU_LONGNAME = 'L'
 } zpl_tar_file_type;
 
+#ifndef ZPL_TAR_BUFFER_SIZE
+#define ZPL_TAR_BUFFER_SIZE (1024 * 1024) // NOTE: staging buffer when file data can't be copied in-kernel
+#endif
+
 typedef struct {
     char type;
     char *path;
@@ -59,7 +67,7 @@ ZPL_DEF zpl_isize zpl_tar_pack(zpl_file *archive, char const **paths, zpl_isize
 
 /**
  * @brief Packs an entire directory
- * Packs an entire directory of files recursively.
+ * Packs an entire directory of files recursively, files are streamed into the archive as the directory walk finds them.
  * @param archive archive we pack files to
  * @param path folder to pack
  * @param alloc memory allocator to use (ex. zpl_heap())
@@ -87,13 +95,89 @@ ZPL_DEF zpl_isize zpl_tar_unpack(zpl_file *archive, zpl_tar_unpack_proc *unpack_
  */
 ZPL_DEF_INLINE zpl_isize zpl_tar_unpack_dir(zpl_file *archive, char const *dest);
 
+#ifndef ZPL_TAR_UNPACK_BUDGET
+#define ZPL_TAR_UNPACK_BUDGET (32 * 1024 * 1024) // NOTE: upper bound of file data buffered for pending writes
+#endif
+
+/**
+ * @brief Unpacks an existing archive into directory using worker threads
+ * Headers and file data are read sequentially on the calling thread while the files are
+ * created and written by a job pool, at most ZPL_TAR_UNPACK_BUDGET bytes are in flight.
+ * Files too large for a share of the budget are written by the calling thread.
+ * Falls back to zpl_tar_unpack_dir without ZPL_MODULE_JOBS or with thread_count <= 1.
+ * @param archive archive we unpack files from
+ * @param dest directory to unpack files to
+ * @param thread_count number of worker threads
+ * @return error
+ */
+ZPL_DEF zpl_isize zpl_tar_unpack_dir_parallel(zpl_file *archive, char const *dest, zpl_u32 thread_count);
+
 ZPL_DEF ZPL_TAR_UNPACK_PROC(zpl_tar_default_list_file);
 ZPL_DEF ZPL_TAR_UNPACK_PROC(zpl_tar_default_unpack_file);
 
+typedef struct {
+    char *path;
+    zpl_i64 offset;  // start of the file data within the archive
+    zpl_i64 length;
+    char type;
+    zpl_isize next;  // next entry sharing the same path hash, -1 ends the chain
+} zpl_tar_entry;
+
+ZPL_TABLE_DECLARE(ZPL_DEF, zpl_tar_index_map, zpl_tar_index_map_, zpl_isize);
+
+typedef struct {
+    zpl_allocator allocator;
+    zpl_array(zpl_tar_entry) entries;
+    zpl_tar_index_map map;
+} zpl_tar_index;
+
+/**
+ * @brief Builds a lookup index of an archive
+ * Reads every header of the archive once, skipping over file data, and maps each path to its entry.
+ * When a path is stored multiple times the last occurrence wins, matching what an extraction would produce.
+ * @param index index to initialize
+ * @param archive archive to index, scanned from the beginning
+ * @param alloc memory allocator to use (ex. zpl_heap())
+ * @return error
+ */
+ZPL_DEF zpl_isize zpl_tar_index_init(zpl_tar_index *index, zpl_file *archive, zpl_allocator alloc);
+ZPL_DEF void zpl_tar_index_free(zpl_tar_index *index);
+
+/**
+ * @brief Looks up an archive entry by its path
+ * @return entry or NULL if the archive doesn't contain the path
+ */
+ZPL_DEF zpl_tar_entry *zpl_tar_index_find(zpl_tar_index *index, char const *path);
+
+/**
+ * @brief Opens an archive entry as a read-only file
+ * The view forwards reads to the archive within the entry bounds, it doesn't copy any data.
+ * Views of OS backed archives read at explicit offsets, so several views can be read concurrently.
+ * The archive has to stay open for the lifetime of the view.
+ * @param file file to initialize
+ * @param archive archive the entry belongs to
+ * @param entry entry obtained from the index
+ * @param alloc memory allocator to use (ex. zpl_heap())
+ * @return error
+ */
+ZPL_DEF zpl_file_error zpl_tar_open_entry(zpl_file *file, zpl_file *archive, zpl_tar_entry const *entry, zpl_allocator alloc);
+
+/**
+ * @brief Returns the entry data inside a memory mapped archive
+ * @param archive contents obtained from zpl_file_map_contents
+ * @param entry entry obtained from the index
+ */
+ZPL_DEF_INLINE void *zpl_tar_entry_data(zpl_file_contents const *archive, zpl_tar_entry const *entry);
+
 //! @}
 
 ZPL_IMPL_INLINE zpl_isize zpl_tar_unpack_dir(zpl_file *archive, char const *dest) {
     return zpl_tar_unpack(archive, zpl_tar_default_unpack_file, cast(void*)dest);
 }
 
+ZPL_IMPL_INLINE void *zpl_tar_entry_data(zpl_file_contents const *archive, zpl_tar_entry const *entry) {
+    ZPL_ASSERT(entry->offset + entry->length <= archive->size);
+    return cast(zpl_u8 *)archive->data + entry->offset;
+}
+
 ZPL_END_C_DECLS
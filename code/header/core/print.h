@@ -33,4 +33,45 @@ ZPL_DEF zpl_isize zpl_asprintf_va(zpl_allocator allocator, char **buffer, char c
 ZPL_DEF zpl_isize zpl_snprintf(char *str, zpl_isize n, char const *fmt, ...);
 ZPL_DEF zpl_isize zpl_snprintf_va(char *str, zpl_isize n, char const *fmt, va_list va);
 
+#ifndef ZPL_PRINTF_STACK_LEN
+#define ZPL_PRINTF_STACK_LEN 1024 // lines up to this size are formatted on the stack before falling back to ZPL_PRINTF_MAXLEN
+#endif
+
+#ifndef ZPL_FMT_MAX_SPECS
+#define ZPL_FMT_MAX_SPECS 32
+#endif
+
+typedef struct zpl_fmt_spec {
+    zpl_u32 literal_offset; // text copied ahead of the conversion
+    zpl_u32 literal_len;
+    zpl_i32 base, flags, width, precision;
+    char    conv;           // 0 if the spec is malformed and prints nothing
+} zpl_fmt_spec;
+
+/**
+ * Format string parsed ahead of time into literal runs and conversion specs,
+ * formatting with it only fetches and converts the arguments.
+ * The plan references the format string, which has to outlive it.
+ */
+typedef struct zpl_fmt {
+    char const  *text;
+    zpl_isize    count;
+    zpl_u32      tail_offset; // text after the last conversion
+    zpl_u32      tail_len;
+    zpl_fmt_spec specs[ZPL_FMT_MAX_SPECS];
+} zpl_fmt;
+
+/**
+ * Compiles a printf-style format, the same conversions as zpl_snprintf are supported
+ * @param  plan
+ * @param  fmt
+ * @return      false if the format holds more than ZPL_FMT_MAX_SPECS conversions
+ */
+ZPL_DEF zpl_b32 zpl_fmt_compile(zpl_fmt *plan, char const *fmt);
+
+ZPL_DEF zpl_isize zpl_fmt_snprintf(char *str, zpl_isize n, zpl_fmt const *plan, ...);
+ZPL_DEF zpl_isize zpl_fmt_snprintf_va(char *str, zpl_isize n, zpl_fmt const *plan, va_list va);
+ZPL_DEF zpl_isize zpl_fmt_fprintf(zpl_file *f, zpl_fmt const *plan, ...);
+ZPL_DEF zpl_isize zpl_fmt_fprintf_va(zpl_file *f, zpl_fmt const *plan, va_list va);
+
 ZPL_END_C_DECLS
@@ -34,13 +34,13 @@ ZPL_DEF_INLINE zpl_b32 zpl_char_is_control(char c);
 ZPL_DEF_INLINE void zpl_str_to_lower(char *str);
 ZPL_DEF_INLINE void zpl_str_to_upper(char *str);
 
-ZPL_DEF_INLINE char const *zpl_str_trim(char const *str, zpl_b32 catch_newline);
-ZPL_DEF_INLINE char const *zpl_str_skip(char const *str, char c);
-ZPL_DEF_INLINE char const *zpl_str_skip_any(char const *str, char const*char_list);
+ZPL_DEF char const *zpl_str_trim(char const *str, zpl_b32 catch_newline);
+ZPL_DEF char const *zpl_str_skip(char const *str, char c);
+ZPL_DEF char const *zpl_str_skip_any(char const *str, char const*char_list);
 ZPL_DEF_INLINE char const *zpl_str_skip_literal(char const *str, char c);
 ZPL_DEF_INLINE char const *zpl_str_control_skip(char const *str, char c);
 
-ZPL_DEF_INLINE zpl_isize   zpl_strlen(const char *str);
+ZPL_DEF zpl_isize   zpl_strlen(const char *str);
 ZPL_DEF_INLINE zpl_isize   zpl_strnlen(const char *str, zpl_isize max_len);
 ZPL_DEF_INLINE zpl_i32     zpl_strcmp(const char *s1, const char *s2);
 ZPL_DEF_INLINE zpl_i32     zpl_strncmp(const char *s1, const char *s2, zpl_isize len);
@@ -76,6 +76,9 @@ ZPL_DEF zpl_f64 zpl_str_to_f64(const char *str, char **end_ptr);
 ZPL_DEF void    zpl_i64_to_str(zpl_i64 value, char *string, zpl_i32 base);
 ZPL_DEF void    zpl_u64_to_str(zpl_u64 value, char *string, zpl_i32 base);
 
+// Writes the shortest decimal form that reads back as the same value, string must hold 32 characters.
+ZPL_DEF zpl_isize zpl_f64_to_str(zpl_f64 value, char *string);
+
 ZPL_DEF_INLINE zpl_f32 zpl_str_to_f32(const char *str, char **end_ptr);
 
 ////////////////////////////////////////////////////////////////
@@ -99,8 +102,30 @@ ZPL_DEF zpl_isize zpl_utf8_decode(zpl_u8 const *str, zpl_isize str_len, zpl_rune
 ZPL_DEF zpl_isize zpl_utf8_codepoint_size(zpl_u8 const *str, zpl_isize str_len);
 ZPL_DEF zpl_isize zpl_utf8_encode_rune(zpl_u8 buf[4], zpl_rune r);
 
+// NOTE: Returns len when str is well-formed, otherwise the offset of the first invalid or truncated sequence.
+// Overlong forms, surrogates and codepoints above U+10FFFF are rejected.
+ZPL_DEF zpl_isize zpl_utf8_validate(zpl_u8 const *str, zpl_isize len);
+ZPL_DEF_INLINE zpl_b32 zpl_utf8_is_valid(zpl_u8 const *str, zpl_isize len);
+
+// NOTE: Number of units the bulk conversions below produce, the input is expected to be valid
+ZPL_DEF zpl_isize zpl_utf8_utf16_length(zpl_u8 const *str, zpl_isize len);
+ZPL_DEF zpl_isize zpl_utf8_utf32_length(zpl_u8 const *str, zpl_isize len);
+ZPL_DEF zpl_isize zpl_utf16_utf8_length(zpl_u16 const *str, zpl_isize len);
+ZPL_DEF zpl_isize zpl_utf32_utf8_length(zpl_rune const *str, zpl_isize len);
+
+// NOTE: Bulk conversions, out has to hold the precomputed length. Nothing is NUL-terminated.
+// They return the number of units written or -1 on malformed input (unpaired surrogates included).
+ZPL_DEF zpl_isize zpl_utf8_to_utf16(zpl_u16 *out, zpl_u8 const *str, zpl_isize len);
+ZPL_DEF zpl_isize zpl_utf8_to_utf32(zpl_rune *out, zpl_u8 const *str, zpl_isize len);
+ZPL_DEF zpl_isize zpl_utf16_to_utf8(zpl_u8 *out, zpl_u16 const *str, zpl_isize len);
+ZPL_DEF zpl_isize zpl_utf32_to_utf8(zpl_u8 *out, zpl_rune const *str, zpl_isize len);
+
 /* inlines */
 
+ZPL_IMPL_INLINE zpl_b32 zpl_utf8_is_valid(zpl_u8 const *str, zpl_isize len) {
+    return zpl_utf8_validate(str, len) == len;
+}
+
 ZPL_IMPL_INLINE char zpl_char_to_lower(char c) {
     if (c >= 'A' && c <= 'Z') return 'a' + (c - 'A');
     return c;
@@ -171,13 +196,6 @@ ZPL_IMPL_INLINE void zpl_str_to_upper(char *str) {
     }
 }
 
-ZPL_IMPL_INLINE zpl_isize zpl_strlen(const char *str) {
-    if (str == NULL) { return 0; }
-    const char *p = str;
-    while (*str) str++;
-    return str-p;
-}
-
 ZPL_IMPL_INLINE zpl_isize zpl_strnlen(const char *str, zpl_isize max_len) {
     const char *end = cast(const char *) zpl_memchr(str, 0, max_len);
     if (end) return end - str;
@@ -376,27 +394,6 @@ ZPL_IMPL_INLINE const char *zpl_char_last_occurence(const char *s, char c) {
     return result;
 }
 
-ZPL_IMPL_INLINE char const *zpl_str_trim(char const *str, zpl_b32 catch_newline)
-{
-    while (*str && zpl_char_is_space(*str) && (!catch_newline || (catch_newline && *str != '\n'))) { ++str; }
-    return str;
-}
-
-ZPL_IMPL_INLINE char const *zpl_str_skip(char const *str, char c) {
-    while (*str && *str != c) { ++str; }
-    return str;
-}
-
-ZPL_IMPL_INLINE char const *zpl_str_skip_any(char const *str, char const*char_list) {
-    char const *closest_ptr = cast(char const *) zpl_ptr_add((void*)str, zpl_strlen(str));
-    zpl_isize char_list_count = zpl_strlen(char_list);
-    for (zpl_isize i = 0; i < char_list_count; i++) {
-        char const *p = zpl_str_skip(str, char_list[i]);
-        closest_ptr = zpl_min(closest_ptr, p);
-    }
-    return closest_ptr;
-}
-
 ZPL_IMPL_INLINE char const *zpl_str_skip_literal(char const *str, char c) {
     if (*str == '\0' || *str == c)
         return str;
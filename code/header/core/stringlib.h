@@ -28,6 +28,91 @@ ZPL_DEF zpl_string zpl_string_trim(zpl_string str, const char *cut_set);
 ZPL_DEF zpl_string zpl_string_append_rune(zpl_string str, zpl_rune r);
 ZPL_DEF zpl_string zpl_string_append_fmt(zpl_string str, const char *fmt, ...);
 
+typedef struct zpl_strview {
+    char const *ptr;
+    zpl_isize   len;
+} zpl_strview;
+
+#define ZPL_STRVIEW_LIT(lit) zpl_strview_make((lit), zpl_size_of(lit) - 1)
+
+ZPL_DEF_INLINE zpl_strview zpl_strview_make(char const *ptr, zpl_isize len);
+ZPL_DEF_INLINE zpl_strview zpl_strview_from_cstr(char const *cstr);
+ZPL_DEF_INLINE zpl_b32     zpl_strview_are_equal(zpl_strview lhs, zpl_strview rhs);
+ZPL_DEF_INLINE zpl_b32     zpl_strview_equals_cstr(zpl_strview view, char const *cstr); // NOTE: cstr isn't measured up front
+
+ZPL_DEF zpl_string zpl_string_make_view(zpl_allocator a, zpl_strview view);
+ZPL_DEF_INLINE zpl_string  zpl_string_append_view(zpl_string str, zpl_strview view);
+ZPL_DEF_INLINE zpl_strview zpl_string_view(zpl_string const str);
+
+/* Short strings stored inline, no allocation happens until they outgrow ZPL_STRING_SSO_CAPACITY bytes,
+ * longer ones spill into a regular zpl_string. The last byte holds the inline length or ZPL__STRING_SSO_HEAP,
+ * so a zero initialized zpl_string_sso is a valid empty string. */
+#define ZPL_STRING_SSO_CAPACITY 22
+#define ZPL__STRING_SSO_HEAP 0xFF
+
+typedef union zpl_string_sso {
+    char       buf[ZPL_STRING_SSO_CAPACITY + 2];
+    zpl_string heap;
+} zpl_string_sso;
+
+//! Replaces the contents, the allocator is only used if the text doesn't fit inline. Returns false if the allocation fails.
+ZPL_DEF zpl_b32 zpl_string_sso_set(zpl_string_sso *str, zpl_allocator a, zpl_strview text);
+
+//! Appends to the string, the allocator is only used when spilling to the heap. Returns false if the allocation fails.
+ZPL_DEF zpl_b32 zpl_string_sso_append(zpl_string_sso *str, zpl_allocator a, zpl_strview text);
+
+//! Releases the heap storage, if any, and leaves an empty string.
+ZPL_DEF void    zpl_string_sso_free(zpl_string_sso *str);
+
+ZPL_DEF_INLINE zpl_b32     zpl_string_sso_is_inline(zpl_string_sso const *str);
+ZPL_DEF_INLINE zpl_isize   zpl_string_sso_length(zpl_string_sso const *str);
+ZPL_DEF_INLINE char const *zpl_string_sso_cstr(zpl_string_sso const *str);
+ZPL_DEF_INLINE zpl_strview zpl_string_sso_view(zpl_string_sso const *str);
+
+/* Accumulates text into a list of fixed size chunks, nothing already written is ever moved,
+ * the result is materialized once by zpl_string_builder_to_string or streamed out with zpl_string_builder_write_to.
+ * Formatted appends are printed straight into the free space of the tail chunk. */
+#ifndef ZPL_STRING_BUILDER_CHUNK_SIZE
+#define ZPL_STRING_BUILDER_CHUNK_SIZE 16384
+#endif
+
+typedef struct zpl_string_builder_chunk {
+    struct zpl_string_builder_chunk *next;
+    zpl_isize len;
+    zpl_isize cap;
+} zpl_string_builder_chunk;
+
+struct zpl_file;
+
+typedef struct zpl_string_builder {
+    zpl_allocator allocator;
+    zpl_string_builder_chunk *head, *tail;
+    zpl_isize length;
+    zpl_isize chunk_size;
+} zpl_string_builder;
+
+//! Initializes an empty builder, chunk_size of 0 uses ZPL_STRING_BUILDER_CHUNK_SIZE. No memory is allocated until the first append.
+ZPL_DEF void      zpl_string_builder_init(zpl_string_builder *b, zpl_allocator a, zpl_isize chunk_size);
+ZPL_DEF void      zpl_string_builder_free(zpl_string_builder *b);
+
+//! Empties the builder, the first chunk is kept for reuse.
+ZPL_DEF void      zpl_string_builder_clear(zpl_string_builder *b);
+
+ZPL_DEF zpl_b32   zpl_string_builder_append(zpl_string_builder *b, void const *data, zpl_isize len);
+ZPL_DEF zpl_b32   zpl_string_builder_append_rune(zpl_string_builder *b, zpl_rune r);
+ZPL_DEF zpl_b32   zpl_string_builder_append_fmt(zpl_string_builder *b, char const *fmt, ...);
+ZPL_DEF zpl_b32   zpl_string_builder_append_fmt_va(zpl_string_builder *b, char const *fmt, va_list va);
+
+//! Copies the contents into a single string allocated with the exact length.
+ZPL_DEF zpl_string zpl_string_builder_to_string(zpl_string_builder const *b, zpl_allocator a);
+
+//! Writes the chunks out with a single vectored write where the file supports it.
+ZPL_DEF zpl_b32   zpl_string_builder_write_to(zpl_string_builder const *b, struct zpl_file *file);
+
+ZPL_DEF_INLINE zpl_b32   zpl_string_builder_appendc(zpl_string_builder *b, char const *str);
+ZPL_DEF_INLINE zpl_b32   zpl_string_builder_append_view(zpl_string_builder *b, zpl_strview view);
+ZPL_DEF_INLINE zpl_isize zpl_string_builder_length(zpl_string_builder const *b);
+
 ZPL_DEF_INLINE zpl_string zpl_string_make(zpl_allocator a, const char *str);
 ZPL_DEF_INLINE void       zpl_string_free(zpl_string str);
 ZPL_DEF_INLINE void       zpl_string_clear(zpl_string str);
@@ -78,5 +163,61 @@ ZPL_IMPL_INLINE zpl_string zpl_string_append(zpl_string str, zpl_string const ot
 
 ZPL_IMPL_INLINE zpl_string zpl_string_trim_space(zpl_string str) { return zpl_string_trim(str, " \t\r\n\v\f"); }
 
+ZPL_IMPL_INLINE zpl_strview zpl_strview_make(char const *ptr, zpl_isize len) {
+    zpl_strview view;
+    view.ptr = ptr;
+    view.len = len;
+    return view;
+}
+
+ZPL_IMPL_INLINE zpl_strview zpl_strview_from_cstr(char const *cstr) { return zpl_strview_make(cstr, zpl_strlen(cstr)); }
+
+ZPL_IMPL_INLINE zpl_b32 zpl_strview_are_equal(zpl_strview lhs, zpl_strview rhs) {
+    return lhs.len == rhs.len && (lhs.ptr == rhs.ptr || !zpl_memcompare(lhs.ptr, rhs.ptr, lhs.len));
+}
+
+ZPL_IMPL_INLINE zpl_b32 zpl_strview_equals_cstr(zpl_strview view, char const *cstr) {
+    zpl_isize i;
+    if (!cstr) return view.len == 0;
+    for (i = 0; cstr[i]; i++) {
+        if (i == view.len || cstr[i] != view.ptr[i]) return false;
+    }
+    return i == view.len;
+}
+
+ZPL_IMPL_INLINE zpl_string zpl_string_append_view(zpl_string str, zpl_strview view) {
+    return zpl_string_append_length(str, view.ptr, view.len);
+}
+
+ZPL_IMPL_INLINE zpl_strview zpl_string_view(zpl_string const str) {
+    return zpl_strview_make(str, str ? zpl_string_length(str) : 0);
+}
+
+ZPL_IMPL_INLINE zpl_b32 zpl_string_sso_is_inline(zpl_string_sso const *str) {
+    return cast(zpl_u8)str->buf[ZPL_STRING_SSO_CAPACITY + 1] != ZPL__STRING_SSO_HEAP;
+}
+
+ZPL_IMPL_INLINE zpl_isize zpl_string_sso_length(zpl_string_sso const *str) {
+    return zpl_string_sso_is_inline(str) ? cast(zpl_u8)str->buf[ZPL_STRING_SSO_CAPACITY + 1] : zpl_string_length(str->heap);
+}
+
+ZPL_IMPL_INLINE char const *zpl_string_sso_cstr(zpl_string_sso const *str) {
+    return zpl_string_sso_is_inline(str) ? str->buf : str->heap;
+}
+
+ZPL_IMPL_INLINE zpl_strview zpl_string_sso_view(zpl_string_sso const *str) {
+    return zpl_strview_make(zpl_string_sso_cstr(str), zpl_string_sso_length(str));
+}
+
+ZPL_IMPL_INLINE zpl_b32 zpl_string_builder_appendc(zpl_string_builder *b, char const *str) {
+    return zpl_string_builder_append(b, str, zpl_strlen(str));
+}
+
+ZPL_IMPL_INLINE zpl_b32 zpl_string_builder_append_view(zpl_string_builder *b, zpl_strview view) {
+    return zpl_string_builder_append(b, view.ptr, view.len);
+}
+
+ZPL_IMPL_INLINE zpl_isize zpl_string_builder_length(zpl_string_builder const *b) { return b->length; }
+
 
 ZPL_END_C_DECLS
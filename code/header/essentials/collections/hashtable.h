@@ -7,6 +7,7 @@
 
  This is an attempt to implement a templated hash table
  NOTE: The key is always a zpl_u64 for simplicity and you will _probably_ _never_ need anything bigger.
+ Keys made of bytes or strings are turned into one with ZPL_TABLE_HASH(data, len).
 
  Hash table type and function declaration, call: ZPL_TABLE_DECLARE(PREFIX, NAME, FUNC, VALUE)
  Hash table function definitions, call: ZPL_TABLE_DEFINE(NAME, FUNC, VALUE)
@@ -38,6 +39,20 @@ typedef struct zpl_hash_table_find_result {
     zpl_isize entry_index;
 } zpl_hash_table_find_result;
 
+/**
+ * Default hash for byte and string keys: zpl_hash64 when the hashing module is built in, FNV-1a otherwise.
+ * Define ZPL_TABLE_HASH(data, len) before including zpl to use a different function.
+ */
+#ifndef ZPL_TABLE_HASH
+#    if defined(ZPL_MODULE_HASHING)
+#        define ZPL_TABLE_HASH(data, len) zpl_hash64((data), (len))
+#    else
+#        define ZPL_TABLE_HASH(data, len) zpl__table_fnv64a((data), (len))
+#    endif
+#endif
+
+ZPL_DEF_INLINE zpl_u64 zpl__table_fnv64a(void const *data, zpl_isize len);
+
 /**
  * Combined macro for a quick delcaration + definition
  */
@@ -235,4 +250,11 @@ typedef struct zpl_hash_table_find_result {
 
 //! @}
 
+ZPL_IMPL_INLINE zpl_u64 zpl__table_fnv64a(void const *data, zpl_isize len) {
+    zpl_u8 const *c = cast(zpl_u8 const *) data;
+    zpl_u64 h = 0xcbf29ce484222325ull;
+    for (zpl_isize i = 0; i < len; i++) h = (h ^ c[i]) * 0x100000001b3ull;
+    return h;
+}
+
 ZPL_END_C_DECLS
@@ -70,12 +70,28 @@ ZPL_DEF_INLINE zpl_i32 zpl_memcompare(void const *s1, void const *s2, zpl_isize
 //! Swap memory contents between 2 locations with size.
 ZPL_DEF void zpl_memswap(void *i, void *j, zpl_isize size);
 
+typedef enum zpl_simd_level {
+    ZPL_SIMD_SCALAR,
+    ZPL_SIMD_SSE2,
+    ZPL_SIMD_AVX2,
+    ZPL_SIMD_NEON,
+} zpl_simd_level;
+
+//! Returns the instruction set used by the vectorized memory and string scans, detected on first use.
+ZPL_DEF zpl_simd_level zpl_simd_level_get(void);
+
+//! Forces an instruction set for the vectorized scans, unsupported levels fall back to the detected one. Returns the level in use.
+ZPL_DEF zpl_simd_level zpl_simd_level_set(zpl_simd_level level);
+
 //! Search for a constant value within the size limit at memory location.
 ZPL_DEF void const *zpl_memchr(void const *data, zpl_u8 byte_value, zpl_isize size);
 
 //! Search for a constant value within the size limit at memory location in backwards.
 ZPL_DEF void const *zpl_memrchr(void const *data, zpl_u8 byte_value, zpl_isize size);
 
+//! Search for the first byte contained in set within the size limit. Sets of up to 16 bytes are vectorized.
+ZPL_DEF void const *zpl_memchr_any(void const *data, zpl_isize size, zpl_u8 const *set, zpl_isize set_len);
+
 //! Copy non-overlapping memory from source to destination.
 ZPL_DEF void *zpl_memcopy(void *dest, void const *source, zpl_isize size);
 
@@ -0,0 +1,62 @@
+// file: header/file_async.h
+
+/** @file file_async.c
+@brief Asynchronous file I/O
+@defgroup file_async Asynchronous file I/O
+
+ Keeps many positional reads and writes in flight from a single thread. Requests are queued with
+ zpl_file_read_async/zpl_file_write_async, submitted in batches and reported back through
+ zpl_file_async_poll/zpl_file_async_wait. On Linux requests go through io_uring, elsewhere
+ (or when io_uring is unavailable) they run on a zpl_jobs_system thread pool.
+
+ Files that are not backed by an OS handle (memory streams, buffered files) are served
+ synchronously when the request is made and complete on the next poll.
+
+ @{
+ */
+
+ZPL_BEGIN_C_DECLS
+
+typedef enum {
+    /* skips io_uring and always uses the thread pool */
+    ZPL_FILE_ASYNC_FORCE_THREADS = ZPL_BIT(0),
+} zpl_file_async_flags;
+
+typedef struct zpl_file_async_completion {
+    void *user_data;
+    zpl_isize result; ///< bytes transferred, negative on failure
+} zpl_file_async_completion;
+
+typedef struct zpl_file_async {
+    zpl_allocator alloc;
+    zpl_u32 depth;
+    zpl_u32 in_flight;
+    zpl_b32 uses_io_uring;
+
+    zpl_mutex lock;
+    zpl_jobs_system pool;
+    void *state; ///< backend internals
+} zpl_file_async;
+
+//! Initialise a request queue able to hold depth requests in flight.
+ZPL_DEF zpl_b32 zpl_file_async_init(zpl_file_async *q, zpl_allocator a, zpl_u32 depth, zpl_u32 flags);
+
+//! Wait for all requests in flight and release the queue.
+ZPL_DEF void    zpl_file_async_free(zpl_file_async *q);
+
+//! Queue a read of size bytes at offset, returns false when the queue is full. The buffer has to stay valid until completion.
+ZPL_DEF zpl_b32 zpl_file_read_async(zpl_file_async *q, zpl_file *file, void *buffer, zpl_isize size, zpl_i64 offset, void *user_data);
+
+//! Queue a write of size bytes at offset, returns false when the queue is full. The buffer has to stay valid until completion.
+ZPL_DEF zpl_b32 zpl_file_write_async(zpl_file_async *q, zpl_file *file, void const *buffer, zpl_isize size, zpl_i64 offset, void *user_data);
+
+//! Hand queued requests to the backend, poll and wait do this as well.
+ZPL_DEF void    zpl_file_async_submit(zpl_file_async *q);
+
+//! Collect up to max finished requests without blocking, returns the number collected.
+ZPL_DEF zpl_isize zpl_file_async_poll(zpl_file_async *q, zpl_file_async_completion *completions, zpl_isize max);
+
+//! Collect up to max finished requests, blocks until at least one is done unless nothing is in flight.
+ZPL_DEF zpl_isize zpl_file_async_wait(zpl_file_async *q, zpl_file_async_completion *completions, zpl_isize max);
+
+ZPL_END_C_DECLS
@@ -4,7 +4,7 @@
 @brief Hashing and Checksum Functions
 @defgroup hashing Hashing and Checksum Functions
 
-Several hashing methods used by zpl internally but possibly useful outside of it. Contains: adler32, crc32/64, fnv32/64/a and murmur32/64
+Several hashing methods used by zpl internally but possibly useful outside of it. Contains: base64, adler32, crc32/32c/64, fnv32/64/a, murmur32/64 and hash64/128
 
 @{
 */
@@ -14,18 +14,77 @@ ZPL_BEGIN_C_DECLS
 
 ZPL_DEF zpl_u32 zpl_adler32(void const *data, zpl_isize len);
 
+/*
+ * CRC-32 (zlib, PNG), CRC-32C (Castagnoli, iSCSI, ext4) and CRC-64 (Jones, as used by Redis) use slice-by-8 tables,
+ * on x86-64 large buffers are folded with PCLMULQDQ and CRC-32C uses the SSE4.2 crc32 instruction,
+ * on ARMv8 built with the CRC extension both CRC32 variants use its instructions.
+ */
 ZPL_DEF zpl_u32 zpl_crc32(void const *data, zpl_isize len);
+ZPL_DEF zpl_u32 zpl_crc32c(void const *data, zpl_isize len);
 ZPL_DEF zpl_u64 zpl_crc64(void const *data, zpl_isize len);
 
+//! Continues a checksum over the next piece of the data, start with 0: zpl_crc32_update(zpl_crc32(a, n), b, m) equals the CRC of a and b together.
+ZPL_DEF zpl_u32 zpl_crc32_update(zpl_u32 crc, void const *data, zpl_isize len);
+ZPL_DEF zpl_u32 zpl_crc32c_update(zpl_u32 crc, void const *data, zpl_isize len);
+ZPL_DEF zpl_u64 zpl_crc64_update(zpl_u64 crc, void const *data, zpl_isize len);
+
 // These use FNV-1 algorithm
 ZPL_DEF zpl_u32 zpl_fnv32(void const *data, zpl_isize len);
 ZPL_DEF zpl_u64 zpl_fnv64(void const *data, zpl_isize len);
 ZPL_DEF zpl_u32 zpl_fnv32a(void const *data, zpl_isize len);
 ZPL_DEF zpl_u64 zpl_fnv64a(void const *data, zpl_isize len);
 
+typedef enum {
+    ZPL_BASE64_URL    = ZPL_BIT(0), // '-' and '_' in place of '+' and '/' (RFC 4648, section 5)
+    ZPL_BASE64_NO_PAD = ZPL_BIT(1), // no trailing '=' when encoding, decoding accepts both forms
+} zpl_base64_flags;
+
+//! Returns a NUL-terminated copy of data encoded with the standard alphabet, NULL for empty input.
 ZPL_DEF zpl_u8 *zpl_base64_encode(zpl_allocator a, void const *data, zpl_isize len);
+
+//! Returns the NUL-terminated decoded bytes, NULL if the input is not valid base64.
 ZPL_DEF zpl_u8 *zpl_base64_decode(zpl_allocator a, void const *data, zpl_isize len);
 
+//! Number of characters zpl_base64_encode_to writes for len bytes.
+ZPL_DEF_INLINE zpl_isize zpl_base64_encoded_len(zpl_isize len, zpl_u32 flags);
+
+//! Upper bound of the bytes zpl_base64_decode_to writes for len characters.
+ZPL_DEF_INLINE zpl_isize zpl_base64_decoded_len(zpl_isize len);
+
+/**
+ * Encodes data into a caller-provided buffer, no NUL is appended
+ * @param  out   room for zpl_base64_encoded_len(len, flags) characters
+ * @param  flags zpl_base64_flags
+ * @return characters written
+ */
+ZPL_DEF zpl_isize zpl_base64_encode_to(void *out, void const *data, zpl_isize len, zpl_u32 flags);
+
+/**
+ * Decodes data into a caller-provided buffer, padding is optional but has to be complete when present
+ * @param  out   room for zpl_base64_decoded_len(len) bytes
+ * @param  flags zpl_base64_flags, selects the alphabet
+ * @return bytes written or -1 on characters outside the alphabet (whitespace included) or a truncated group
+ */
+ZPL_DEF zpl_isize zpl_base64_decode_to(void *out, void const *data, zpl_isize len, zpl_u32 flags);
+
+/* encodes a payload handed over in pieces of any size, the output matches a single zpl_base64_encode_to call */
+typedef struct zpl_base64_stream {
+    zpl_u32 flags;
+    zpl_u8  tail[3]; // bytes left over from the previous piece
+    zpl_u8  tail_len;
+} zpl_base64_stream;
+
+ZPL_DEF void zpl_base64_stream_init(zpl_base64_stream *stream, zpl_u32 flags);
+
+//! Encodes the next piece, out needs room for zpl_base64_stream_len(len) characters. Returns characters written.
+ZPL_DEF zpl_isize zpl_base64_stream_encode(zpl_base64_stream *stream, void *out, void const *data, zpl_isize len);
+
+//! Encodes the left over bytes and the padding, out needs room for 4 characters. Returns characters written.
+ZPL_DEF zpl_isize zpl_base64_stream_finish(zpl_base64_stream *stream, void *out);
+
+//! Most characters a zpl_base64_stream_encode call writes for len bytes.
+ZPL_DEF_INLINE zpl_isize zpl_base64_stream_len(zpl_isize len);
+
 //! Based on MurmurHash3
 ZPL_DEF zpl_u32 zpl_murmur32_seed(void const *data, zpl_isize len, zpl_u32 seed);
 
@@ -38,9 +97,62 @@ ZPL_DEF_INLINE zpl_u32 zpl_murmur32(void const *data, zpl_isize len);
 //! Default seed of 0x9747b28c
 ZPL_DEF_INLINE zpl_u64 zpl_murmur64(void const *data, zpl_isize len);
 
+/*
+ * General purpose 64/128-bit hash built on the wyhash construction: short keys cost two 64x64->128-bit multiplies,
+ * longer ones are consumed 48 bytes at a time over three independent lanes. Not cryptographic.
+ *
+ * The seeded variants use public secrets, so collisions found for one seed carry over to every other seed.
+ * Tables fed with untrusted keys should hash with a zpl_hash_key made from a random value instead.
+ */
+typedef struct zpl_hash128 {
+    zpl_u64 lo; // same as zpl_hash64_seed over the same data and seed
+    zpl_u64 hi;
+} zpl_hash128;
+
+typedef struct zpl_hash_key {
+    zpl_u64 seed;
+    zpl_u64 secret[8]; // first half for the 64-bit hash, the second one adds the upper 128-bit word
+} zpl_hash_key;
+
+//! Derives private secrets and a seed from a random value, e.g. zpl_rdtsc() mixed with a zpl_random source.
+ZPL_DEF void zpl_hash_key_init(zpl_hash_key *key, zpl_u64 random);
+
+ZPL_DEF zpl_u64 zpl_hash64_seed(void const *data, zpl_isize len, zpl_u64 seed);
+ZPL_DEF zpl_u64 zpl_hash64_keyed(void const *data, zpl_isize len, zpl_hash_key const *key);
+ZPL_DEF zpl_hash128 zpl_hash128_seed(void const *data, zpl_isize len, zpl_u64 seed);
+ZPL_DEF zpl_hash128 zpl_hash128_keyed(void const *data, zpl_isize len, zpl_hash_key const *key);
+
+//! Default seed of 0
+ZPL_DEF_INLINE zpl_u64 zpl_hash64(void const *data, zpl_isize len);
+
+/* hashes data handed over in pieces of any size, the digest matches zpl_hash64_seed/_keyed over the whole input */
+typedef struct zpl_hash_state {
+    zpl_u64 secret[4];
+    zpl_u64 lane[3];
+    zpl_u64 len;      // total bytes so far, the last len % 48 of them wait in buf
+    zpl_u8  buf[48];  // a block is consumed as soon as it is complete
+    zpl_u8  last[16]; // end of the last consumed block, the digest may need it
+} zpl_hash_state;
+
+ZPL_DEF void zpl_hash_state_init(zpl_hash_state *state, zpl_u64 seed);
+ZPL_DEF void zpl_hash_state_init_keyed(zpl_hash_state *state, zpl_hash_key const *key);
+ZPL_DEF void zpl_hash_state_update(zpl_hash_state *state, void const *data, zpl_isize len);
+
+//! Returns the hash of everything passed so far, the state can keep being updated afterwards.
+ZPL_DEF zpl_u64 zpl_hash_state_digest(zpl_hash_state const *state);
+
 //! @}
 
+ZPL_IMPL_INLINE zpl_isize zpl_base64_encoded_len(zpl_isize len, zpl_u32 flags) {
+    if (flags & ZPL_BASE64_NO_PAD) return len / 3 * 4 + (len % 3 ? len % 3 + 1 : 0);
+    return (len + 2) / 3 * 4;
+}
+ZPL_IMPL_INLINE zpl_isize zpl_base64_decoded_len(zpl_isize len) { return (len + 3) / 4 * 3; }
+ZPL_IMPL_INLINE zpl_isize zpl_base64_stream_len(zpl_isize len) { return (len / 3 + 1) * 4; }
+
 ZPL_IMPL_INLINE zpl_u32 zpl_murmur32(void const *data, zpl_isize len) { return zpl_murmur32_seed(data, len, 0x9747b28c); }
 ZPL_IMPL_INLINE zpl_u64 zpl_murmur64(void const *data, zpl_isize len) { return zpl_murmur64_seed(data, len, 0x9747b28c); }
 
+ZPL_IMPL_INLINE zpl_u64 zpl_hash64(void const *data, zpl_isize len) { return zpl_hash64_seed(data, len, 0); }
+
 ZPL_END_C_DECLS
@@ -0,0 +1,146 @@
+// file: header/log.h
+
+/** @file log.c
+@brief Asynchronous logger
+@defgroup log Asynchronous logger
+
+ Log calls only capture their arguments: the format is compiled once per call site with zpl_fmt_compile,
+ the raw values are copied into a lock-free ring owned by the calling thread and the call returns.
+ A background thread formats the records and writes them to a zpl_file in batches.
+
+ %s arguments are copied into the record, every other argument is stored by value, so nothing
+ passed to a log call has to outlive it. Call sites below ZPL_LOG_MIN_LEVEL compile to nothing.
+
+ The format of a call site has to be a string literal: the compiled plan keeps pointing into it and
+ the flusher reads it long after the call returned. The ZPL_LOG_* macros reject anything else at
+ compile time, zpl_log_write drops records whose format is not the one the site was compiled from.
+ Runtime text goes through "%s".
+
+ @{
+ */
+
+ZPL_BEGIN_C_DECLS
+
+typedef enum {
+    ZPL_LOG_LEVEL_TRACE,
+    ZPL_LOG_LEVEL_DEBUG,
+    ZPL_LOG_LEVEL_INFO,
+    ZPL_LOG_LEVEL_WARN,
+    ZPL_LOG_LEVEL_ERROR,
+    ZPL_LOG_LEVEL_FATAL,
+    ZPL_LOG_LEVEL_OFF,
+} zpl_log_level;
+
+#ifndef ZPL_LOG_MIN_LEVEL
+#define ZPL_LOG_MIN_LEVEL ZPL_LOG_LEVEL_TRACE
+#endif
+
+#ifndef ZPL_LOG_MAX_THREADS
+#define ZPL_LOG_MAX_THREADS 64 // each logging thread keeps its ring for the lifetime of the logger
+#endif
+
+#ifndef ZPL_LOG_RING_SIZE
+#define ZPL_LOG_RING_SIZE 65536 // per thread, must be a power of two
+#endif
+
+#ifndef ZPL_LOG_BATCH_SIZE
+#define ZPL_LOG_BATCH_SIZE 65536 // formatted text collected before each write
+#endif
+
+#ifndef ZPL_LOG_IDLE_MS
+#define ZPL_LOG_IDLE_MS 1 // flusher sleep once all rings are empty
+#endif
+
+typedef enum {
+    ZPL_LOG_TIMESTAMP  = ZPL_BIT(0), // UTC "YYYY-MM-DD hh:mm:ss.mmm"
+    ZPL_LOG_LEVEL_NAME = ZPL_BIT(1),
+    ZPL_LOG_LOCATION   = ZPL_BIT(2), // file:line of the call site
+    ZPL_LOG_BLOCK      = ZPL_BIT(3), // wait for ring space instead of dropping the record
+
+    ZPL_LOG_DEFAULT = ZPL_LOG_TIMESTAMP | ZPL_LOG_LEVEL_NAME,
+} zpl_log_flags;
+
+/* static per call site, set up by the ZPL_LOG_* macros */
+typedef struct zpl_log_site {
+    zpl_u8       level;
+    char const  *file;
+    zpl_i32      line;
+    zpl_atomic32 state; // 0 until the format is compiled, 1 once it is, 2 if it holds too many conversions
+    zpl_fmt      plan;
+} zpl_log_site;
+
+typedef struct zpl_log_stats {
+    zpl_i64 records; // written out
+    zpl_i64 dropped; // lost to a full ring, an oversized record or no free ring
+    zpl_i64 blocked; // times a producer had to wait for space (ZPL_LOG_BLOCK)
+    zpl_i64 bytes;   // written to the file
+    zpl_i64 writes;  // zpl_file_write calls
+} zpl_log_stats;
+
+struct zpl__log_ring;
+
+typedef struct zpl_logger {
+    zpl_allocator alloc;
+    zpl_file     *file;
+    zpl_u32       flags;
+    zpl_u32       id;
+    zpl_atomic32  level;
+
+    zpl_thread    flusher;
+    zpl_atomic32  running;
+    zpl_atomic64  flush_requested;
+    zpl_atomic64  flush_done;
+    char         *batch;
+
+    zpl_mutex             lock; // guards ring registration
+    zpl_atomic32          ring_count;
+    struct zpl__log_ring *rings[ZPL_LOG_MAX_THREADS];
+
+    zpl_atomic64 records, dropped, blocked, bytes, writes;
+} zpl_logger;
+
+/**
+ * Starts a logger writing to file, the file has to stay open until zpl_logger_free
+ * @param  logger
+ * @param  a      allocator for the rings and the batch buffer, has to be thread-safe
+ * @param  file
+ * @param  flags  zpl_log_flags
+ */
+ZPL_DEF void zpl_logger_init(zpl_logger *logger, zpl_allocator a, zpl_file *file, zpl_u32 flags);
+
+//! Writes out all pending records, stops the flusher and releases the rings.
+ZPL_DEF void zpl_logger_free(zpl_logger *logger);
+
+//! Blocks until every record logged before the call is written to the file.
+ZPL_DEF void zpl_logger_flush(zpl_logger *logger);
+
+//! Sets the runtime level filter, records below ZPL_LOG_MIN_LEVEL are removed at compile time regardless.
+ZPL_DEF void zpl_logger_set_level(zpl_logger *logger, zpl_log_level level);
+
+ZPL_DEF void zpl_logger_stats(zpl_logger *logger, zpl_log_stats *stats);
+
+ZPL_DEF char const *zpl_log_level_name(zpl_log_level level);
+
+/**
+ * Captures a record for the site, usually called through the ZPL_LOG_* macros
+ * @param  fmt  has to outlive the logger and stay the same for every call on the site
+ * @return false if the record was filtered out or dropped
+ */
+ZPL_DEF zpl_b32 zpl_log_write(zpl_logger *logger, zpl_log_site *site, char const *fmt, ...);
+ZPL_DEF zpl_b32 zpl_log_write_va(zpl_logger *logger, zpl_log_site *site, char const *fmt, va_list va);
+
+#define ZPL__LOG(logger, lvl, ...) do { \
+        if ((lvl) >= ZPL_LOG_MIN_LEVEL) { \
+            zpl_local_persist zpl_log_site zpl__log_site = { (lvl), __FILE__, __LINE__ }; \
+            zpl_log_write((logger), &zpl__log_site, "" __VA_ARGS__); /* the format has to be a literal */ \
+        } \
+    } while (0)
+
+#define ZPL_LOG_TRACE(logger, ...) ZPL__LOG(logger, ZPL_LOG_LEVEL_TRACE, __VA_ARGS__)
+#define ZPL_LOG_DEBUG(logger, ...) ZPL__LOG(logger, ZPL_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define ZPL_LOG_INFO(logger, ...)  ZPL__LOG(logger, ZPL_LOG_LEVEL_INFO, __VA_ARGS__)
+#define ZPL_LOG_WARN(logger, ...)  ZPL__LOG(logger, ZPL_LOG_LEVEL_WARN, __VA_ARGS__)
+#define ZPL_LOG_ERROR(logger, ...) ZPL__LOG(logger, ZPL_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define ZPL_LOG_FATAL(logger, ...) ZPL__LOG(logger, ZPL_LOG_LEVEL_FATAL, __VA_ARGS__)
+
+ZPL_END_C_DECLS
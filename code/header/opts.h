@@ -26,7 +26,7 @@ typedef struct {
 
     //! values
     union {
-        zpl_string text;
+        zpl_string_sso text; // short values stay inline
         zpl_i64 integer;
         zpl_f64 real;
     };
@@ -104,6 +104,7 @@ ZPL_DEF void zpl_opts_print_errors(zpl_opts *opts);
 //! @param opts
 //! @param name Name of an option.
 //! @param fallback Fallback string we return if option wasn't found.
+//! @return The value, owned by the parser and valid until zpl_opts_free. It is not a zpl_string header.
 ZPL_DEF zpl_string zpl_opts_string(zpl_opts *opts, char const *name, char const *fallback);
 
 //! Fetches a real number from an option.
@@ -3,30 +3,91 @@
 
 ZPL_BEGIN_C_DECLS
 
+/* inputs shorter than this per thread are parsed sequentially by zpl_csv_parse_parallel */
+#ifndef ZPL_CSV_PARALLEL_MIN_CHUNK
+#define ZPL_CSV_PARALLEL_MIN_CHUNK (64 * 1024)
+#endif
+
 typedef enum zpl_csv_error {
     ZPL_CSV_ERROR_NONE,
     ZPL_CSV_ERROR_INTERNAL,
     ZPL_CSV_ERROR_UNEXPECTED_END_OF_INPUT,
     ZPL_CSV_ERROR_MISMATCHED_ROWS,
+    ZPL_CSV_ERROR_OUT_OF_MEMORY,
 } zpl_csv_error;
 
 typedef zpl_adt_node zpl_csv_object;
 
+typedef enum zpl_csv_column_type {
+    ZPL_CSV_COLUMN_EMPTY,
+    ZPL_CSV_COLUMN_INTEGER,
+    ZPL_CSV_COLUMN_REAL,
+    ZPL_CSV_COLUMN_STRING,
+} zpl_csv_column_type;
+
+typedef struct zpl_csv_column {
+    char const *name;
+    zpl_u8 type;
+    zpl_u8 *empty;              ///< bitmap of empty cells, NULL when the column has none
+    union {
+        zpl_i64 *integers;
+        zpl_f64 *reals;
+        zpl_isize *strings;     ///< offsets into zpl_csv_table.strings
+    };
+} zpl_csv_column;
+
+/* columnar parse result, every column is a contiguous array of its inferred type */
+typedef struct zpl_csv_table {
+    zpl_allocator allocator;
+    zpl_isize row_count;
+    zpl_isize column_count;
+    zpl_csv_column *columns;
+    char *strings;              ///< string heap holding names and string cells
+    zpl_isize strings_size;
+} zpl_csv_table;
+
 ZPL_DEF_INLINE zpl_u8 zpl_csv_parse(zpl_csv_object *root, char *text, zpl_allocator allocator, zpl_b32 has_header);
 ZPL_DEF zpl_u8 zpl_csv_parse_delimiter(zpl_csv_object *root, char *text, zpl_allocator allocator, zpl_b32 has_header, char delim);
 ZPL_DEF void zpl_csv_free(zpl_csv_object *obj);
 
+/* splits the input at row boundaries and parses the chunks on a job system, thread_count = 0 uses all hardware threads.
+   the allocator is used from several threads at once and has to be thread-safe (e.g. zpl_heap()).
+   quotes are only recognised at the start of a field, as in sequential parsing, so stray quotes inside unquoted fields are not supported. */
+ZPL_DEF zpl_u8 zpl_csv_parse_parallel(zpl_csv_object *root, char *text, zpl_allocator allocator, zpl_b32 has_header, char delim, zpl_u32 thread_count);
+
+/* parses into typed columns instead of a node tree, the text is left untouched and not referenced afterwards.
+   a column is an integer column when all its non-empty cells are decimal integers, a real column when they are all numbers,
+   otherwise a string column. quoted cells are always strings. */
+ZPL_DEF zpl_u8 zpl_csv_parse_table(zpl_csv_table *table, char const *text, zpl_allocator allocator, zpl_b32 has_header, char delim);
+ZPL_DEF void zpl_csv_table_free(zpl_csv_table *table);
+ZPL_DEF_INLINE zpl_b32 zpl_csv_table_is_empty(zpl_csv_table *table, zpl_isize column, zpl_isize row);
+ZPL_DEF_INLINE char const *zpl_csv_table_string(zpl_csv_table *table, zpl_isize column, zpl_isize row);
+
 ZPL_DEF_INLINE void zpl_csv_write(zpl_file *file, zpl_csv_object *obj);
 ZPL_DEF_INLINE zpl_string zpl_csv_write_string(zpl_allocator a, zpl_csv_object *obj);
 ZPL_DEF void zpl_csv_write_delimiter(zpl_file *file, zpl_csv_object *obj, char delim);
 ZPL_DEF zpl_string zpl_csv_write_string_delimiter(zpl_allocator a, zpl_csv_object *obj, char delim);
 
+/* appends to an existing string and grows it as needed, clear it with zpl_string_clear to reuse its capacity */
+ZPL_DEF_INLINE zpl_b8 zpl_csv_write_append(zpl_string *str, zpl_csv_object *obj);
+ZPL_DEF zpl_b8 zpl_csv_write_append_delimiter(zpl_string *str, zpl_csv_object *obj, char delim);
+
 /* inline */
 
 ZPL_IMPL_INLINE zpl_u8 zpl_csv_parse(zpl_csv_object *root, char *text, zpl_allocator allocator, zpl_b32 has_header) {
     return zpl_csv_parse_delimiter(root, text, allocator, has_header, ',');
 }
 
+ZPL_IMPL_INLINE zpl_b32 zpl_csv_table_is_empty(zpl_csv_table *table, zpl_isize column, zpl_isize row) {
+    zpl_csv_column *col = table->columns + column;
+    return col->type == ZPL_CSV_COLUMN_EMPTY || (col->empty && (col->empty[row >> 3] & (1 << (row & 7))));
+}
+
+ZPL_IMPL_INLINE char const *zpl_csv_table_string(zpl_csv_table *table, zpl_isize column, zpl_isize row) {
+    ZPL_ASSERT(table->columns[column].type == ZPL_CSV_COLUMN_STRING);
+    return table->strings + table->columns[column].strings[row];
+}
+
 ZPL_IMPL_INLINE void zpl_csv_write(zpl_file *file, zpl_csv_object *obj) {
     zpl_csv_write_delimiter(file, obj, ',');
 }
@@ -35,5 +96,9 @@ ZPL_IMPL_INLINE zpl_string zpl_csv_write_string(zpl_allocator a, zpl_csv_object
     return zpl_csv_write_string_delimiter(a, obj, ',');
 }
 
+ZPL_IMPL_INLINE zpl_b8 zpl_csv_write_append(zpl_string *str, zpl_csv_object *obj) {
+    return zpl_csv_write_append_delimiter(str, obj, ',');
+}
+
 
 ZPL_END_C_DECLS
@@ -13,13 +13,22 @@ typedef enum zpl_json_error {
     ZPL_JSON_ERROR_ARRAY_LEFT_OPEN,
     ZPL_JSON_ERROR_OBJECT_END_PAIR_MISMATCHED,
     ZPL_JSON_ERROR_OUT_OF_MEMORY,
+    ZPL_JSON_ERROR_INVALID_UTF8,
 } zpl_json_error;
 
+typedef enum zpl_json_parse_flags {
+    ZPL_JSON_PARSE_VALIDATE_UTF8 = ZPL_BIT(0), // reject text that isn't well-formed UTF-8 before parsing
+} zpl_json_parse_flags;
+
 typedef zpl_adt_node zpl_json_object;
 
 ZPL_DEF zpl_u8 zpl_json_parse(zpl_json_object *root, char *text, zpl_allocator allocator);
+ZPL_DEF zpl_u8 zpl_json_parse_ex(zpl_json_object *root, char *text, zpl_allocator allocator, zpl_u32 flags);
 ZPL_DEF void zpl_json_free(zpl_json_object *obj);
 ZPL_DEF zpl_b8 zpl_json_write(zpl_file *file, zpl_json_object *obj, zpl_isize indent);
 ZPL_DEF zpl_string zpl_json_write_string(zpl_allocator a, zpl_json_object *obj, zpl_isize indent);
 
+/* appends to an existing string and grows it as needed, clear it with zpl_string_clear to reuse its capacity */
+ZPL_DEF zpl_b8 zpl_json_write_append(zpl_string *str, zpl_json_object *obj, zpl_isize indent);
+
 ZPL_END_C_DECLS
@@ -87,4 +87,67 @@ ZPL_DEF zpl_b32         zpl_re_match(zpl_re *re, char const *str, zpl_isize str_
 //! Match all occurences in an input string and output them into captures. Array of captures is allocated on the heap and needs to be freed afterwards.
 ZPL_DEF zpl_b32         zpl_re_match_all(zpl_re *re, char const *str, zpl_isize str_len, zpl_isize max_capture_count, zpl_re_capture **out_captures);
 
+/* Multi-pattern literal matcher
+
+   Compiles a set of literal needles into an Aho-Corasick automaton over byte classes, so the input
+   is scanned once regardless of the number of patterns. Whenever the automaton sits at its root,
+   the scan jumps ahead with a vectorized search for the first two bytes of the patterns (or the first
+   one if some pattern is a single byte), provided there are at most ZPL_STRMATCH_PREFILTER_MAX distinct
+   of them. Both cases count when ignoring case.
+   Input can be fed in pieces, matches spanning buffer boundaries are reported as well. */
+
+#ifndef ZPL_STRMATCH_PREFILTER_MAX
+#define ZPL_STRMATCH_PREFILTER_MAX 8
+#endif
+
+typedef enum zpl_strmatch_flags {
+    ZPL_STRMATCH_IGNORE_CASE = ZPL_BIT(0), // ASCII letters only
+} zpl_strmatch_flags;
+
+typedef struct zpl_strmatch_hit {
+    zpl_isize pattern; // index into the compiled pattern list
+    zpl_i64   offset;  // start of the match, counted from the first byte fed since the last reset
+    zpl_isize len;
+} zpl_strmatch_hit;
+
+//! Return false to stop the scan.
+typedef zpl_b32 (*zpl_strmatch_proc)(zpl_strmatch_hit const *hit, void *user_data);
+
+typedef struct zpl_strmatch {
+    zpl_allocator backing;
+    zpl_u32 flags;
+    zpl_isize pattern_count;
+    zpl_isize *lengths;
+
+    zpl_u8 classes[256];
+    zpl_isize class_count;
+    zpl_isize state_count;
+    zpl_u32 *delta;     // state_count * class_count transitions, premultiplied by class_count
+    zpl_u32 *out_start; // matches ending in state i are out[out_start[i]..out_start[i+1]]
+    zpl_u32 *out;
+
+    zpl_u8 prefilter[ZPL_STRMATCH_PREFILTER_MAX];
+    zpl_u8 prefilter_next[ZPL_STRMATCH_PREFILTER_MAX];
+    zpl_isize prefilter_len;  // 0 when patterns start with too many distinct bytes
+    zpl_b32 prefilter_pairs; // prefilter_next holds the second bytes
+
+    zpl_u32 state;
+    zpl_i64 consumed;
+} zpl_strmatch;
+
+//! Compile the pattern set, empty patterns are not allowed. Returns false on invalid input or allocation failure.
+ZPL_DEF zpl_b32   zpl_strmatch_compile(zpl_strmatch *m, zpl_allocator backing, zpl_strview const *patterns, zpl_isize count, zpl_u32 flags);
+
+//! Destroy the matcher.
+ZPL_DEF void      zpl_strmatch_destroy(zpl_strmatch *m);
+
+//! Find the match ending first within str, the longest pattern wins ties. Doesn't touch the streaming state.
+ZPL_DEF zpl_b32   zpl_strmatch_find(zpl_strmatch *m, char const *str, zpl_isize str_len, zpl_strmatch_hit *hit);
+
+//! Scan the next piece of a stream and report every match, overlapping ones included. Returns false if the callback stopped the scan.
+ZPL_DEF zpl_b32   zpl_strmatch_feed(zpl_strmatch *m, void const *data, zpl_isize len, zpl_strmatch_proc proc, void *user_data);
+
+//! Start a new stream.
+ZPL_DEF void      zpl_strmatch_reset(zpl_strmatch *m);
+
 ZPL_END_C_DECLS
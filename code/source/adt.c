@@ -2,10 +2,17 @@
 
 ZPL_BEGIN_C_DECLS
 
-#define zpl__adt_fprintf(s_, fmt_, ...)                                                                                \
-do {                                                                                                               \
-    if (zpl_fprintf(s_, fmt_, ##__VA_ARGS__) < 0) return ZPL_ADT_ERROR_OUT_OF_MEMORY;                              \
-} while (0)
+/* Output sink shared by the serialisers. It either appends to a growable string, which is then
+ * handed out as-is, or stages bytes in a fixed buffer that is flushed to a file in large chunks. */
+typedef struct {
+    zpl_file   *file;
+    zpl_string *str;
+    char       *data;
+    zpl_isize   len, cap;
+    zpl_b32     failed;
+} zpl__adt_writer;
+
+#define zpl__adt_write_lit(w, lit) zpl__adt_write((w), (lit), zpl_size_of(lit) - 1)
 
 zpl_u8 zpl_adt_make_branch(zpl_adt_node *node, zpl_allocator backing, char const *name, zpl_b32 is_array) {
     zpl_u8 type = ZPL_ADT_TYPE_OBJECT;
@@ -43,19 +50,23 @@ zpl_u8 zpl_adt_make_leaf(zpl_adt_node *node, char const *name, zpl_u8 type) {
 }
 
 zpl_adt_node *zpl_adt_find(zpl_adt_node *node, char const *name, zpl_b32 deep_search) {
+    return zpl_adt_find_view(node, zpl_strview_from_cstr(name), deep_search);
+}
+
+zpl_adt_node *zpl_adt_find_view(zpl_adt_node *node, zpl_strview name, zpl_b32 deep_search) {
     if (node->type != ZPL_ADT_TYPE_OBJECT) {
         return NULL;
     }
 
     for (zpl_isize i = 0; i < zpl_array_count(node->nodes); i++) {
-        if (!zpl_strcmp(node->nodes[i].name, name)) {
+        if (node->nodes[i].name && zpl_strview_equals_cstr(name, node->nodes[i].name)) {
             return (node->nodes + i);
         }
     }
 
     if (deep_search) {
         for (zpl_isize i = 0; i < zpl_array_count(node->nodes); i++) {
-            zpl_adt_node *res = zpl_adt_find(node->nodes + i, name, deep_search);
+            zpl_adt_node *res = zpl_adt_find_view(node->nodes + i, name, deep_search);
 
             if (res != NULL)
                 return res;
@@ -135,10 +146,11 @@ zpl_adt_node *zpl_adt_query(zpl_adt_node *node, char const *uri) {
 
     b = p;
     p = e = (char*)zpl_str_skip(p, '/');
-    char *buf = zpl_bprintf("%.*s", (int)(e - b), b);
 
     /* handle field value lookup */
     if (*b == '[') {
+        /* the segment gets split in place, work on a copy */
+        char *buf = zpl_bprintf("%.*s", (int)(e - b), b);
         char *l_p=buf+1,*l_b=l_p,*l_e=l_p,*l_b2=l_p,*l_e2=l_p;
         l_e = (char*)zpl_str_skip(l_p, '=');
         l_e2 = (char*)zpl_str_skip(l_p, ']');
@@ -193,7 +205,7 @@ zpl_adt_node *zpl_adt_query(zpl_adt_node *node, char const *uri) {
     }
     /* handle field name lookup */
     else if (node->type == ZPL_ADT_TYPE_OBJECT) {
-        found_node = zpl_adt_find(node, buf, false);
+        found_node = zpl_adt_find_view(node, zpl_strview_make(b, e - b), false);
 
         /* go deeper if uri continues */
         if (*e) {
@@ -202,7 +214,7 @@ zpl_adt_node *zpl_adt_query(zpl_adt_node *node, char const *uri) {
     }
     /* handle array index lookup */
     else {
-        zpl_isize idx = (zpl_isize)zpl_str_to_i64(buf, NULL, 10);
+        zpl_isize idx = (zpl_isize)zpl_str_to_i64(b, NULL, 10);
         if (idx >= 0 && idx < zpl_array_count(node->nodes)) {
             found_node = &node->nodes[idx];
 
@@ -359,7 +371,7 @@ char *zpl_adt_parse_number(zpl_adt_node *node, char* base_str) {
     zpl_i32 base=0;
     zpl_i32 base2=0;
     zpl_u8 base2_offset=0;
-    zpl_i8 exp=0,orig_exp=0;
+    zpl_i32 exp=0;
     zpl_u8 neg_zero=0;
     zpl_u8 lead_digit=0;
     zpl_u8 node_type=0;
@@ -375,24 +387,32 @@ char *zpl_adt_parse_number(zpl_adt_node *node, char* base_str) {
 
     zpl_isize ib = 0;
     char buf[48] = { 0 };
+    /* digits past the buffer are dropped, the value itself is parsed from the original text.
+       Two NULs always remain, the analysis below may step over the first one. */
+#define zpl__adt_buf_put(c) do { if (ib < zpl_size_of(buf) - 2) buf[ib++] = (c); } while (0)
 
     if (*e == '+')
         ++e;
     else if (*e == '-') {
-        buf[ib++] = *e++;
+        zpl__adt_buf_put(*e); ++e;
     }
 
     if (*e == '.') {
         node_type = ZPL_ADT_TYPE_REAL;
         node_props = ZPL_ADT_PROPS_IS_PARSED_REAL;
         lead_digit = false;
-        buf[ib++] = '0';
+        zpl__adt_buf_put('0');
         do {
-            buf[ib++] = *e;
+            zpl__adt_buf_put(*e);
         } while (zpl_char_is_digit(*++e));
     } else {
-        if (!zpl_strncmp(e, "0x", 2) || !zpl_strncmp(e, "0X", 2)) { node_props = ZPL_ADT_PROPS_IS_HEX; }
-        while (zpl_char_is_hex_digit(*e) || zpl_char_to_lower(*e) == 'x') { buf[ib++] = *e++; }
+        if (!zpl_strncmp(e, "0x", 2) || !zpl_strncmp(e, "0X", 2)) {
+            node_props = ZPL_ADT_PROPS_IS_HEX;
+            while (zpl_char_is_hex_digit(*e) || zpl_char_to_lower(*e) == 'x') { zpl__adt_buf_put(*e); ++e; }
+        } else {
+            /* decimal digits only, so that an exponent is not mistaken for a hex digit */
+            while (zpl_char_is_digit(*e)) { zpl__adt_buf_put(*e); ++e; }
+        }
 
         if (*e == '.') {
             node_type = ZPL_ADT_TYPE_REAL;
@@ -400,13 +420,14 @@ char *zpl_adt_parse_number(zpl_adt_node *node, char* base_str) {
             zpl_u32 step = 0;
 
             do {
-                buf[ib++] = *e;
+                zpl__adt_buf_put(*e);
                 ++step;
             } while (zpl_char_is_digit(*++e));
 
-            if (step < 2) { buf[ib++] = '0'; }
+            if (step < 2) { zpl__adt_buf_put('0'); }
         }
     }
+#undef zpl__adt_buf_put
 
     /* check if we have a dot here, this is a false positive (IP address, ...) */
     if (*e == '.') {
@@ -414,18 +435,20 @@ char *zpl_adt_parse_number(zpl_adt_node *node, char* base_str) {
     }
 
     zpl_f32 eb = 10;
-    char expbuf[6] = { 0 };
-    zpl_isize expi = 0;
 
     if (*e && !!zpl_strchr("eE", *e)) {
         ++e;
         if (*e == '+' || *e == '-' || zpl_char_is_digit(*e)) {
             if (*e == '-') { eb = 0.1f; }
             if (!zpl_char_is_digit(*e)) { ++e; }
-            while (zpl_char_is_digit(*e)) { expbuf[expi++] = *e++; }
+            /* saturated, anything this large is out of range for both integers and reals */
+            while (zpl_char_is_digit(*e)) { if (exp < 100000) exp = exp * 10 + (*e - '0'); ++e; }
         }
 
-        orig_exp = exp = (zpl_u8)zpl_str_to_i64(expbuf, NULL, 10);
+        /* a negative exponent turns an integer into a fraction */
+        if (node_type == ZPL_ADT_TYPE_INTEGER && eb != 10 && !node_props) {
+            node_type = ZPL_ADT_TYPE_REAL;
+        }
     }
 
     if (node_type == ZPL_ADT_TYPE_INTEGER) {
@@ -436,9 +459,19 @@ char *zpl_adt_parse_number(zpl_adt_node *node, char* base_str) {
             neg_zero = true;
         }
 #endif
-        while (orig_exp-- > 0) { node->integer *= (zpl_i64)eb; }
-    } else {
-        node->real = zpl_str_to_f64(buf, 0);
+        /* scale while the value fits, larger ones are parsed as reals */
+        for (zpl_i32 i = 0; i < exp && node->integer != 0; i++) {
+            if (node->integer > ZPL_I64_MAX / 10 || node->integer < ZPL_I64_MIN / 10) {
+                node_type = ZPL_ADT_TYPE_REAL;
+                break;
+            }
+            node->integer *= 10;
+        }
+    }
+
+    if (node_type == ZPL_ADT_TYPE_REAL) {
+        /* parse the original text, exponent included, so that the value is correctly rounded */
+        node->real = zpl_str_to_f64(base_str, 0);
 
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
         char *q = buf, *base_string = q, *base_string2 = q;
@@ -460,7 +493,6 @@ char *zpl_adt_parse_number(zpl_adt_node *node, char* base_str) {
             neg_zero = true;
         }
 #endif
-        while (orig_exp-- > 0) { node->real *= eb; }
     }
 
     node->type = node_type;
@@ -484,82 +516,192 @@ char *zpl_adt_parse_number(zpl_adt_node *node, char* base_str) {
     return e;
 }
 
-zpl_adt_error zpl_adt_print_number(zpl_file *file, zpl_adt_node *node) {
-    ZPL_ASSERT_NOT_NULL(file);
-    ZPL_ASSERT_NOT_NULL(node);
-    if (node->type != ZPL_ADT_TYPE_INTEGER && node->type != ZPL_ADT_TYPE_REAL) {
-        return ZPL_ADT_ERROR_INVALID_TYPE;
+/* serialisation */
+
+zpl_internal zpl_b32 zpl__adt_writer_flush(zpl__adt_writer *w) {
+    if (w->file) {
+        if (w->len > 0 && !zpl_file_write(w->file, w->data, w->len)) w->failed = true;
+        w->len = 0;
+    } else {
+        zpl__set_string_length(*w->str, w->len);
+        w->data[w->len] = '\0';
     }
+    return !w->failed;
+}
+
+zpl_internal void zpl__adt_writer_init_file(zpl__adt_writer *w, zpl_file *file, char *buf, zpl_isize cap) {
+    zpl_zero_item(w);
+    w->file = file;
+    w->data = buf;
+    w->cap  = cap;
+}
+
+zpl_internal void zpl__adt_writer_init_string(zpl__adt_writer *w, zpl_string *str) {
+    zpl_zero_item(w);
+    w->str  = str;
+    w->data = *str;
+    w->len  = zpl_string_length(*str);
+    w->cap  = zpl_string_capacity(*str);
+}
+
+zpl_internal ZPL_NEVER_INLINE void zpl__adt_write_slow(zpl__adt_writer *w, void const *ptr, zpl_isize len) {
+    if (w->failed) return;
+
+    if (w->file) {
+        if (!zpl__adt_writer_flush(w)) return;
+
+        /* larger than the whole staging buffer, hand it over as-is */
+        if (len > w->cap) {
+            if (!zpl_file_write(w->file, ptr, len)) w->failed = true;
+            return;
+        }
+    } else {
+        /* grow geometrically, the string itself only ever grows by the requested amount */
+        zpl_string str;
+        zpl__set_string_length(*w->str, w->len);
+        str = zpl_string_make_space_for(*w->str, zpl_max(len, w->cap));
+        if (!str) {
+            w->failed = true;
+            return;
+        }
+        *w->str = str;
+        w->data = str;
+        w->cap  = zpl_string_capacity(str);
+    }
+
+    zpl_memcopy(w->data + w->len, ptr, len);
+    w->len += len;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE void zpl__adt_write(zpl__adt_writer *w, void const *ptr, zpl_isize len) {
+    if (w->cap - w->len < len) {
+        zpl__adt_write_slow(w, ptr, len);
+        return;
+    }
+    zpl_memcopy(w->data + w->len, ptr, len);
+    w->len += len;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE void zpl__adt_write_char(zpl__adt_writer *w, char c) {
+    if (w->len < w->cap) {
+        w->data[w->len++] = c;
+        return;
+    }
+    zpl__adt_write_slow(w, &c, 1);
+}
+
+zpl_internal void zpl__adt_write_repeat(zpl__adt_writer *w, char c, zpl_isize count) {
+    while (count-- > 0) zpl__adt_write_char(w, c);
+}
+
+zpl_internal void zpl__adt_write_number(zpl__adt_writer *w, zpl_adt_node *node) {
+    char buf[40], *p = buf;
 
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
     if (node->neg_zero) {
-        zpl__adt_fprintf(file, "-");
+        zpl__adt_write_char(w, '-');
     }
 #endif
 
     switch (node->type) {
         case ZPL_ADT_TYPE_INTEGER: {
             if (node->props == ZPL_ADT_PROPS_IS_HEX) {
-                zpl__adt_fprintf(file, "0x%llx", (long long)node->integer);
+                zpl__adt_write_lit(w, "0x");
+                zpl_u64_to_str(cast(zpl_u64) node->integer, buf, 16);
+                zpl_str_to_lower(buf);
             } else {
-                zpl__adt_fprintf(file, "%lld", (long long)node->integer);
+                zpl_i64_to_str(node->integer, buf, 10);
             }
+            zpl__adt_write(w, buf, zpl_strlen(buf));
         } break;
 
         case ZPL_ADT_TYPE_REAL: {
             if (node->props == ZPL_ADT_PROPS_NAN) {
-                zpl__adt_fprintf(file, "NaN");
+                zpl__adt_write_lit(w, "NaN");
             } else if (node->props == ZPL_ADT_PROPS_NAN_NEG) {
-                zpl__adt_fprintf(file, "-NaN");
+                zpl__adt_write_lit(w, "-NaN");
             } else if (node->props == ZPL_ADT_PROPS_INFINITY) {
-                zpl__adt_fprintf(file, "Infinity");
+                zpl__adt_write_lit(w, "Infinity");
             } else if (node->props == ZPL_ADT_PROPS_INFINITY_NEG) {
-                zpl__adt_fprintf(file, "-Infinity");
+                zpl__adt_write_lit(w, "-Infinity");
             } else if (node->props == ZPL_ADT_PROPS_TRUE) {
-                zpl__adt_fprintf(file, "true");
+                zpl__adt_write_lit(w, "true");
             } else if (node->props == ZPL_ADT_PROPS_FALSE) {
-                zpl__adt_fprintf(file, "false");
+                zpl__adt_write_lit(w, "false");
             } else if (node->props == ZPL_ADT_PROPS_NULL) {
-                zpl__adt_fprintf(file, "null");
+                zpl__adt_write_lit(w, "null");
+            } else {
+                /* shortest digits that parse back to the same value */
+                char *e;
+                zpl_isize len = zpl__f64_to_str(node->real, buf, node->props == ZPL_ADT_PROPS_IS_EXP);
+
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
-            } else if (node->props == ZPL_ADT_PROPS_IS_EXP) {
-                zpl__adt_fprintf(file, "%lld.%0*d%llde%lld", (long long)node->base, node->base2_offset, 0, (long long)node->base2, (long long)node->exp);
-            } else if (node->props == ZPL_ADT_PROPS_IS_PARSED_REAL) {
-                if (!node->lead_digit)
-                    zpl__adt_fprintf(file, ".%0*d%lld", node->base2_offset, 0, (long long)node->base2);
-                else
-                    zpl__adt_fprintf(file, "%lld.%0*d%lld", (long long int)node->base2_offset, 0, (int)node->base, (long long)node->base2);
+                if (node->neg_zero && *p == '-') ++p, --len;
+                if (node->props == ZPL_ADT_PROPS_IS_PARSED_REAL && !node->lead_digit) {
+                    if (p[0] == '0' && p[1] == '.') ++p, --len;
+                    else if (p[0] == '-' && p[1] == '0' && p[2] == '.') *++p = '-', --len;
+                }
 #endif
-            } else {
-                zpl__adt_fprintf(file, "%f", node->real);
+
+                /* keep a fraction so that the value is read back as a real number */
+                if (!zpl_memchr(p, '.', len) && !zpl_memchr(p, 'n', len)) {
+                    e = cast(char *) zpl_memchr(p, 'e', len);
+                    if (!e) e = p + len;
+                    zpl_memmove(e + 2, e, (p + len) - e);
+                    e[0] = '.';
+                    e[1] = '0';
+                    len += 2;
+                }
+
+                zpl__adt_write(w, p, len);
             }
         } break;
     }
-
-    return ZPL_ADT_ERROR_NONE;
 }
 
-zpl_adt_error zpl_adt_print_string(zpl_file *file, zpl_adt_node *node, char const *escaped_chars, char const *escape_symbol) {
-    ZPL_ASSERT_NOT_NULL(file);
-    ZPL_ASSERT_NOT_NULL(node);
-    ZPL_ASSERT_NOT_NULL(escaped_chars);
-    if (node->type != ZPL_ADT_TYPE_STRING && node->type != ZPL_ADT_TYPE_MULTISTRING) {
-        return ZPL_ADT_ERROR_INVALID_TYPE;
-    }
-
+zpl_internal void zpl__adt_write_string(zpl__adt_writer *w, zpl_adt_node *node, char const *escaped_chars, char const *escape_symbol) {
     /* escape string */
     char const* p = node->string, *b = p;
+    zpl_isize escape_len = zpl_strlen(escape_symbol);
     do {
         p = zpl_str_skip_any(p, escaped_chars);
-        zpl__adt_fprintf(file, "%.*s", zpl_ptr_diff(b, p), b);
+        zpl__adt_write(w, b, zpl_ptr_diff(b, p));
         if (*p && !!zpl_strchr(escaped_chars, *p)) {
-            zpl__adt_fprintf(file, "%s%c", escape_symbol, *p);
+            zpl__adt_write(w, escape_symbol, escape_len);
+            zpl__adt_write_char(w, *p);
             p++;
         }
         b = p;
     } while (*p);
+}
 
-    return ZPL_ADT_ERROR_NONE;
+zpl_adt_error zpl_adt_print_number(zpl_file *file, zpl_adt_node *node) {
+    zpl__adt_writer w;
+    char buf[64];
+    ZPL_ASSERT_NOT_NULL(file);
+    ZPL_ASSERT_NOT_NULL(node);
+    if (node->type != ZPL_ADT_TYPE_INTEGER && node->type != ZPL_ADT_TYPE_REAL) {
+        return ZPL_ADT_ERROR_INVALID_TYPE;
+    }
+
+    zpl__adt_writer_init_file(&w, file, buf, zpl_size_of(buf));
+    zpl__adt_write_number(&w, node);
+    return zpl__adt_writer_flush(&w) ? ZPL_ADT_ERROR_NONE : ZPL_ADT_ERROR_OUT_OF_MEMORY;
+}
+
+zpl_adt_error zpl_adt_print_string(zpl_file *file, zpl_adt_node *node, char const *escaped_chars, char const *escape_symbol) {
+    zpl__adt_writer w;
+    char buf[ZPL_ADT_WRITER_BUFFER_SIZE];
+    ZPL_ASSERT_NOT_NULL(file);
+    ZPL_ASSERT_NOT_NULL(node);
+    ZPL_ASSERT_NOT_NULL(escaped_chars);
+    if (node->type != ZPL_ADT_TYPE_STRING && node->type != ZPL_ADT_TYPE_MULTISTRING) {
+        return ZPL_ADT_ERROR_INVALID_TYPE;
+    }
+
+    zpl__adt_writer_init_file(&w, file, buf, zpl_size_of(buf));
+    zpl__adt_write_string(&w, node, escaped_chars, escape_symbol);
+    return zpl__adt_writer_flush(&w) ? ZPL_ADT_ERROR_NONE : ZPL_ADT_ERROR_OUT_OF_MEMORY;
 }
 
 zpl_adt_error zpl_adt_str_to_number(zpl_adt_node *node) {
@@ -575,6 +717,4 @@ zpl_adt_error zpl_adt_str_to_number(zpl_adt_node *node) {
     return ZPL_ADT_ERROR_NONE;
 }
 
-#undef zpl__adt_fprintf
-
 ZPL_END_C_DECLS
@@ -158,6 +158,7 @@ ZPL_BEGIN_C_DECLS
 
 #else // POSIX
 #    include <fcntl.h>
+#    include <sys/uio.h>
 
     zpl_internal ZPL_FILE_SEEK_PROC(zpl__posix_file_seek) {
 #    if defined(ZPL_SYSTEM_OSX)
@@ -198,6 +199,40 @@ ZPL_BEGIN_C_DECLS
     zpl_file_operations const zpl_default_file_operations = { zpl__posix_file_read, zpl__posix_file_write,
         zpl__posix_file_seek, zpl__posix_file_close };
 
+#    ifndef ZPL__FILE_WRITEV_BATCH
+#    define ZPL__FILE_WRITEV_BATCH 64
+#    endif
+
+    zpl_internal zpl_b32 zpl__posix_file_writev(zpl_file_descriptor fd, zpl_file_iovec const *iov, zpl_isize count) {
+        struct iovec batch[ZPL__FILE_WRITEV_BATCH];
+        zpl_isize skip = 0; // bytes of iov[0] already written by a short writev
+
+        while (count > 0) {
+            zpl_isize n = zpl_min(count, ZPL__FILE_WRITEV_BATCH);
+            zpl_isize total = -skip, res;
+            for (zpl_isize i = 0; i < n; i++) {
+                batch[i].iov_base = cast(void *)iov[i].data;
+                batch[i].iov_len  = cast(size_t)iov[i].size;
+                total += iov[i].size;
+            }
+            batch[0].iov_base = cast(zpl_u8 *)batch[0].iov_base + skip;
+            batch[0].iov_len -= cast(size_t)skip;
+
+            res = (total > 0) ? writev(cast(int)fd.i, batch, cast(int)n) : 0;
+            if (res < 0 && errno == EINTR) continue;
+            if (res < 0 || (res == 0 && total > 0)) return false;
+
+            res += skip;
+            while (count > 0 && res >= iov->size) {
+                res -= iov->size;
+                iov++, count--;
+                if (--n == 0) break;
+            }
+            skip = res;
+        }
+        return true;
+    }
+
     ZPL_NEVER_INLINE ZPL_FILE_OPEN_PROC(zpl__posix_file_open) {
         zpl_i32 os_mode;
         switch (mode & ZPL_FILE_MODES) {
@@ -423,6 +458,25 @@ zpl_file_error zpl_file_temp(zpl_file *file) {
     return ZPL_FILE_ERROR_NONE;
 }
 
+zpl_internal zpl_file_contents zpl__file_read_contents(zpl_allocator a, zpl_b32 zero_terminate, zpl_file *file) {
+    zpl_file_contents result = { 0 };
+    zpl_isize file_size = cast(zpl_isize) zpl_file_size(file);
+
+    result.allocator = a;
+
+    if (file_size > 0) {
+        result.data = zpl_alloc(a, zero_terminate ? file_size + 1 : file_size);
+        result.size = file_size;
+        zpl_file_read_at(file, result.data, result.size, 0);
+        if (zero_terminate) {
+            zpl_u8 *str = cast(zpl_u8 *) result.data;
+            str[file_size] = '\0';
+        }
+    }
+
+    return result;
+}
+
 zpl_file_contents zpl_file_read_contents(zpl_allocator a, zpl_b32 zero_terminate, char const *filepath) {
     zpl_file_contents result = { 0 };
     zpl_file file = { 0 };
@@ -430,16 +484,7 @@ zpl_file_contents zpl_file_read_contents(zpl_allocator a, zpl_b32 zero_terminate
     result.allocator = a;
 
     if (zpl_file_open(&file, filepath) == ZPL_FILE_ERROR_NONE) {
-        zpl_isize file_size = cast(zpl_isize) zpl_file_size(&file);
-        if (file_size > 0) {
-            result.data = zpl_alloc(a, zero_terminate ? file_size + 1 : file_size);
-            result.size = file_size;
-            zpl_file_read_at(&file, result.data, result.size, 0);
-            if (zero_terminate) {
-                zpl_u8 *str = cast(zpl_u8 *) result.data;
-                str[file_size] = '\0';
-            }
-        }
+        result = zpl__file_read_contents(a, zero_terminate, &file);
         zpl_file_close(&file);
     }
 
@@ -448,11 +493,119 @@ zpl_file_contents zpl_file_read_contents(zpl_allocator a, zpl_b32 zero_terminate
 
 void zpl_file_free_contents(zpl_file_contents *fc) {
     ZPL_ASSERT_NOT_NULL(fc->data);
+    if (fc->mapped_size) {
+        zpl_file_unmap(fc);
+        return;
+    }
     zpl_free(fc->allocator, fc->data);
     fc->data = NULL;
     fc->size = 0;
 }
 
+#if defined(ZPL_SYSTEM_WINDOWS)
+    zpl_internal zpl_b32 zpl__file_map(zpl_file *file, zpl_isize size, zpl_b32 writable, zpl_b32 zero_terminate, zpl_file_contents *fc) {
+        HANDLE mapping;
+        void *data;
+
+        // NOTE: a view cannot extend past the end of the file, the zeroed tail of the last page is the only room for a terminator
+        if (zero_terminate && (size % zpl_virtual_memory_page_size(NULL)) == 0) return false;
+
+        mapping = CreateFileMappingW(cast(HANDLE) file->fd.p, NULL, writable ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+        if (mapping == NULL) return false;
+        data = MapViewOfFile(mapping, writable ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (data == NULL) return false;
+
+        fc->data = data;
+        fc->size = size;
+        fc->mapped_size = size;
+        return true;
+    }
+
+    zpl_internal void zpl__file_unmap(zpl_file_contents *fc) {
+        UnmapViewOfFile(fc->data);
+    }
+#else
+    zpl_internal zpl_b32 zpl__file_map(zpl_file *file, zpl_isize size, zpl_b32 writable, zpl_b32 zero_terminate, zpl_file_contents *fc) {
+        int prot = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        int fd = cast(int) file->fd.i;
+        zpl_isize map_size = size;
+        void *data;
+
+        if (zero_terminate) {
+            // NOTE: reserve an anonymous zeroed page past the file and map the file over the front,
+            // the data stays terminated even when the file ends on a page boundary.
+            zpl_isize page_size = zpl_virtual_memory_page_size(NULL);
+            map_size = (size / page_size + 1) * page_size;
+            data = mmap(NULL, map_size, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (data == MAP_FAILED) return false;
+            if (mmap(data, size, prot, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+                munmap(data, map_size);
+                return false;
+            }
+        } else {
+            data = mmap(NULL, size, prot, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) return false;
+        }
+
+#    if defined(MADV_SEQUENTIAL)
+        madvise(data, size, MADV_SEQUENTIAL);
+#    endif
+
+        fc->data = data;
+        fc->size = size;
+        fc->mapped_size = map_size;
+        return true;
+    }
+
+    zpl_internal void zpl__file_unmap(zpl_file_contents *fc) {
+        munmap(fc->data, fc->mapped_size);
+    }
+#endif
+
+zpl_file_contents zpl_file_map_contents(zpl_allocator a, zpl_b32 writable, zpl_b32 zero_terminate, char const *filepath) {
+    zpl_file_contents result = { 0 };
+    zpl_file file = { 0 };
+
+    result.allocator = a;
+
+    if (zpl_file_open(&file, filepath) == ZPL_FILE_ERROR_NONE) {
+        zpl_isize file_size = cast(zpl_isize) zpl_file_size(&file);
+        if (file_size < ZPL_FILE_MAP_MIN_SIZE || !zpl__file_map(&file, file_size, writable, zero_terminate, &result)) {
+            result = zpl__file_read_contents(a, zero_terminate, &file);
+        }
+        zpl_file_close(&file);
+    }
+
+    return result;
+}
+
+void zpl_file_unmap(zpl_file_contents *fc) {
+    ZPL_ASSERT_NOT_NULL(fc->data);
+    if (!fc->mapped_size) {
+        zpl_file_free_contents(fc);
+        return;
+    }
+    zpl__file_unmap(fc);
+    fc->data = NULL;
+    fc->size = 0;
+    fc->mapped_size = 0;
+}
+
+zpl_b32 zpl_file_writev(zpl_file *f, zpl_file_iovec const *iov, zpl_isize count) {
+    ZPL_ASSERT_NOT_NULL(f);
+    ZPL_ASSERT(count == 0 || iov != NULL);
+    if (!f->ops.read_at) f->ops = zpl_default_file_operations;
+#if !defined(ZPL_SYSTEM_WINDOWS) && !defined(ZPL_SYSTEM_CYGWIN)
+    if (f->ops.write_at == zpl_default_file_operations.write_at)
+        return zpl__posix_file_writev(f->fd, iov, count);
+#endif
+    for (zpl_isize i = 0; i < count; i++) {
+        if (!zpl_file_write(f, iov[i].data, iov[i].size)) return false;
+    }
+    return true;
+}
+
 zpl_b32 zpl_file_write_contents(char const* filepath, void const* buffer, zpl_isize size, zpl_file_error* err) {
     zpl_file f = { 0 };
     zpl_file_error open_err;
@@ -486,6 +639,70 @@ char *zpl_file_read_lines(zpl_allocator alloc, zpl_array(char *)*lines, char con
     return contents;
 }
 
+zpl_b32 zpl_file_line_iter_init(zpl_file_line_iter *it, zpl_allocator alloc, zpl_file *file, zpl_isize buffer_size) {
+    ZPL_ASSERT_NOT_NULL(it);
+    ZPL_ASSERT_NOT_NULL(file);
+    zpl_zero_item(it);
+    if (buffer_size <= 0) buffer_size = ZPL_FILE_BUFFER_SIZE;
+
+    it->buf = cast(char *)zpl_alloc(alloc, buffer_size);
+    if (!it->buf) return false;
+    it->file = file;
+    it->allocator = alloc;
+    it->cap = buffer_size;
+    it->offset = zpl_file_tell(file);
+    return true;
+}
+
+zpl_b32 zpl_file_line_next(zpl_file_line_iter *it, char const **line, zpl_isize *len) {
+    ZPL_ASSERT_NOT_NULL(it);
+    for (;;) {
+        char const *nl = cast(char const *)zpl_memchr(it->buf + it->scan, '\n', it->end - it->scan);
+        zpl_isize line_end;
+
+        if (nl) {
+            line_end = nl - it->buf;
+            it->scan = line_end + 1;
+        } else if (it->eof) {
+            if (it->start == it->end) return false;
+            line_end = it->scan = it->end;
+        } else {
+            /* keep the unfinished line, grow only when it fills the whole buffer */
+            zpl_isize got = 0;
+            if (it->start > 0) {
+                zpl_memmove(it->buf, it->buf + it->start, it->end - it->start);
+                it->end -= it->start;
+                it->start = 0;
+            }
+            it->scan = it->end;
+            if (it->end == it->cap) {
+                char *buf = cast(char *)zpl_resize(it->allocator, it->buf, it->cap, it->cap * 2);
+                if (!buf) return false;
+                it->buf = buf;
+                it->cap *= 2;
+            }
+            if (!zpl_file_read_at_check(it->file, it->buf + it->end, it->cap - it->end, it->offset, &got) || got <= 0) {
+                it->eof = true;
+            } else {
+                it->end += got;
+                it->offset += got;
+            }
+            continue;
+        }
+
+        *line = it->buf + it->start;
+        *len = line_end - it->start;
+        if (*len > 0 && (*line)[*len - 1] == '\r') (*len)--;
+        it->start = it->scan;
+        return true;
+    }
+}
+
+void zpl_file_line_iter_free(zpl_file_line_iter *it) {
+    if (it->buf) zpl_free(it->allocator, it->buf);
+    it->buf = NULL;
+}
+
 #if !defined(_WINDOWS_) && defined(ZPL_SYSTEM_WINDOWS)
     ZPL_IMPORT DWORD WINAPI GetFullPathNameA(char const *lpFileName, DWORD nBufferLength, char *lpBuffer, char **lpFilePart);
     ZPL_IMPORT DWORD WINAPI GetFullPathNameW(wchar_t const *lpFileName, DWORD nBufferLength, wchar_t *lpBuffer, wchar_t **lpFilePart);
@@ -0,0 +1,177 @@
+// file: source/core/file_buffered.c
+
+
+////////////////////////////////////////////////////////////////
+//
+// Buffered file I/O
+//
+//
+
+ZPL_BEGIN_C_DECLS
+
+typedef struct {
+    zpl_u8 magic;
+    zpl_file inner;
+    zpl_allocator alloc;
+
+    zpl_u8 *buf;
+    zpl_isize cap;
+    zpl_isize len;       //< valid read-ahead bytes or pending write bytes
+    zpl_i64 buf_offset;  //< file offset of buf[0]
+    zpl_b32 dirty;       //< buf holds pending writes
+    zpl_i64 cursor;
+} zpl__buffered_fd;
+
+#define ZPL__FILE_BUFFERED_FD_MAGIC 41
+
+zpl_internal zpl__buffered_fd *zpl__file_buffered_from_fd(zpl_file_descriptor fd) {
+    zpl__buffered_fd *d = (zpl__buffered_fd*)fd.p;
+    ZPL_ASSERT(d->magic == ZPL__FILE_BUFFERED_FD_MAGIC);
+    return d;
+}
+
+zpl_internal zpl_b32 zpl__file_buffered_flush(zpl__buffered_fd *d) {
+    zpl_b32 result = true;
+    if (d->dirty && d->len > 0) {
+        result = zpl_file_write_at(&d->inner, d->buf, d->len, d->buf_offset);
+    }
+    d->dirty = false;
+    d->len = 0;
+    return result;
+}
+
+zpl_b8 zpl_file_buffered_wrap(zpl_file *file, zpl_allocator allocator, zpl_file *inner, zpl_isize buffer_size) {
+    ZPL_ASSERT_NOT_NULL(file);
+    ZPL_ASSERT_NOT_NULL(inner);
+    if (buffer_size <= 0) buffer_size = ZPL_FILE_BUFFER_SIZE;
+
+    zpl__buffered_fd *d = (zpl__buffered_fd*)zpl_alloc(allocator, zpl_size_of(zpl__buffered_fd) + buffer_size);
+    if (!d) return false;
+    zpl_zero_item(d);
+    d->magic = ZPL__FILE_BUFFERED_FD_MAGIC;
+    d->inner = *inner;
+    if (!d->inner.ops.read_at) d->inner.ops = zpl_default_file_operations;
+    d->alloc = allocator;
+    d->buf = cast(zpl_u8 *)(d + 1);
+    d->cap = buffer_size;
+    d->cursor = zpl_file_tell(inner);
+
+    zpl_zero_item(file);
+    file->ops = zpl_buffered_file_operations;
+    file->fd.p = cast(void *)d;
+    file->is_temp = true;
+    return true;
+}
+
+zpl_file_error zpl_file_buffered_open(zpl_file *file, zpl_allocator allocator, zpl_file_mode mode, char const *filename, zpl_isize buffer_size) {
+    zpl_file inner;
+    zpl_file_error err = zpl_file_open_mode(&inner, mode, filename);
+    if (err != ZPL_FILE_ERROR_NONE) return err;
+    if (!zpl_file_buffered_wrap(file, allocator, &inner, buffer_size)) {
+        zpl_file_close(&inner);
+        return ZPL_FILE_ERROR_UNKNOWN;
+    }
+    return ZPL_FILE_ERROR_NONE;
+}
+
+zpl_b32 zpl_file_flush(zpl_file *file) {
+    ZPL_ASSERT_NOT_NULL(file);
+    if (file->ops.write_at != zpl_buffered_file_operations.write_at) return true;
+    return zpl__file_buffered_flush(zpl__file_buffered_from_fd(file->fd));
+}
+
+zpl_internal ZPL_FILE_SEEK_PROC(zpl__buffered_file_seek) {
+    zpl__buffered_fd *d = zpl__file_buffered_from_fd(fd);
+
+    if (whence == ZPL_SEEK_WHENCE_BEGIN) {
+        d->cursor = offset;
+    } else if (whence == ZPL_SEEK_WHENCE_CURRENT) {
+        d->cursor += offset;
+    } else {
+        /* the end moves with pending writes, let the file know about them first */
+        zpl_i64 end = 0;
+        if (!zpl__file_buffered_flush(d)) return false;
+        if (!d->inner.ops.seek(d->inner.fd, 0, ZPL_SEEK_WHENCE_END, &end)) return false;
+        d->cursor = end + offset;
+    }
+
+    if (d->cursor < 0) d->cursor = 0;
+    if (new_offset) *new_offset = d->cursor;
+    return true;
+}
+
+zpl_internal ZPL_FILE_READ_AT_PROC(zpl__buffered_file_read) {
+    zpl__buffered_fd *d = zpl__file_buffered_from_fd(fd);
+    zpl_isize done = 0;
+    zpl_b32 result = true;
+
+    if (d->dirty && !zpl__file_buffered_flush(d)) return false;
+
+    while (done < size) {
+        zpl_i64 pos = offset + done;
+
+        if (pos >= d->buf_offset && pos < d->buf_offset + d->len) {
+            zpl_isize n = cast(zpl_isize)zpl_min(size - done, d->buf_offset + d->len - pos);
+            zpl_memcopy(cast(zpl_u8 *)buffer + done, d->buf + (pos - d->buf_offset), n);
+            done += n;
+            continue;
+        }
+
+        /* large reads skip the buffer */
+        if (size - done >= d->cap) {
+            zpl_isize got = 0;
+            result = d->inner.ops.read_at(d->inner.fd, cast(zpl_u8 *)buffer + done, size - done, pos, &got, stop_at_newline);
+            done += got;
+            break;
+        }
+
+        d->buf_offset = pos;
+        d->len = 0;
+        result = d->inner.ops.read_at(d->inner.fd, d->buf, d->cap, pos, &d->len, stop_at_newline);
+        if (!result || d->len <= 0) {
+            d->len = 0;
+            break;
+        }
+    }
+
+    if (bytes_read) *bytes_read = done;
+    return result;
+}
+
+zpl_internal ZPL_FILE_WRITE_AT_PROC(zpl__buffered_file_write) {
+    zpl__buffered_fd *d = zpl__file_buffered_from_fd(fd);
+
+    /* coalesce writes that continue the pending run */
+    if (d->dirty && offset == d->buf_offset + d->len && d->len + size <= d->cap) {
+        zpl_memcopy(d->buf + d->len, buffer, size);
+        d->len += size;
+        if (bytes_written) *bytes_written = size;
+        return true;
+    }
+
+    /* drops the read-ahead data as well, it may overlap the write */
+    if (!zpl__file_buffered_flush(d)) return false;
+
+    if (size >= d->cap) {
+        return d->inner.ops.write_at(d->inner.fd, buffer, size, offset, bytes_written);
+    }
+
+    zpl_memcopy(d->buf, buffer, size);
+    d->buf_offset = offset;
+    d->len = size;
+    d->dirty = true;
+    if (bytes_written) *bytes_written = size;
+    return true;
+}
+
+zpl_internal ZPL_FILE_CLOSE_PROC(zpl__buffered_file_close) {
+    zpl__buffered_fd *d = zpl__file_buffered_from_fd(fd);
+    zpl__file_buffered_flush(d);
+    zpl_file_close(&d->inner);
+    zpl_free(d->alloc, d);
+}
+
+zpl_file_operations const zpl_buffered_file_operations = { zpl__buffered_file_read, zpl__buffered_file_write,
+    zpl__buffered_file_seek, zpl__buffered_file_close };
+
+ZPL_END_C_DECLS
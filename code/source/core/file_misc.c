@@ -9,6 +9,11 @@
 #    include <sys/sendfile.h>
 #endif
 
+#if defined(ZPL_SYSTEM_LINUX) && !defined(ZPL_SYSTEM_EMSCRIPTEN)
+#    include <sys/syscall.h>
+#    define ZPL__DIR_WALK_GETDENTS
+#endif
+
 #if defined(ZPL_SYSTEM_WINDOWS)
 #   include <io.h>
 #   include <direct.h>
@@ -41,18 +46,30 @@ ZPL_BEGIN_C_DECLS
         return cast(zpl_file_time) li.QuadPart;
     }
 
-    zpl_b32 zpl_fs_copy(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists) {
+    zpl_b32 zpl_fs_copy_ex(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists, zpl_fs_copy_stats *stats) {
+        zpl_f64 start = zpl_time_rel( );
         zpl_b32 result = false;
+        WIN32_FILE_ATTRIBUTE_DATA data = { 0 };
         zpl_allocator a = zpl_heap_allocator( );
 
         wchar_t *w_old = zpl__alloc_utf8_to_ucs2(a, existing_filename, NULL);
         if (w_old == NULL) { return false; }
 
         wchar_t *w_new = zpl__alloc_utf8_to_ucs2(a, new_filename, NULL);
-        if (w_new != NULL) { result = CopyFileW(w_old, w_new, fail_if_exists); }
+        if (w_new != NULL) {
+            GetFileAttributesExW(w_old, GetFileExInfoStandard, &data);
+            result = CopyFileW(w_old, w_new, fail_if_exists);
+        }
 
         zpl_free(a, w_old);
         zpl_free(a, w_new);
+
+        if (stats) {
+            stats->file_size = (cast(zpl_i64)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+            stats->bytes_copied = result ? stats->file_size : 0;
+            stats->elapsed = zpl_time_rel( ) - start;
+            stats->method = ZPL_FS_COPY_METHOD_SYSTEM;
+        }
         return result;
     }
 
@@ -90,48 +107,161 @@ ZPL_BEGIN_C_DECLS
         time_t result = 0;
         struct stat file_stat;
 
-        if (stat(filepath, &file_stat)) result = file_stat.st_mtime;
+        if (stat(filepath, &file_stat) == 0) result = file_stat.st_mtime;
 
         return cast(zpl_file_time) result;
     }
 
-#    if defined(ZPL_SYSTEM_FREEBSD)
-#        include <sys/types.h>
-#        include <sys/socket.h>
-#        include <sys/uio.h>
-#    endif
-
-
-    zpl_b32 zpl_fs_copy(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists) {
-        zpl_unused(fail_if_exists);
 #    if defined(ZPL_SYSTEM_OSX)
-        return copyfile(existing_filename, new_filename, NULL, COPYFILE_DATA) == 0;
-#    elif defined(ZPL_SYSTEM_OPENBSD)
-        ZPL_NOT_IMPLEMENTED;
-        return 0;
-#    elif defined(ZPL_SYSTEM_EMSCRIPTEN)
-        ZPL_NOT_IMPLEMENTED;
-        return 0;
-#    else
-        int existing_fd = open(existing_filename, O_RDONLY, 0);
+    zpl_b32 zpl_fs_copy_ex(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists, zpl_fs_copy_stats *stats) {
+        zpl_f64 start = zpl_time_rel( );
         struct stat stat_existing;
-        fstat(existing_fd, &stat_existing);
+        zpl_b32 result;
 
-        zpl_isize size;
-        int new_fd = open(new_filename, O_WRONLY | O_CREAT, stat_existing.st_mode);
+        if (stat(existing_filename, &stat_existing) != 0) return false;
+        result = copyfile(existing_filename, new_filename, NULL, COPYFILE_DATA | (fail_if_exists ? COPYFILE_EXCL : 0)) == 0;
 
-#    if defined(ZPL_SYSTEM_FREEBSD)
-        size = sendfile(new_fd, existing_fd, 0, stat_existing.st_size, NULL, 0, 0);
+        if (stats) {
+            stats->file_size = stat_existing.st_size;
+            stats->bytes_copied = result ? stat_existing.st_size : 0;
+            stats->elapsed = zpl_time_rel( ) - start;
+            stats->method = ZPL_FS_COPY_METHOD_SYSTEM;
+        }
+        return result;
+    }
 #    else
-        size = sendfile(new_fd, existing_fd, 0, stat_existing.st_size);
-#    endif
+#        if defined(ZPL_SYSTEM_LINUX) && defined(SYS_copy_file_range)
+#            define ZPL__FS_COPY_FILE_RANGE
+#        endif
+
+#        define ZPL__FS_COPY_SEGMENT
+#        if defined(ZPL__FS_COPY_FILE_RANGE)
+#            define ZPL__FS_COPY_METHOD_FIRST ZPL_FS_COPY_METHOD_COPY_RANGE
+#        elif defined(ZPL_SYSTEM_LINUX)
+#            define ZPL__FS_COPY_METHOD_FIRST ZPL_FS_COPY_METHOD_SENDFILE
+#        else
+#            define ZPL__FS_COPY_METHOD_FIRST ZPL_FS_COPY_METHOD_READ_WRITE
+#        endif
+
+    // NOTE: copies length bytes from in_offset to out_offset, downgrading the method
+    // whenever the kernel refuses the faster one for this pair of files
+    zpl_internal zpl_b32 zpl__fs_copy_segment(int in, zpl_i64 in_offset, int out, zpl_i64 out_offset, zpl_i64 length, zpl_u8 *method, zpl_u8 *buffer, zpl_i64 *copied) {
+        while (length > 0) {
+            zpl_isize chunk = cast(zpl_isize)zpl_min(length, ZPL_FS_COPY_CHUNK_SIZE);
+            zpl_isize n = -1;
+
+#        if defined(ZPL__FS_COPY_FILE_RANGE)
+            if (*method == ZPL_FS_COPY_METHOD_COPY_RANGE) {
+                loff_t in_off = in_offset, out_off = out_offset;
+                n = syscall(SYS_copy_file_range, in, &in_off, out, &out_off, cast(size_t)chunk, 0);
+                // NOTE: some filesystems (FUSE, overlay, procfs-like) report 0 bytes while the data is there
+                if (n == 0 || (n < 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP || errno == EPERM))) {
+                    *method = ZPL_FS_COPY_METHOD_SENDFILE;
+                    continue;
+                }
+            }
+#        endif
+#        if defined(ZPL_SYSTEM_LINUX)
+            if (*method == ZPL_FS_COPY_METHOD_SENDFILE) {
+                off_t in_off = in_offset;
+                if (lseek(out, out_offset, SEEK_SET) < 0) return false;
+                n = sendfile(out, in, &in_off, cast(size_t)chunk);
+                if (n == 0 || (n < 0 && (errno == ENOSYS || errno == EINVAL))) {
+                    *method = ZPL_FS_COPY_METHOD_READ_WRITE;
+                    continue;
+                }
+            }
+#        endif
+            if (*method == ZPL_FS_COPY_METHOD_READ_WRITE) {
+                n = pread(in, buffer, cast(size_t)zpl_min(chunk, ZPL_FILE_BUFFER_SIZE), in_offset);
+                for (zpl_isize written = 0; n > 0 && written < n;) {
+                    zpl_isize w = pwrite(out, buffer + written, cast(size_t)(n - written), out_offset + written);
+                    if (w < 0 && errno == EINTR) continue;
+                    if (w <= 0) return false;
+                    written += w;
+                }
+            }
+
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            if (n == 0) return false; // NOTE: the source got shorter underneath us
+
+            in_offset += n;
+            out_offset += n;
+            length -= n;
+            *copied += n;
+        }
+        return true;
+    }
+
+    zpl_b32 zpl_fs_copy_ex(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists, zpl_fs_copy_stats *stats) {
+        zpl_f64 start = zpl_time_rel( );
+        zpl_b32 result = true;
+        zpl_i64 offset = 0, copied = 0;
+        zpl_u8 *buffer = NULL;
+        zpl_u8 method = ZPL__FS_COPY_METHOD_FIRST;
+        struct stat stat_existing, stat_new;
+        int existing_fd, new_fd;
+
+        existing_fd = open(existing_filename, O_RDONLY | O_CLOEXEC, 0);
+        if (existing_fd < 0) return false;
+        if (fstat(existing_fd, &stat_existing) != 0) {
+            close(existing_fd);
+            return false;
+        }
+
+        // NOTE: truncated only once it is known not to be the source itself, or a hard link to it
+        new_fd = open(new_filename, O_WRONLY | O_CREAT | O_CLOEXEC | (fail_if_exists ? O_EXCL : 0), stat_existing.st_mode & 07777);
+        if (new_fd < 0) {
+            close(existing_fd);
+            return false;
+        }
+        if (fstat(new_fd, &stat_new) != 0 || (stat_new.st_dev == stat_existing.st_dev && stat_new.st_ino == stat_existing.st_ino) ||
+            ftruncate(new_fd, 0) != 0) {
+            close(new_fd);
+            close(existing_fd);
+            return false;
+        }
+
+        buffer = cast(zpl_u8 *)zpl_alloc(zpl_heap( ), ZPL_FILE_BUFFER_SIZE);
+
+#        if defined(SEEK_DATA) && defined(SEEK_HOLE)
+        // NOTE: only the data extents are copied, holes are recreated by the final truncate
+        while (result && offset < stat_existing.st_size) {
+            zpl_i64 data = lseek(existing_fd, offset, SEEK_DATA);
+            zpl_i64 hole;
+            if (data < 0) {
+                if (errno == ENXIO) break; // the rest of the file is a hole
+                data = offset;
+                hole = stat_existing.st_size;
+            } else {
+                hole = lseek(existing_fd, data, SEEK_HOLE);
+                if (hole < 0 || hole > stat_existing.st_size) hole = stat_existing.st_size;
+            }
+            result = zpl__fs_copy_segment(existing_fd, data, new_fd, data, hole - data, &method, buffer, &copied);
+            offset = hole;
+        }
+#        else
+        result = zpl__fs_copy_segment(existing_fd, 0, new_fd, 0, stat_existing.st_size, &method, buffer, &copied);
+#        endif
+
+        if (result && ftruncate(new_fd, stat_existing.st_size) != 0) result = false;
 
+        zpl_free(zpl_heap( ), buffer);
         close(new_fd);
         close(existing_fd);
 
-        return size == stat_existing.st_size;
-#    endif
+        if (stats) {
+            stats->file_size = stat_existing.st_size;
+            stats->bytes_copied = copied;
+            stats->elapsed = zpl_time_rel( ) - start;
+            stats->method = method;
+        }
+        return result;
     }
+#    endif
 
     zpl_b32 zpl_fs_move(char const *existing_filename, char const *new_filename) {
         if (link(existing_filename, new_filename) == 0) { return (unlink(existing_filename) != -1); }
@@ -148,6 +278,10 @@ ZPL_BEGIN_C_DECLS
 
 #endif
 
+zpl_b32 zpl_fs_copy(char const *existing_filename, char const *new_filename, zpl_b32 fail_if_exists) {
+    return zpl_fs_copy_ex(existing_filename, new_filename, fail_if_exists, NULL);
+}
+
 char *zpl_path_get_full_name(zpl_allocator a, char const *path) {
 #if defined(ZPL_SYSTEM_WINDOWS)
     wchar_t *w_path = NULL;
@@ -273,7 +407,7 @@ zpl_file_error zpl_path_rmdir(char const *path) {
 
 void zpl__file_direntry(zpl_allocator alloc, char const *dirname, zpl_string *output, zpl_b32 recurse) {
 #if defined(ZPL_SYSTEM_UNIX) || defined(ZPL_SYSTEM_OSX)
-    DIR *d, *cd;
+    DIR *d;
     struct dirent *dir;
     d = opendir(dirname);
 
@@ -290,9 +424,11 @@ void zpl__file_direntry(zpl_allocator alloc, char const *dirname, zpl_string *ou
             *output = zpl_string_appendc(*output, dirpath);
             *output = zpl_string_appendc(*output, "\n");
 
-            if (recurse && (cd = opendir(dirpath)) != NULL && dir->d_type == DT_DIR) { zpl__file_direntry(alloc, dirpath, output, recurse); }
+            if (recurse && dir->d_type == DT_DIR) { zpl__file_direntry(alloc, dirpath, output, recurse); }
             zpl_string_free(dirpath);
         }
+
+        closedir(d);
     }
 #elif defined(ZPL_SYSTEM_WINDOWS)
     zpl_usize length = zpl_strlen(dirname);
@@ -349,6 +485,360 @@ zpl_string zpl_path_dirlist(zpl_allocator alloc, char const *dirname, zpl_b32 re
     return buf;
 }
 
+#ifndef ZPL_DIR_WALK_BUFFER_SIZE
+#define ZPL_DIR_WALK_BUFFER_SIZE 32768
+#endif
+
+#if defined(ZPL_SYSTEM_WINDOWS)
+#    define ZPL__DIR_WALK_CWD (-1)
+#elif defined(ZPL_SYSTEM_UNIX) || defined(ZPL_SYSTEM_OSX)
+#    define ZPL__DIR_WALK_CWD AT_FDCWD
+#else
+#    define ZPL__DIR_WALK_CWD (-1)
+#endif
+
+typedef struct zpl__dir_walker {
+    zpl_u32 flags;
+    zpl_isize max_depth;
+    char const *pattern;
+    zpl_allocator allocator;
+    zpl_dir_walk_proc proc;
+    void *user_data;
+    zpl_b32 volatile stop;
+#if defined(ZPL_MODULE_JOBS)
+    zpl_b32 parallel;
+    zpl_mutex lock;
+    zpl_array(struct zpl__dir_walk_job *) pending;
+#endif
+} zpl__dir_walker;
+
+typedef struct zpl__dir_walk_job {
+    zpl__dir_walker *w;
+    zpl_string path;
+    zpl_isize depth;
+} zpl__dir_walk_job;
+
+zpl_internal zpl_b32 zpl__dir_walk_dir(zpl__dir_walker *w, int parent_fd, char const *open_name, zpl_string *path, zpl_isize depth);
+
+// NOTE: returns the position past the closing bracket, NULL if the class isn't terminated
+zpl_internal char const *zpl__path_glob_class(char const *p, char c, zpl_b32 *matched) {
+    char const *start;
+    zpl_b32 negate = (*p == '!' || *p == '^');
+    zpl_b32 found = false;
+    if (negate) p++;
+    start = p;
+
+    while (*p && (*p != ']' || p == start)) {
+        if (p[1] == '-' && p[2] && p[2] != ']') {
+            if (c >= p[0] && c <= p[2]) found = true;
+            p += 3;
+        } else {
+            if (*p == c) found = true;
+            p++;
+        }
+    }
+
+    if (*p != ']') return NULL;
+    *matched = found != negate;
+    return p + 1;
+}
+
+zpl_internal zpl_b32 zpl__path_glob_match(char const *p, char const *n) {
+    char const *star_p = NULL, *star_n = NULL;
+
+    while (*n) {
+        if (*p == '*') {
+            star_p = ++p;
+            star_n = n;
+            continue;
+        }
+        if (*p == '[') {
+            zpl_b32 matched = false;
+            char const *next = zpl__path_glob_class(p + 1, *n, &matched);
+            if (next && matched) { p = next; n++; continue; }
+            if (!next && *n == '[') { p++; n++; continue; }
+        } else if (*p && (*p == '?' || *p == *n)) {
+            p++; n++;
+            continue;
+        }
+
+        // NOTE: backtrack to the last star and let it swallow one more character
+        if (!star_p) return false;
+        p = star_p;
+        n = ++star_n;
+    }
+
+    while (*p == '*') p++;
+    return *p == 0;
+}
+
+zpl_internal zpl_b32 zpl__dir_walk_report(zpl__dir_walker *w, zpl_string path, zpl_isize name_offset, zpl_isize depth, zpl_u8 type) {
+    zpl_dir_walk_entry entry;
+    zpl_u32 wanted = (type == ZPL_DIR_TYPE_FOLDER) ? ZPL_DIR_WALK_FOLDERS : ZPL_DIR_WALK_FILES;
+    if (!(w->flags & wanted)) return true;
+    if (w->pattern && !zpl__path_glob_match(w->pattern, path + name_offset)) return true;
+
+    entry.path = path;
+    entry.name = path + name_offset;
+    entry.depth = depth;
+    entry.type = type;
+    return w->proc(&entry, w->user_data);
+}
+
+zpl_internal void zpl__dir_walk_visit(zpl__dir_walker *w, int dir_fd, zpl_string *path, char const *name, zpl_u8 type, zpl_b32 descend, zpl_isize depth) {
+    zpl_isize base = zpl_string_length(*path);
+    zpl_isize name_offset;
+
+    if (base == 0 || ((*path)[base - 1] != '/' && (*path)[base - 1] != ZPL_PATH_SEPARATOR)) {
+        char sep[2] = { ZPL_PATH_SEPARATOR, 0 };
+        *path = zpl_string_appendc(*path, sep);
+    }
+    name_offset = zpl_string_length(*path);
+    *path = zpl_string_appendc(*path, name);
+
+    if (!zpl__dir_walk_report(w, *path, name_offset, depth, type)) w->stop = true;
+
+    if (!w->stop && descend && (w->max_depth < 0 || depth < w->max_depth)) {
+#if defined(ZPL_MODULE_JOBS)
+        if (w->parallel) {
+            zpl__dir_walk_job *job = zpl_alloc_item(w->allocator, zpl__dir_walk_job);
+            job->w = w;
+            job->path = zpl_string_duplicate(w->allocator, *path);
+            job->depth = depth + 1;
+
+            zpl_mutex_lock(&w->lock);
+            zpl_array_append(w->pending, job);
+            zpl_mutex_unlock(&w->lock);
+        } else
+#endif
+        zpl__dir_walk_dir(w, dir_fd, name, path, depth + 1);
+    }
+
+    zpl__set_string_length(*path, base);
+    (*path)[base] = '\0';
+}
+
+zpl_internal zpl_b32 zpl__dir_walk_skip(zpl__dir_walker *w, char const *name) {
+    if (name[0] != '.') return false;
+    if (name[1] == 0 || (name[1] == '.' && name[2] == 0)) return true;
+    return !(w->flags & ZPL_DIR_WALK_HIDDEN);
+}
+
+#if defined(ZPL_SYSTEM_WINDOWS)
+
+zpl_internal zpl_b32 zpl__dir_walk_dir(zpl__dir_walker *w, int parent_fd, char const *open_name, zpl_string *path, zpl_isize depth) {
+    WIN32_FIND_DATAW data;
+    HANDLE find;
+    wchar_t *w_search;
+    zpl_isize base = zpl_string_length(*path);
+    zpl_unused(parent_fd);
+    zpl_unused(open_name);
+
+    *path = zpl_string_appendc(*path, "\\*");
+    w_search = zpl__alloc_utf8_to_ucs2(w->allocator, *path, NULL);
+    zpl__set_string_length(*path, base);
+    (*path)[base] = '\0';
+    if (w_search == NULL) return false;
+
+    find = FindFirstFileExW(w_search, FindExInfoBasic, &data, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+    zpl_free(w->allocator, w_search);
+    if (find == INVALID_HANDLE_VALUE) return false;
+
+    do {
+        char name[1024];
+        zpl_b32 is_dir = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        zpl_b32 is_link = (data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+
+        if (!zpl_ucs2_to_utf8(cast(zpl_u8 *)name, zpl_size_of(name), cast(zpl_u16 const *)data.cFileName)) continue;
+        if (zpl__dir_walk_skip(w, name)) continue;
+        if ((data.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) && !(w->flags & ZPL_DIR_WALK_HIDDEN)) continue;
+
+        zpl__dir_walk_visit(w, -1, path, name, is_dir ? ZPL_DIR_TYPE_FOLDER : ZPL_DIR_TYPE_FILE, is_dir && !is_link, depth);
+    } while (!w->stop && FindNextFileW(find, &data));
+
+    FindClose(find);
+    return true;
+}
+
+#elif defined(ZPL_SYSTEM_UNIX) || defined(ZPL_SYSTEM_OSX)
+
+#if defined(ZPL__DIR_WALK_GETDENTS)
+typedef struct {
+    zpl_u64 d_ino;
+    zpl_i64 d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+} zpl__linux_dirent64;
+#endif
+
+zpl_internal zpl_u8 zpl__dir_walk_type(int dir_fd, char const *name, unsigned char d_type, zpl_b32 *descend) {
+    struct stat st;
+    *descend = false;
+
+    if (d_type == DT_DIR) { *descend = true; return ZPL_DIR_TYPE_FOLDER; }
+    if (d_type == DT_REG) return ZPL_DIR_TYPE_FILE;
+    if (d_type != DT_LNK && d_type != DT_UNKNOWN) return ZPL_DIR_TYPE_FILE;
+
+    // NOTE: the file system didn't tell us, or it's a link whose target decides the type
+    if (fstatat(dir_fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0) return ZPL_DIR_TYPE_UNKNOWN;
+    if (S_ISDIR(st.st_mode)) { *descend = true; return ZPL_DIR_TYPE_FOLDER; }
+    if (!S_ISLNK(st.st_mode)) return ZPL_DIR_TYPE_FILE;
+    if (fstatat(dir_fd, name, &st, 0) != 0) return ZPL_DIR_TYPE_UNKNOWN;
+    return S_ISDIR(st.st_mode) ? ZPL_DIR_TYPE_FOLDER : ZPL_DIR_TYPE_FILE;
+}
+
+zpl_internal void zpl__dir_walk_entry(zpl__dir_walker *w, int dir_fd, zpl_string *path, char const *name, unsigned char d_type, zpl_isize depth) {
+    zpl_b32 descend;
+    zpl_u8 type;
+    if (zpl__dir_walk_skip(w, name)) return;
+    type = zpl__dir_walk_type(dir_fd, name, d_type, &descend);
+    zpl__dir_walk_visit(w, dir_fd, path, name, type, descend, depth);
+}
+
+zpl_internal zpl_b32 zpl__dir_walk_dir(zpl__dir_walker *w, int parent_fd, char const *open_name, zpl_string *path, zpl_isize depth) {
+    int fd = openat(parent_fd, open_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) return false;
+
+#if defined(ZPL__DIR_WALK_GETDENTS)
+    {
+        char *buf = cast(char *)zpl_alloc(w->allocator, ZPL_DIR_WALK_BUFFER_SIZE);
+        long len;
+
+        if (buf) {
+            while (!w->stop && (len = syscall(SYS_getdents64, fd, buf, ZPL_DIR_WALK_BUFFER_SIZE)) > 0) {
+                long pos = 0;
+                while (!w->stop && pos < len) {
+                    zpl__linux_dirent64 *d = cast(zpl__linux_dirent64 *)(buf + pos);
+                    pos += d->d_reclen;
+                    zpl__dir_walk_entry(w, fd, path, d->d_name, d->d_type, depth);
+                }
+            }
+            zpl_free(w->allocator, buf);
+        }
+        close(fd);
+    }
+#else
+    {
+        DIR *d = fdopendir(fd);
+        struct dirent *e;
+        if (d == NULL) { close(fd); return false; }
+
+        while (!w->stop && (e = readdir(d)) != NULL) {
+            zpl__dir_walk_entry(w, dirfd(d), path, e->d_name, e->d_type, depth);
+        }
+        closedir(d);
+    }
+#endif
+    return true;
+}
+
+#else
+
+zpl_internal zpl_b32 zpl__dir_walk_dir(zpl__dir_walker *w, int parent_fd, char const *open_name, zpl_string *path, zpl_isize depth) {
+    // TODO: Implement other OSes
+    zpl_unused(w); zpl_unused(parent_fd); zpl_unused(open_name); zpl_unused(path); zpl_unused(depth);
+    return false;
+}
+
+#endif
+
+#if defined(ZPL_MODULE_JOBS)
+zpl_internal void zpl__dir_walk_job_proc(void *data) {
+    zpl__dir_walk_job *job = cast(zpl__dir_walk_job *)data;
+    zpl__dir_walker *w = job->w;
+
+    // NOTE: the path is read before the walk appends to it, so it can double as the open name
+    if (!w->stop) zpl__dir_walk_dir(w, ZPL__DIR_WALK_CWD, job->path, &job->path, job->depth);
+
+    zpl_string_free(job->path);
+    zpl_free(w->allocator, job);
+}
+
+zpl_internal void zpl__dir_walk_parallel(zpl__dir_walker *w, zpl_u32 thread_count) {
+    zpl_jobs_system pool;
+    zpl_jobs_init(&pool, zpl_heap(), thread_count);
+
+    // NOTE: workers push the directories they find, we keep the pool fed until
+    // it runs dry with nothing left to schedule
+    for (;;) {
+        zpl_b32 idle;
+        zpl_mutex_lock(&w->lock);
+        while (zpl_array_count(w->pending) > 0 && !zpl_jobs_full(&pool, ZPL_JOBS_PRIORITY_NORMAL)) {
+            zpl__dir_walk_job *job = w->pending[zpl_array_count(w->pending) - 1];
+            zpl_array_pop(w->pending);
+            zpl_jobs_enqueue(&pool, zpl__dir_walk_job_proc, job);
+        }
+        idle = zpl_array_count(w->pending) == 0;
+        zpl_mutex_unlock(&w->lock);
+
+        zpl_jobs_process(&pool);
+        if (idle && zpl_jobs_done(&pool)) {
+            zpl_mutex_lock(&w->lock);
+            idle = zpl_array_count(w->pending) == 0;
+            zpl_mutex_unlock(&w->lock);
+            if (idle) break;
+        }
+        zpl_yield();
+    }
+
+    zpl_jobs_free(&pool);
+}
+#endif
+
+zpl_b32 zpl_path_walk(char const *root, zpl_dir_walk_opts const *opts, zpl_dir_walk_proc proc, void *user_data) {
+    zpl__dir_walker w = {0};
+    zpl_string path;
+    zpl_isize len;
+    zpl_b32 result;
+    zpl_u32 thread_count = 0;
+    ZPL_ASSERT_NOT_NULL(root);
+    ZPL_ASSERT_NOT_NULL(proc);
+
+    w.max_depth = -1;
+    w.allocator = zpl_heap();
+    if (opts) {
+        w.flags = opts->flags;
+        w.max_depth = opts->max_depth;
+        w.pattern = opts->pattern;
+        if (opts->allocator.proc) w.allocator = opts->allocator;
+        thread_count = opts->thread_count;
+    }
+    if (!(w.flags & (ZPL_DIR_WALK_FILES | ZPL_DIR_WALK_FOLDERS))) w.flags |= ZPL_DIR_WALK_FILES | ZPL_DIR_WALK_FOLDERS;
+    w.proc = proc;
+    w.user_data = user_data;
+
+    path = zpl_string_make_reserve(w.allocator, ZPL_MAX_PATH);
+    path = zpl_string_appendc(path, root);
+
+    // NOTE: drop trailing separators but keep the root itself intact
+    len = zpl_string_length(path);
+    while (len > 1 && (path[len - 1] == '/' || path[len - 1] == ZPL_PATH_SEPARATOR) && path[len - 2] != ':') len--;
+    zpl__set_string_length(path, len);
+    path[len] = '\0';
+
+#if defined(ZPL_MODULE_JOBS)
+    if (thread_count > 1) {
+        // NOTE: the root is walked on the calling thread so we can report whether it opened
+        w.parallel = true;
+        zpl_mutex_init(&w.lock);
+        zpl_array_init(w.pending, w.allocator);
+        result = zpl__dir_walk_dir(&w, ZPL__DIR_WALK_CWD, path, &path, 0);
+        if (result) zpl__dir_walk_parallel(&w, thread_count);
+
+        zpl_array_free(w.pending);
+        zpl_mutex_destroy(&w.lock);
+    } else
+#endif
+    {
+        zpl_unused(thread_count);
+        result = zpl__dir_walk_dir(&w, ZPL__DIR_WALK_CWD, path, &path, 0);
+    }
+
+    zpl_string_free(path);
+    return result;
+}
+
 void zpl_dirinfo_init(zpl_dir_info *dir, char const *path) {
     ZPL_ASSERT_NOT_NULL(dir);
 
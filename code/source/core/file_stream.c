@@ -103,8 +103,10 @@ zpl_internal ZPL_FILE_SEEK_PROC(zpl__memory_file_seek) {
 zpl_internal ZPL_FILE_READ_AT_PROC(zpl__memory_file_read) {
     zpl_unused(stop_at_newline);
     zpl__memory_fd *d = zpl__file_stream_from_fd(fd);
-    zpl_memcopy(buffer, d->buf + offset, size);
-    if (bytes_read) *bytes_read = size;
+    /* like pread, a read past the end of the stream is cut short */
+    zpl_isize avail = cast(zpl_isize)zpl_clamp(d->cap - offset, 0, size);
+    zpl_memcopy(buffer, d->buf + offset, avail);
+    if (bytes_read) *bytes_read = avail;
     return true;
 }
 
@@ -145,4 +147,215 @@ zpl_internal ZPL_FILE_CLOSE_PROC(zpl__memory_file_close) {
 zpl_file_operations const zpl_memory_file_operations = { zpl__memory_file_read, zpl__memory_file_write,
     zpl__memory_file_seek, zpl__memory_file_close };
 
+////////////////////////////////////////////////////////////////
+//
+// Rope streaming
+//
+//
+
+typedef struct {
+    zpl_u8 *data;
+    zpl_isize len;
+    zpl_isize cap;    //< 0 for borrowed buffers, they're never written in place
+    zpl_i64 offset;   //< stream offset of data[0]
+} zpl__rope_chunk;
+
+typedef struct {
+    zpl_u8 magic;
+    zpl_allocator alloc;
+    zpl__rope_chunk *chunks; //< zpl_array, only the descriptors move when it grows
+    zpl_isize chunk_size;
+    zpl_isize hint;          //< last chunk looked up, sequential access stays O(1)
+    zpl_i64 size;
+    zpl_i64 cursor;
+} zpl__rope_fd;
+
+#define ZPL__FILE_ROPE_FD_MAGIC 47
+
+zpl_internal zpl__rope_fd *zpl__file_rope_from_fd(zpl_file_descriptor fd) {
+    zpl__rope_fd *d = (zpl__rope_fd*)fd.p;
+    ZPL_ASSERT(d->magic == ZPL__FILE_ROPE_FD_MAGIC);
+    return d;
+}
+
+zpl_internal zpl_isize zpl__file_rope_find(zpl__rope_fd *d, zpl_i64 offset) {
+    zpl_isize lo = 0, hi = zpl_array_count(d->chunks) - 1;
+    zpl__rope_chunk *c = d->chunks + d->hint;
+    if (d->hint <= hi && offset >= c->offset && offset < c->offset + c->len) return d->hint;
+    if (d->hint < hi && offset >= c[1].offset && offset < c[1].offset + c[1].len) return ++d->hint;
+
+    while (lo < hi) {
+        zpl_isize mid = lo + (hi - lo + 1) / 2;
+        if (d->chunks[mid].offset <= offset) lo = mid;
+        else hi = mid - 1;
+    }
+    return d->hint = lo;
+}
+
+zpl_internal zpl__rope_chunk *zpl__file_rope_push(zpl__rope_fd *d, zpl_u8 *data, zpl_isize cap) {
+    zpl__rope_chunk c = {0};
+    c.data = data;
+    c.cap = cap;
+    c.offset = d->size;
+    if (!zpl_array_append(d->chunks, c)) return NULL;
+    return &zpl_array_back(d->chunks);
+}
+
+zpl_b8 zpl_file_rope_new(zpl_file *file, zpl_allocator allocator, zpl_isize chunk_size) {
+    ZPL_ASSERT_NOT_NULL(file);
+    zpl__rope_fd *d = (zpl__rope_fd*)zpl_alloc(allocator, zpl_size_of(zpl__rope_fd));
+    if (!d) return false;
+    zpl_zero_item(d);
+    d->magic = ZPL__FILE_ROPE_FD_MAGIC;
+    d->alloc = allocator;
+    d->chunk_size = (chunk_size > 0) ? chunk_size : ZPL_FILE_ROPE_CHUNK_SIZE;
+    if (!zpl_array_init(d->chunks, allocator)) {
+        zpl_free(allocator, d);
+        return false;
+    }
+    zpl_zero_item(file);
+    file->ops = zpl_rope_file_operations;
+    file->fd.p = cast(void *)d;
+    file->is_temp = true;
+    return true;
+}
+
+zpl_b32 zpl_file_rope_append_ref(zpl_file *file, void const *buffer, zpl_isize size) {
+    ZPL_ASSERT_NOT_NULL(file);
+    zpl__rope_fd *d = zpl__file_rope_from_fd(file->fd);
+    zpl__rope_chunk *c;
+    if (size <= 0) return true;
+    c = zpl__file_rope_push(d, cast(zpl_u8 *)buffer, 0);
+    if (!c) return false;
+    c->len = size;
+    d->size += size;
+    d->cursor = d->size;
+    return true;
+}
+
+zpl_isize zpl_file_rope_iovec(zpl_file *file, zpl_file_iovec *iov, zpl_isize count) {
+    ZPL_ASSERT_NOT_NULL(file);
+    zpl__rope_fd *d = zpl__file_rope_from_fd(file->fd);
+    zpl_isize total = zpl_array_count(d->chunks);
+    if (iov) {
+        for (zpl_isize i = 0; i < zpl_min(count, total); i++) {
+            iov[i].data = d->chunks[i].data;
+            iov[i].size = d->chunks[i].len;
+        }
+    }
+    return total;
+}
+
+zpl_b32 zpl_file_rope_write_to(zpl_file *file, zpl_file *dest) {
+    ZPL_ASSERT_NOT_NULL(file);
+    ZPL_ASSERT_NOT_NULL(dest);
+    zpl__rope_fd *d = zpl__file_rope_from_fd(file->fd);
+    zpl_file_iovec batch[64];
+    zpl_isize total = zpl_array_count(d->chunks);
+
+    for (zpl_isize i = 0; i < total; i += zpl_count_of(batch)) {
+        zpl_isize n = zpl_min(total - i, zpl_count_of(batch));
+        for (zpl_isize j = 0; j < n; j++) {
+            batch[j].data = d->chunks[i + j].data;
+            batch[j].size = d->chunks[i + j].len;
+        }
+        if (!zpl_file_writev(dest, batch, n)) return false;
+    }
+    return true;
+}
+
+zpl_internal ZPL_FILE_SEEK_PROC(zpl__rope_file_seek) {
+    zpl__rope_fd *d = zpl__file_rope_from_fd(fd);
+
+    if (whence == ZPL_SEEK_WHENCE_BEGIN)
+        d->cursor = 0;
+    else if (whence == ZPL_SEEK_WHENCE_END)
+        d->cursor = d->size;
+
+    d->cursor = zpl_clamp(d->cursor + offset, 0, d->size);
+    if (new_offset) *new_offset = d->cursor;
+    return true;
+}
+
+zpl_internal ZPL_FILE_READ_AT_PROC(zpl__rope_file_read) {
+    zpl_unused(stop_at_newline);
+    zpl__rope_fd *d = zpl__file_rope_from_fd(fd);
+    zpl_isize done = 0;
+
+    if (offset < 0 || offset > d->size) return false;
+    size = cast(zpl_isize)zpl_min(size, d->size - offset);
+
+    while (done < size) {
+        zpl__rope_chunk *c = d->chunks + zpl__file_rope_find(d, offset + done);
+        zpl_isize at = cast(zpl_isize)(offset + done - c->offset);
+        zpl_isize n = zpl_min(size - done, c->len - at);
+        zpl_memcopy(cast(zpl_u8 *)buffer + done, c->data + at, n);
+        done += n;
+    }
+
+    if (bytes_read) *bytes_read = done;
+    return true;
+}
+
+zpl_internal ZPL_FILE_WRITE_AT_PROC(zpl__rope_file_write) {
+    zpl__rope_fd *d = zpl__file_rope_from_fd(fd);
+    zpl_u8 const *src = cast(zpl_u8 const *)buffer;
+    zpl_isize done = 0;
+
+    if (offset < 0 || offset > d->size) return false;
+
+    /* overwrite the existing data in place, borrowed chunks get copied first */
+    while (done < size && offset + done < d->size) {
+        zpl__rope_chunk *c = d->chunks + zpl__file_rope_find(d, offset + done);
+        zpl_isize at = cast(zpl_isize)(offset + done - c->offset);
+        zpl_isize n = zpl_min(size - done, c->len - at);
+        if (c->cap == 0) {
+            zpl_u8 *copy = cast(zpl_u8 *)zpl_alloc(d->alloc, c->len);
+            if (!copy) return false;
+            zpl_memcopy(copy, c->data, c->len);
+            c->data = copy;
+            c->cap = c->len;
+        }
+        zpl_memcopy(c->data + at, src + done, n);
+        done += n;
+    }
+
+    /* append the rest, filling the tail chunk before starting a new one */
+    while (done < size) {
+        zpl__rope_chunk *c = zpl_array_count(d->chunks) ? &zpl_array_back(d->chunks) : NULL;
+        zpl_isize n;
+        if (!c || c->len >= c->cap) {
+            zpl_isize cap = zpl_max(d->chunk_size, size - done);
+            zpl_u8 *data = cast(zpl_u8 *)zpl_alloc(d->alloc, cap);
+            if (!data) return false;
+            c = zpl__file_rope_push(d, data, cap);
+            if (!c) {
+                zpl_free(d->alloc, data);
+                return false;
+            }
+        }
+        n = zpl_min(size - done, c->cap - c->len);
+        zpl_memcopy(c->data + c->len, src + done, n);
+        c->len += n;
+        d->size += n;
+        done += n;
+    }
+
+    if (bytes_written) *bytes_written = done;
+    return true;
+}
+
+zpl_internal ZPL_FILE_CLOSE_PROC(zpl__rope_file_close) {
+    zpl__rope_fd *d = zpl__file_rope_from_fd(fd);
+    zpl_allocator alloc = d->alloc;
+    for (zpl_isize i = 0; i < zpl_array_count(d->chunks); i++) {
+        if (d->chunks[i].cap > 0) zpl_free(alloc, d->chunks[i].data);
+    }
+    zpl_array_free(d->chunks);
+    zpl_free(alloc, d);
+}
+
+zpl_file_operations const zpl_rope_file_operations = { zpl__rope_file_read, zpl__rope_file_write,
+    zpl__rope_file_seek, zpl__rope_file_close };
+
 ZPL_END_C_DECLS
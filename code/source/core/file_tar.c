@@ -11,9 +11,21 @@ typedef struct {
   char checksum[8];
   char type;
   char linkname[100];
-  char _padding[255];
+  char magic[6];
+  char version[2];
+  char uname[32];
+  char gname[32];
+  char devmajor[8];
+  char devminor[8];
+  char prefix[155];
+  char _padding[12];
 } zpl__tar_header;
 
+#define ZPL__TAR_BLOCK_SIZE 512
+#define ZPL__TAR_MAX_OCTAL_SIZE 077777777777ll
+
+zpl_global zpl_u8 const zpl__tar_zero_block[ZPL__TAR_BLOCK_SIZE] = {0};
+
 zpl_internal zpl_usize zpl__tar_checksum(zpl__tar_header *hr) {
     zpl_usize i;
     zpl_usize res = 256;
@@ -25,85 +37,292 @@ zpl_internal zpl_usize zpl__tar_checksum(zpl__tar_header *hr) {
     return res;
 }
 
-zpl_internal zpl_b32 zpl__tar_write_null(zpl_file *archive, zpl_isize cnt) {
-    char *out = zpl_bprintf("%*r", cnt, '\0');
-    if (!zpl_file_write(archive, out, cnt))
-        return 0;
+zpl_internal zpl_b32 zpl__tar_write_null(zpl_file *archive, zpl_i64 cnt) {
+    while (cnt > 0) {
+        zpl_isize n = cast(zpl_isize)zpl_min(cnt, ZPL__TAR_BLOCK_SIZE);
+        if (!zpl_file_write(archive, zpl__tar_zero_block, n))
+            return 0;
+        cnt -= n;
+    }
     return 1;
 }
 
-zpl_isize zpl_tar_pack(zpl_file *archive, char const **paths, zpl_isize paths_len) {
-    ZPL_ASSERT_NOT_NULL(archive);
-    ZPL_ASSERT_NOT_NULL(paths);
+/* zero padded octal digits followed by a terminator */
+zpl_internal void zpl__tar_octal(char *field, zpl_isize width, zpl_u64 value) {
+    field[width - 1] = 0;
+    for (zpl_isize i = width - 2; i >= 0; i--) {
+        field[i] = cast(char)('0' + (value & 7));
+        value >>= 3;
+    }
+}
 
-    for (zpl_isize i = 0; i < paths_len; i++) {
-        ZPL_ASSERT_NOT_NULL(paths[i]);
-        zpl__tar_header hr = {0};
-        zpl_file file;
-        zpl_file_error ferr = zpl_file_open_mode(&file, ZPL_FILE_MODE_READ, paths[i]);
-        if (ferr == ZPL_FILE_ERROR_NOT_EXISTS) {
-            return -(ZPL_TAR_ERROR_FILE_NOT_FOUND);
-        } else if (ferr != ZPL_FILE_ERROR_NONE) {
-            return -(ZPL_TAR_ERROR_IO_ERROR);
+zpl_internal void zpl__tar_set_size(zpl__tar_header *hr, zpl_i64 size) {
+    if (size <= ZPL__TAR_MAX_OCTAL_SIZE) {
+        zpl__tar_octal(hr->size, zpl_size_of(hr->size), cast(zpl_u64)size);
+        return;
+    }
+
+    /* GNU base-256 encoding, the PAX header carries the size for everyone else */
+    zpl_memset(hr->size, 0, zpl_size_of(hr->size));
+    for (zpl_isize i = zpl_size_of(hr->size) - 1; i > 0 && size > 0; i--) {
+        hr->size[i] = cast(char)(size & 0xFF);
+        size >>= 8;
+    }
+    hr->size[0] = cast(char)0x80;
+}
+
+zpl_internal zpl_i64 zpl__tar_get_size(zpl__tar_header *hr) {
+    char digits[13] = {0};
+    if (cast(zpl_u8)hr->size[0] & 0x80) {
+        zpl_i64 size = 0;
+        for (zpl_isize i = 1; i < zpl_size_of(hr->size); i++)
+            size = (size << 8) | cast(zpl_u8)hr->size[i];
+        return size;
+    }
+    zpl_memcopy(digits, hr->size, zpl_size_of(hr->size));
+    return zpl_str_to_i64(digits, 0, 8);
+}
+
+zpl_internal zpl_b32 zpl__tar_write_header(zpl_file *archive, char const *name, zpl_isize name_len, char const *prefix, zpl_isize prefix_len, zpl_i64 size, zpl_u64 mtime, char type) {
+    zpl__tar_header hr = {0};
+    zpl_memcopy(hr.name, name, zpl_min(name_len, zpl_size_of(hr.name)));
+    if (prefix_len > 0) zpl_memcopy(hr.prefix, prefix, prefix_len);
+    zpl__tar_octal(hr.mode, zpl_size_of(hr.mode), 0664);
+    zpl__tar_octal(hr.owner, zpl_size_of(hr.owner), 0);
+    zpl__tar_octal(hr.group, zpl_size_of(hr.group), 0);
+    zpl__tar_set_size(&hr, size);
+    zpl__tar_octal(hr.mtime, zpl_size_of(hr.mtime), mtime);
+    hr.type = type;
+    zpl_memcopy(hr.magic, "ustar", 6);
+    zpl_memcopy(hr.version, "00", 2);
+    zpl__tar_octal(hr.checksum, zpl_size_of(hr.checksum) - 1, zpl__tar_checksum(&hr));
+    hr.checksum[7] = ' ';
+
+    return zpl_file_write(archive, cast(void*)(&hr), zpl_size_of(zpl__tar_header));
+}
+
+zpl_internal zpl_string zpl__tar_pax_append(zpl_string pax, char const *key, char const *value) {
+    zpl_isize len = zpl_strlen(key) + zpl_strlen(value) + 3; /* ' ', '=' and '\n' */
+    zpl_isize digits = 1;
+
+    /* the record length counts its own digits */
+    for (;;) {
+        zpl_isize n = len + digits, d = 1;
+        while (n >= 10) { n /= 10; d++; }
+        if (d <= digits) break;
+        digits = d;
+    }
+
+    return zpl_string_append_fmt(pax, "%td %s=%s\n", len + digits, key, value);
+}
+
+/* emits the ustar header for path, preceded by a PAX header when the path or size won't fit */
+zpl_internal zpl_b32 zpl__tar_write_entry_header(zpl_file *archive, char const *path, zpl_i64 size, zpl_u64 mtime) {
+    zpl_isize len = zpl_strlen(path);
+    zpl_isize split = 0;
+    zpl_b32 pax_path = false;
+    zpl_b32 pax_size = size > ZPL__TAR_MAX_OCTAL_SIZE;
+
+    if (len > 100) {
+        /* ustar splits long paths at a separator into a 155 byte prefix and a 100 byte name */
+        for (zpl_isize i = zpl_min(len - 1, 155); i > 0 && len - i - 1 <= 100; i--) {
+            if (path[i] == '/') { split = i; break; }
         }
+        pax_path = (split == 0);
+    }
 
-        zpl_i64 file_size = zpl_file_size(&file);
-        zpl_snprintf(hr.name, 12, "%s", paths[i]);
-        zpl_snprintf(hr.size, 12, "%o", file_size);
-        zpl_snprintf(hr.mode, 8, "%o", 0664);
-        zpl_snprintf(hr.mtime, 12, "%o", zpl_fs_last_write_time(paths[i]));
-        hr.type = ZPL_TAR_TYPE_REGULAR;
-        zpl_snprintf(hr.checksum, 8, "%o", zpl__tar_checksum(&hr));
-
-        zpl_file_write(archive, cast(void*)(&hr), zpl_size_of(zpl__tar_header));
-
-        // write data
-        {
-            zpl_i64 remaining_data = file_size;
-            zpl_i64 total_data = zpl_align_forward_i64(remaining_data, 512);
-            zpl_i64 padding = (total_data-file_size);
-            char buf[4096] = {0};
-            zpl_i64 pos = 0;
-            zpl_isize bytes_read = 0;
-            do {
-                if (!zpl_file_read_at_check(&file, buf, 4096, pos, &bytes_read)) {
-                    zpl_file_close(&file);
-                    return -(ZPL_TAR_ERROR_IO_ERROR);
-                } else if (bytes_read == 0) {
-                    break;
-                }
-
-                zpl_file_write(archive, buf, bytes_read);
-                pos += bytes_read;
-                remaining_data -= bytes_read;
-            }
-            while (remaining_data > 0);
+    if (pax_path || pax_size) {
+        zpl_string pax = zpl_string_make_reserve(zpl_heap(), len + 64);
+        zpl_b32 ok;
+        if (pax_path) pax = zpl__tar_pax_append(pax, "path", path);
+        if (pax_size) pax = zpl__tar_pax_append(pax, "size", zpl_bprintf("%lld", cast(long long)size));
+
+        ok = zpl__tar_write_header(archive, "././@PaxHeader", 14, NULL, 0, zpl_string_length(pax), mtime, ZPL_TAR_TYPE_PAX)
+          && zpl_file_write(archive, pax, zpl_string_length(pax))
+          && zpl__tar_write_null(archive, zpl_align_forward_i64(zpl_string_length(pax), ZPL__TAR_BLOCK_SIZE) - zpl_string_length(pax));
+        zpl_string_free(pax);
+        if (!ok) return false;
+    }
+
+    if (split > 0)
+        return zpl__tar_write_header(archive, path + split + 1, len - split - 1, path, split, size, mtime, ZPL_TAR_TYPE_REGULAR);
+    return zpl__tar_write_header(archive, path, len, NULL, 0, size, mtime, ZPL_TAR_TYPE_REGULAR);
+}
 
-            if (padding > 0) {
-                if (!zpl__tar_write_null(archive, padding)) {
-                    zpl_file_close(&file);
-                    return -(ZPL_TAR_ERROR_IO_ERROR);
-                }
+#if defined(ZPL__FS_COPY_SEGMENT)
+/* in-kernel copy between two OS files, holes in the source stay holes in the archive when we append */
+zpl_internal zpl_b32 zpl__tar_copy_native(zpl_file *archive, zpl_file *file, zpl_i64 size, zpl_u8 *buffer, zpl_b32 *handled) {
+    int in = cast(int)file->fd.i, out = cast(int)archive->fd.i;
+    zpl_u8 method = ZPL__FS_COPY_METHOD_FIRST;
+    zpl_i64 offset = zpl_file_tell(archive);
+    zpl_i64 end = offset + zpl_align_forward_i64(size, ZPL__TAR_BLOCK_SIZE);
+    zpl_i64 pos = 0, copied = 0;
+    zpl_b32 sparse;
+    struct stat st;
+    int flags = fcntl(out, F_GETFL);
+
+    *handled = false;
+    if (flags < 0 || (flags & O_APPEND) || fstat(out, &st) != 0) return false;
+    *handled = true;
+    sparse = st.st_size <= offset;
+
+    while (pos < size) {
+        zpl_i64 data = pos, hole = size;
+#    if defined(SEEK_DATA) && defined(SEEK_HOLE)
+        if (sparse) {
+            data = lseek(in, pos, SEEK_DATA);
+            if (data < 0) {
+                if (errno == ENXIO) break;
+                data = pos;
+            } else {
+                hole = lseek(in, data, SEEK_HOLE);
+                if (hole < 0 || hole > size) hole = size;
             }
+            if (data >= size) break;
         }
+#    endif
+        if (!zpl__fs_copy_segment(in, data, out, offset + data, hole - data, &method, buffer, &copied))
+            return false;
+        pos = hole;
+    }
 
-        zpl_file_close(&file);
+    if (sparse) {
+        /* skipped ranges and the padding read back as zeros once the archive is extended */
+        if (ftruncate(out, end) != 0) return false;
+    } else {
+        zpl_file_seek(archive, offset + copied);
+        if (!zpl__tar_write_null(archive, end - offset - copied)) return false;
     }
 
-    if (!zpl__tar_write_null(archive, zpl_size_of(zpl__tar_header) * 2)) {
+    zpl_file_seek(archive, end);
+    return true;
+}
+#endif
+
+zpl_internal zpl_isize zpl__tar_pack_file(zpl_file *archive, char const *path, zpl_u8 *buffer) {
+    zpl_file file;
+    zpl_i64 file_size;
+    zpl_b32 handled = false, ok = false;
+    zpl_file_error ferr = zpl_file_open_mode(&file, ZPL_FILE_MODE_READ, path);
+    if (ferr == ZPL_FILE_ERROR_NOT_EXISTS) {
+        return -(ZPL_TAR_ERROR_FILE_NOT_FOUND);
+    } else if (ferr != ZPL_FILE_ERROR_NONE) {
         return -(ZPL_TAR_ERROR_IO_ERROR);
     }
 
+    file_size = zpl_file_size(&file);
+    if (!zpl__tar_write_entry_header(archive, path, file_size, zpl_fs_last_write_time(path))) {
+        zpl_file_close(&file);
+        return -(ZPL_TAR_ERROR_IO_ERROR);
+    }
+
+#if defined(ZPL__FS_COPY_SEGMENT)
+    if (archive->ops.write_at == zpl_default_file_operations.write_at && file.ops.read_at == zpl_default_file_operations.read_at) {
+        ok = zpl__tar_copy_native(archive, &file, file_size, buffer, &handled);
+    }
+#endif
+
+    if (!handled) {
+        zpl_i64 pos = 0;
+        ok = true;
+        while (ok && pos < file_size) {
+            zpl_isize bytes_read = 0;
+            zpl_isize chunk = cast(zpl_isize)zpl_min(file_size - pos, ZPL_TAR_BUFFER_SIZE);
+            if (!zpl_file_read_at_check(&file, buffer, chunk, pos, &bytes_read)) {
+                ok = false;
+            } else if (bytes_read == 0) {
+                break;
+            } else {
+                ok = zpl_file_write(archive, buffer, bytes_read);
+                pos += bytes_read;
+            }
+        }
+
+        /* pads to the block boundary, also covers a file that shrank while being read */
+        ok = ok && zpl__tar_write_null(archive, zpl_align_forward_i64(file_size, ZPL__TAR_BLOCK_SIZE) - pos);
+    }
+
+    zpl_file_close(&file);
+    return ok ? 0 : -(ZPL_TAR_ERROR_IO_ERROR);
+}
+
+zpl_internal zpl_u8 *zpl__tar_alloc_buffer(void) {
+    return cast(zpl_u8 *)zpl_alloc_align(zpl_heap(), zpl_max(ZPL_TAR_BUFFER_SIZE, ZPL_FILE_BUFFER_SIZE), 4096);
+}
+
+zpl_internal zpl_isize zpl__tar_finish(zpl_file *archive, zpl_u8 *buffer, zpl_isize err) {
+    zpl_free(zpl_heap(), buffer);
+    if (err != 0)
+        return err;
+    if (!zpl__tar_write_null(archive, zpl_size_of(zpl__tar_header) * 2))
+        return -(ZPL_TAR_ERROR_IO_ERROR);
     return 0;
 }
 
+zpl_isize zpl_tar_pack(zpl_file *archive, char const **paths, zpl_isize paths_len) {
+    ZPL_ASSERT_NOT_NULL(archive);
+    ZPL_ASSERT_NOT_NULL(paths);
+
+    zpl_u8 *buffer = zpl__tar_alloc_buffer();
+    zpl_isize err = 0;
+
+    for (zpl_isize i = 0; i < paths_len && err == 0; i++) {
+        ZPL_ASSERT_NOT_NULL(paths[i]);
+        err = zpl__tar_pack_file(archive, paths[i], buffer);
+    }
+
+    return zpl__tar_finish(archive, buffer, err);
+}
+
+typedef struct {
+    zpl_file *archive;
+    zpl_u8 *buffer;
+    zpl_isize err;
+} zpl__tar_pack_walker;
+
+zpl_internal zpl_b32 zpl__tar_pack_walk_proc(zpl_dir_walk_entry const *entry, void *user_data) {
+    zpl__tar_pack_walker *w = cast(zpl__tar_pack_walker *)user_data;
+    w->err = zpl__tar_pack_file(w->archive, entry->path, w->buffer);
+    return w->err == 0;
+}
+
 zpl_isize zpl_tar_pack_dir(zpl_file *archive, char const *path, zpl_allocator alloc) {
-    zpl_string filelst = zpl_path_dirlist(alloc, path, true);
-    char const **files = cast(char const**)zpl_str_split_lines(alloc, filelst, false);
-    zpl_isize err = zpl_tar_pack(archive, files, zpl_array_count(files));
-    zpl_string_free(filelst);
-    zpl_array_free(files);
-    return err;
+    ZPL_ASSERT_NOT_NULL(archive);
+    ZPL_ASSERT_NOT_NULL(path);
+
+    zpl__tar_pack_walker w = {0};
+    zpl_dir_walk_opts opts = {0};
+    w.archive = archive;
+    w.buffer = zpl__tar_alloc_buffer();
+    opts.flags = ZPL_DIR_WALK_FILES | ZPL_DIR_WALK_HIDDEN;
+    opts.max_depth = -1;
+    opts.allocator = alloc;
+
+    /* files are packed as the walk finds them, no listing is built upfront */
+    if (!zpl_path_walk(path, &opts, zpl__tar_pack_walk_proc, &w) && w.err == 0)
+        w.err = -(ZPL_TAR_ERROR_FILE_NOT_FOUND);
+
+    return zpl__tar_finish(archive, w.buffer, w.err);
+}
+
+/* applies the records of a PAX extended header we care about to the next entry */
+zpl_internal void zpl__tar_parse_pax(char *payload, zpl_i64 size, zpl_string *long_path, zpl_i64 *long_size) {
+    char *p = payload, *end = payload + size;
+    while (p < end) {
+        char *kv = NULL;
+        zpl_i64 len = zpl_str_to_i64(p, &kv, 10);
+        if (len <= 0 || p + len > end || *kv != ' ')
+            break;
+        kv++;
+        p[len - 1] = 0;
+
+        if (!zpl_strncmp(kv, "path=", 5))
+            *long_path = zpl_string_set(*long_path, kv + 5);
+        else if (!zpl_strncmp(kv, "size=", 5))
+            *long_size = zpl_str_to_i64(kv + 5, NULL, 10);
+
+        p += len;
+    }
 }
 
 zpl_isize zpl_tar_unpack(zpl_file *archive, zpl_tar_unpack_proc *unpack_proc, void *user_data) {
@@ -113,6 +332,9 @@ zpl_isize zpl_tar_unpack(zpl_file *archive, zpl_tar_unpack_proc *unpack_proc, vo
     zpl_i64 pos = zpl_file_tell(archive);
     zpl__tar_header hr = {0};
     zpl_isize err = ZPL_TAR_ERROR_NONE;
+    zpl_string long_path = zpl_string_make_reserve(zpl_heap(), 0);
+    zpl_i64 long_size = -1;
+    char name[zpl_size_of(hr.prefix) + zpl_size_of(hr.name) + 2];
 
     do {
         if (!zpl_file_read(archive, cast(void*)&hr, zpl_size_of(hr))) {
@@ -126,16 +348,56 @@ zpl_isize zpl_tar_unpack(zpl_file *archive, zpl_tar_unpack_proc *unpack_proc, vo
 
         zpl_tar_record rec = {0};
         rec.type = hr.type;
-        rec.path = hr.name;
+        rec.path = name;
         rec.offset = pos;
-        rec.length = zpl_str_to_i64(hr.size, 0, 8);
+        rec.length = zpl__tar_get_size(&hr);
         rec.error = ZPL_TAR_ERROR_NONE;
 
         zpl_usize checksum1 = cast(zpl_usize)(zpl_str_to_i64(hr.checksum, 0, 8));
         zpl_usize checksum2 = zpl__tar_checksum(&hr);
         rec.error = (checksum1 != checksum2) ? cast(zpl_isize)ZPL_TAR_ERROR_BAD_CHECKSUM : rec.error;
 
-        rec.error = unpack_proc(archive, &rec, user_data);
+        /* extended headers describe the entry that follows them */
+        if (rec.error == ZPL_TAR_ERROR_NONE && (hr.type == ZPL_TAR_TYPE_PAX || hr.type == ZPL_TAR_TYPE_GNU_LONGNAME)) {
+            char *payload = cast(char *)zpl_alloc(zpl_heap(), rec.length + 1);
+            if (!zpl_file_read(archive, payload, rec.length)) {
+                zpl_free(zpl_heap(), payload);
+                err = ZPL_TAR_ERROR_IO_ERROR;
+                break;
+            }
+            payload[rec.length] = 0;
+
+            if (hr.type == ZPL_TAR_TYPE_PAX)
+                zpl__tar_parse_pax(payload, rec.length, &long_path, &long_size);
+            else
+                long_path = zpl_string_set(long_path, payload);
+
+            zpl_free(zpl_heap(), payload);
+            zpl_file_seek(archive, pos + zpl_align_forward_i64(rec.length, 512));
+            continue;
+        }
+
+        if (zpl_string_length(long_path) > 0) {
+            rec.path = long_path;
+        } else {
+            zpl_isize len = 0;
+            if (!zpl_strncmp(hr.magic, "ustar", 5) && hr.prefix[0]) {
+                len = zpl_strnlen(hr.prefix, zpl_size_of(hr.prefix));
+                zpl_memcopy(name, hr.prefix, len);
+                name[len++] = '/';
+            }
+            zpl_isize name_len = zpl_strnlen(hr.name, zpl_size_of(hr.name));
+            zpl_memcopy(name + len, hr.name, name_len);
+            name[len + name_len] = 0;
+        }
+        if (long_size >= 0) rec.length = long_size;
+
+        if (hr.type != ZPL_TAR_TYPE_PAX_GLOBAL) {
+            rec.error = unpack_proc(archive, &rec, user_data);
+        }
+
+        zpl_string_clear(long_path);
+        long_size = -1;
 
         if (rec.error > 0) {
             err = ZPL_TAR_ERROR_INTERRUPTED;
@@ -147,6 +409,7 @@ zpl_isize zpl_tar_unpack(zpl_file *archive, zpl_tar_unpack_proc *unpack_proc, vo
     }
     while(err == ZPL_TAR_ERROR_NONE);
 
+    zpl_string_free(long_path);
     return -(err);
 }
 
@@ -164,20 +427,10 @@ ZPL_TAR_UNPACK_PROC(zpl_tar_default_list_file) {
     return 0;
 }
 
-ZPL_TAR_UNPACK_PROC(zpl_tar_default_unpack_file) {
-    if (file->error != ZPL_TAR_ERROR_NONE)
-        return 0; /* skip file */
-
-    if (file->type != ZPL_TAR_TYPE_REGULAR)
-        return 0; /* we only care about regular files */
-
-    if (!zpl_strncmp(file->path, "..", 2))
-        return 0;
-
-    char tmp[ZPL_MAX_PATH] = {0};
-    char *base_path = cast(char*)user_data;
+/* builds the destination path below base_path and creates its parent folders */
+zpl_internal void zpl__tar_dest_path(char *tmp, char const *base_path, char const *path) {
     zpl_isize base_len = zpl_strlen(base_path);
-    zpl_isize len = zpl_strlen(file->path);
+    zpl_isize len = zpl_strlen(path);
     ZPL_ASSERT(base_len+len-2 < ZPL_MAX_PATH); /* todo: account for missing leading path sep */
 
     zpl_strcpy(tmp, base_path);
@@ -187,7 +440,7 @@ ZPL_TAR_UNPACK_PROC(zpl_tar_default_unpack_file) {
         char sep[2] = {ZPL_PATH_SEPARATOR, 0};
         zpl_strcat(tmp, sep);
     }
-    zpl_strcat(tmp, file->path);
+    zpl_strcat(tmp, path);
     zpl_path_fix_slashes(tmp);
 
     const char *last_slash = zpl_char_last_occurence(tmp, ZPL_PATH_SEPARATOR);
@@ -198,9 +451,11 @@ ZPL_TAR_UNPACK_PROC(zpl_tar_default_unpack_file) {
         zpl_path_mkdir_recursive(tmp, 0755);
         tmp[i] = ZPL_PATH_SEPARATOR;
     }
+}
 
+zpl_internal zpl_isize zpl__tar_extract_stream(zpl_file *archive, zpl_tar_record *file, char const *dest) {
     zpl_file f;
-    zpl_file_create(&f, tmp);
+    zpl_file_create(&f, dest);
     {
         char buf[4096] = {0};
         zpl_isize remaining_data = file->length;
@@ -223,3 +478,322 @@ ZPL_TAR_UNPACK_PROC(zpl_tar_default_unpack_file) {
     zpl_file_close(&f);
     return 0;
 }
+
+ZPL_TAR_UNPACK_PROC(zpl_tar_default_unpack_file) {
+    if (file->error != ZPL_TAR_ERROR_NONE)
+        return 0; /* skip file */
+
+    if (file->type != ZPL_TAR_TYPE_REGULAR)
+        return 0; /* we only care about regular files */
+
+    if (!zpl_strncmp(file->path, "..", 2))
+        return 0;
+
+    char tmp[ZPL_MAX_PATH] = {0};
+    zpl__tar_dest_path(tmp, cast(char*)user_data, file->path);
+    return zpl__tar_extract_stream(archive, file, tmp);
+}
+
+ZPL_TABLE_DEFINE(zpl_tar_index_map, zpl_tar_index_map_, zpl_isize);
+
+zpl_internal zpl_u64 zpl__tar_path_hash(char const *path) {
+    return ZPL_TABLE_HASH(path, zpl_strlen(path));
+}
+
+zpl_internal ZPL_TAR_UNPACK_PROC(zpl__tar_index_proc) {
+    zpl_unused(archive);
+    zpl_tar_index *index = cast(zpl_tar_index *)user_data;
+    zpl_tar_entry entry = {0};
+    zpl_u64 hash;
+    zpl_isize *head;
+
+    if (file->error != ZPL_TAR_ERROR_NONE)
+        return 0;
+
+    hash = zpl__tar_path_hash(file->path);
+    head = zpl_tar_index_map_get(&index->map, hash);
+    entry.path = zpl_alloc_str(index->allocator, file->path);
+    entry.offset = file->offset;
+    entry.length = file->length;
+    entry.type = file->type;
+    entry.next = head ? *head : -1;
+
+    /* newest entry heads the chain so it shadows older copies of the same path */
+    zpl_tar_index_map_set(&index->map, hash, zpl_array_count(index->entries));
+    zpl_array_append(index->entries, entry);
+    return 0;
+}
+
+zpl_isize zpl_tar_index_init(zpl_tar_index *index, zpl_file *archive, zpl_allocator alloc) {
+    ZPL_ASSERT_NOT_NULL(index);
+    ZPL_ASSERT_NOT_NULL(archive);
+
+    index->allocator = alloc;
+    zpl_array_init(index->entries, alloc);
+    zpl_tar_index_map_init(&index->map, alloc);
+
+    zpl_file_seek(archive, 0);
+    return zpl_tar_unpack(archive, zpl__tar_index_proc, index);
+}
+
+void zpl_tar_index_free(zpl_tar_index *index) {
+    ZPL_ASSERT_NOT_NULL(index);
+    for (zpl_isize i = 0; i < zpl_array_count(index->entries); i++)
+        zpl_free(index->allocator, index->entries[i].path);
+    zpl_array_free(index->entries);
+    zpl_tar_index_map_destroy(&index->map);
+}
+
+zpl_tar_entry *zpl_tar_index_find(zpl_tar_index *index, char const *path) {
+    ZPL_ASSERT_NOT_NULL(index);
+    ZPL_ASSERT_NOT_NULL(path);
+    zpl_isize *head = zpl_tar_index_map_get(&index->map, zpl__tar_path_hash(path));
+    for (zpl_isize i = head ? *head : -1; i >= 0; i = index->entries[i].next) {
+        if (!zpl_strcmp(index->entries[i].path, path))
+            return index->entries + i;
+    }
+    return NULL;
+}
+
+/* read-only view over an entry's bytes */
+
+typedef struct {
+    zpl_u8 magic;
+    zpl_file *archive;
+    zpl_i64 base;
+    zpl_i64 length;
+    zpl_i64 cursor;
+    zpl_allocator alloc;
+} zpl__tar_entry_fd;
+
+#define ZPL__TAR_ENTRY_FD_MAGIC 43
+
+zpl_internal zpl__tar_entry_fd *zpl__tar_entry_from_fd(zpl_file_descriptor fd) {
+    zpl__tar_entry_fd *d = cast(zpl__tar_entry_fd *)fd.p;
+    ZPL_ASSERT(d->magic == ZPL__TAR_ENTRY_FD_MAGIC);
+    return d;
+}
+
+zpl_internal ZPL_FILE_SEEK_PROC(zpl__tar_entry_seek) {
+    zpl__tar_entry_fd *d = zpl__tar_entry_from_fd(fd);
+
+    if (whence == ZPL_SEEK_WHENCE_BEGIN)
+        d->cursor = 0;
+    else if (whence == ZPL_SEEK_WHENCE_END)
+        d->cursor = d->length;
+
+    d->cursor = zpl_clamp(d->cursor + offset, 0, d->length);
+    if (new_offset) *new_offset = d->cursor;
+    return true;
+}
+
+zpl_internal ZPL_FILE_READ_AT_PROC(zpl__tar_entry_read) {
+    zpl__tar_entry_fd *d = zpl__tar_entry_from_fd(fd);
+    zpl_file *archive = d->archive;
+    if (offset < 0 || offset >= d->length) {
+        if (bytes_read) *bytes_read = 0;
+        return offset >= 0;
+    }
+    size = cast(zpl_isize)zpl_min(size, d->length - offset);
+    return archive->ops.read_at(archive->fd, buffer, size, d->base + offset, bytes_read, stop_at_newline);
+}
+
+zpl_internal ZPL_FILE_WRITE_AT_PROC(zpl__tar_entry_write) {
+    zpl_unused(fd);
+    zpl_unused(buffer);
+    zpl_unused(size);
+    zpl_unused(offset);
+    zpl_unused(bytes_written);
+    return false;
+}
+
+zpl_internal ZPL_FILE_CLOSE_PROC(zpl__tar_entry_close) {
+    zpl__tar_entry_fd *d = zpl__tar_entry_from_fd(fd);
+    zpl_free(d->alloc, d);
+}
+
+zpl_global zpl_file_operations const zpl__tar_entry_file_operations = { zpl__tar_entry_read, zpl__tar_entry_write,
+    zpl__tar_entry_seek, zpl__tar_entry_close };
+
+zpl_file_error zpl_tar_open_entry(zpl_file *file, zpl_file *archive, zpl_tar_entry const *entry, zpl_allocator alloc) {
+    ZPL_ASSERT_NOT_NULL(file);
+    ZPL_ASSERT_NOT_NULL(archive);
+    ZPL_ASSERT_NOT_NULL(entry);
+
+    zpl__tar_entry_fd *d = cast(zpl__tar_entry_fd *)zpl_alloc(alloc, zpl_size_of(zpl__tar_entry_fd));
+    if (!d) return ZPL_FILE_ERROR_UNKNOWN;
+    if (!archive->ops.read_at) archive->ops = zpl_default_file_operations;
+
+    zpl_zero_item(file);
+    d->magic = ZPL__TAR_ENTRY_FD_MAGIC;
+    d->archive = archive;
+    d->base = entry->offset;
+    d->length = entry->length;
+    d->cursor = 0;
+    d->alloc = alloc;
+
+    file->ops = zpl__tar_entry_file_operations;
+    file->fd.p = cast(void *)d;
+    file->is_temp = true;
+    return ZPL_FILE_ERROR_NONE;
+}
+
+#if defined(ZPL_MODULE_JOBS)
+
+/* writes a whole file without touching the allocator, so workers don't contend on the heap */
+zpl_internal zpl_b32 zpl__tar_write_file(char const *path, zpl_u8 const *data, zpl_i64 length) {
+#if defined(ZPL_SYSTEM_WINDOWS)
+    wchar_t w_path[ZPL_MAX_PATH];
+    HANDLE handle;
+    zpl_b32 ok = true;
+    if (!zpl_utf8_to_ucs2(cast(zpl_u16 *)w_path, zpl_count_of(w_path), cast(zpl_u8 const *)path)) return false;
+    handle = CreateFileW(w_path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+    while (ok && length > 0) {
+        DWORD written = 0;
+        ok = WriteFile(handle, data, cast(DWORD)zpl_min(length, 0x40000000), &written, NULL) && written > 0;
+        data += written;
+        length -= written;
+    }
+    CloseHandle(handle);
+    return ok;
+#else
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0664);
+    if (fd < 0) return false;
+    while (length > 0) {
+        zpl_isize written = write(fd, data, cast(size_t)zpl_min(length, 0x40000000));
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) break;
+        data += written;
+        length -= written;
+    }
+    close(fd);
+    return length == 0;
+#endif
+}
+
+typedef struct {
+    zpl_atomic32 busy;
+    zpl_atomic32 *failed;
+    char path[ZPL_MAX_PATH];
+    zpl_u8 *data;
+    zpl_isize cap;
+    zpl_i64 length;
+} zpl__tar_extract_slot;
+
+typedef struct {
+    char const *dest;
+    zpl_jobs_system pool;
+    zpl__tar_extract_slot *slots;
+    zpl_isize slot_count;
+    zpl_isize slot_limit;
+    zpl_atomic32 failed;
+} zpl__tar_extractor;
+
+zpl_internal void zpl__tar_extract_job(void *data) {
+    zpl__tar_extract_slot *slot = cast(zpl__tar_extract_slot *)data;
+    if (!zpl__tar_write_file(slot->path, slot->data, slot->length))
+        zpl_atomic32_store(slot->failed, 1);
+    zpl_atomic32_store(&slot->busy, 0);
+}
+
+zpl_internal void zpl__tar_extract_pump(zpl__tar_extractor *x) {
+    zpl_jobs_process(&x->pool);
+    zpl_yield();
+}
+
+/* waits until no in-flight write targets path, so later archive entries win */
+zpl_internal void zpl__tar_extract_wait_path(zpl__tar_extractor *x, char const *path) {
+    for (zpl_isize i = 0; i < x->slot_count; i++) {
+        zpl__tar_extract_slot *slot = x->slots + i;
+        while (zpl_atomic32_load(&slot->busy) && !zpl_strcmp(slot->path, path))
+            zpl__tar_extract_pump(x);
+    }
+}
+
+zpl_internal ZPL_TAR_UNPACK_PROC(zpl__tar_extract_proc) {
+    zpl__tar_extractor *x = cast(zpl__tar_extractor *)user_data;
+    zpl__tar_extract_slot *slot = NULL;
+    char tmp[ZPL_MAX_PATH] = {0};
+
+    if (file->error != ZPL_TAR_ERROR_NONE || file->type != ZPL_TAR_TYPE_REGULAR)
+        return 0;
+    if (!zpl_strncmp(file->path, "..", 2))
+        return 0;
+
+    zpl__tar_dest_path(tmp, x->dest, file->path);
+    zpl__tar_extract_wait_path(x, tmp);
+
+    /* large files would blow the in-flight budget, stream them from here instead */
+    if (file->length > x->slot_limit)
+        return zpl__tar_extract_stream(archive, file, tmp);
+
+    while (!slot) {
+        for (zpl_isize i = 0; i < x->slot_count && !slot; i++) {
+            if (!zpl_atomic32_load(&x->slots[i].busy)) slot = x->slots + i;
+        }
+        if (!slot) zpl__tar_extract_pump(x);
+    }
+
+    if (slot->cap < file->length) {
+        zpl_isize cap = cast(zpl_isize)zpl_min(zpl_max(file->length, slot->cap * 2), x->slot_limit);
+        zpl_free(zpl_heap(), slot->data);
+        slot->data = cast(zpl_u8 *)zpl_alloc(zpl_heap(), cap);
+        slot->cap = cap;
+    }
+
+    if (file->length > 0 && !zpl_file_read_at(archive, slot->data, cast(zpl_isize)file->length, file->offset))
+        return 1;
+
+    zpl_memcopy(slot->path, tmp, zpl_strlen(tmp) + 1);
+    slot->length = file->length;
+    zpl_atomic32_store(&slot->busy, 1);
+
+    while (!zpl_jobs_enqueue(&x->pool, zpl__tar_extract_job, slot))
+        zpl__tar_extract_pump(x);
+    zpl_jobs_process(&x->pool);
+    return 0;
+}
+
+zpl_isize zpl_tar_unpack_dir_parallel(zpl_file *archive, char const *dest, zpl_u32 thread_count) {
+    ZPL_ASSERT_NOT_NULL(archive);
+    ZPL_ASSERT_NOT_NULL(dest);
+
+    if (thread_count <= 1)
+        return zpl_tar_unpack_dir(archive, dest);
+
+    zpl__tar_extractor x = {0};
+    zpl_isize err;
+    x.dest = dest;
+    x.slot_count = thread_count * 4;
+    x.slot_limit = zpl_max(ZPL_TAR_UNPACK_BUDGET / x.slot_count, 1);
+    x.slots = cast(zpl__tar_extract_slot *)zpl_alloc(zpl_heap(), zpl_size_of(zpl__tar_extract_slot) * x.slot_count);
+    zpl_memset(x.slots, 0, zpl_size_of(zpl__tar_extract_slot) * x.slot_count);
+    for (zpl_isize i = 0; i < x.slot_count; i++)
+        x.slots[i].failed = &x.failed;
+
+    zpl_jobs_init_with_limit(&x.pool, zpl_heap(), thread_count, cast(zpl_u32)x.slot_count);
+
+    err = zpl_tar_unpack(archive, zpl__tar_extract_proc, &x);
+
+    while (!zpl_jobs_done(&x.pool))
+        zpl__tar_extract_pump(&x);
+    zpl_jobs_free(&x.pool);
+
+    for (zpl_isize i = 0; i < x.slot_count; i++)
+        zpl_free(zpl_heap(), x.slots[i].data);
+    zpl_free(zpl_heap(), x.slots);
+
+    if (err == 0 && zpl_atomic32_load(&x.failed))
+        err = -(ZPL_TAR_ERROR_IO_ERROR);
+    return err;
+}
+
+#else
+
+zpl_isize zpl_tar_unpack_dir_parallel(zpl_file *archive, char const *dest, zpl_u32 thread_count) {
+    zpl_unused(thread_count);
+    return zpl_tar_unpack_dir(archive, dest);
+}
+
+#endif
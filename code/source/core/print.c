@@ -11,13 +11,28 @@ zpl_isize zpl_printf_err_va(char const *fmt, va_list va) {
     return zpl_fprintf_va(zpl_file_get_standard(ZPL_FILE_STANDARD_ERROR), fmt, va);
 }
 
-zpl_isize zpl_fprintf_va(struct zpl_file *f, char const *fmt, va_list va) {
-    zpl_local_persist zpl_thread_local char buf[ZPL_PRINTF_MAXLEN];
-    zpl_isize len = zpl_snprintf_va(buf, zpl_size_of(buf), fmt, va);
+zpl_internal zpl_isize zpl__fprintf_write(struct zpl_file *f, char const *buf, zpl_isize len) {
     zpl_b32 res = zpl_file_write(f, buf, len - 1); // NOTE: prevent extra whitespace
     return res ? len : -1;
 }
 
+zpl_isize zpl_fprintf_va(struct zpl_file *f, char const *fmt, va_list va) {
+    zpl_local_persist zpl_thread_local char buf[ZPL_PRINTF_MAXLEN];
+    char small[ZPL_PRINTF_STACK_LEN];
+    zpl_isize len;
+    va_list args;
+
+    // NOTE: Most lines are short, the large buffer is only touched when they don't fit on the stack
+    va_copy(args, va);
+    len = zpl_snprintf_va(small, zpl_size_of(small), fmt, args);
+    va_end(args);
+    if (len >= 0) return zpl__fprintf_write(f, small, len);
+
+    len = zpl_snprintf_va(buf, zpl_size_of(buf), fmt, va);
+    if (len < 0) len = zpl_size_of(buf); // NOTE: truncated, write what fits
+    return zpl__fprintf_write(f, buf, len);
+}
+
 char *zpl_bprintf_va(char const *fmt, va_list va) {
     zpl_local_persist zpl_thread_local char buffer[ZPL_PRINTF_MAXLEN];
     zpl_snprintf_va(buffer, zpl_size_of(buffer), fmt, va);
@@ -87,6 +102,40 @@ zpl_isize zpl_snprintf(char *str, zpl_isize n, char const *fmt, ...) {
     return res;
 }
 
+zpl_isize zpl_fmt_snprintf(char *str, zpl_isize n, zpl_fmt const *plan, ...) {
+    zpl_isize res;
+    va_list va;
+    va_start(va, plan);
+    res = zpl_fmt_snprintf_va(str, n, plan, va);
+    va_end(va);
+    return res;
+}
+
+zpl_isize zpl_fmt_fprintf(struct zpl_file *f, zpl_fmt const *plan, ...) {
+    zpl_isize res;
+    va_list va;
+    va_start(va, plan);
+    res = zpl_fmt_fprintf_va(f, plan, va);
+    va_end(va);
+    return res;
+}
+
+zpl_isize zpl_fmt_fprintf_va(struct zpl_file *f, zpl_fmt const *plan, va_list va) {
+    zpl_local_persist zpl_thread_local char buf[ZPL_PRINTF_MAXLEN];
+    char small[ZPL_PRINTF_STACK_LEN];
+    zpl_isize len;
+    va_list args;
+
+    va_copy(args, va);
+    len = zpl_fmt_snprintf_va(small, zpl_size_of(small), plan, args);
+    va_end(args);
+    if (len >= 0) return zpl__fprintf_write(f, small, len);
+
+    len = zpl_fmt_snprintf_va(buf, zpl_size_of(buf), plan, va);
+    if (len < 0) len = zpl_size_of(buf);
+    return zpl__fprintf_write(f, buf, len);
+}
+
 
 enum {
     ZPL_FMT_MINUS = ZPL_BIT(0),
@@ -108,6 +157,9 @@ enum {
     ZPL_FMT_UPPER    = ZPL_BIT(14),
     ZPL_FMT_WIDTH    = ZPL_BIT(15),
 
+    ZPL_FMT_WIDTH_ARG     = ZPL_BIT(16), // '*', taken from the arguments
+    ZPL_FMT_PRECISION_ARG = ZPL_BIT(17),
+
     ZPL_FMT_DONE = ZPL_BIT(30),
 
     ZPL_FMT_INTS =
@@ -122,16 +174,40 @@ typedef struct {
     zpl_i32 precision;
 } zpl__format_info;
 
+zpl_internal ZPL_ALWAYS_INLINE zpl_isize zpl__print_copy(char *text, zpl_isize max_len, char const *str, zpl_isize len) {
+    len = zpl_min(len, max_len);
+    zpl_memcopy(text, str, len);
+    return len;
+}
+
+/* converts the len bytes just written, a truncated result is not NUL-terminated */
+zpl_internal zpl_isize zpl__print_case(zpl__format_info *info, char *text, zpl_isize len) {
+    if (info && (info->flags & ZPL_FMT_UPPER)) {
+        for (zpl_isize i = 0; i < len && text[i]; i++) text[i] = zpl_char_to_upper(text[i]);
+    } else if (info && (info->flags & ZPL_FMT_LOWER)) {
+        for (zpl_isize i = 0; i < len && text[i]; i++) text[i] = zpl_char_to_lower(text[i]);
+    }
+    return len;
+}
+
 zpl_internal zpl_isize zpl__print_string(char *text, zpl_isize max_len, zpl__format_info *info, char const *str) {
     zpl_isize res = 0, len = 0;
     zpl_isize remaining = max_len;
     char *begin = text;
 
-    if (str == NULL && max_len >= 6) {
+    if (str == NULL) {
+        if (max_len < 6) {
+            zpl_strlcpy(text, "(null)", max_len);
+            return max_len;
+        }
         res += zpl_strlcpy(text, "(null)", 6);
         return res;
     }
 
+    if (info && info->width == 0 && info->precision < 0 && !(info->flags & (ZPL_FMT_UPPER | ZPL_FMT_LOWER | ZPL_FMT_WIDTH))) {
+        return zpl__print_copy(text, max_len, str, zpl_strlen(str));
+    }
+
     if (info && info->precision >= 0)
         len = zpl_strnlen(str, info->precision);
     else
@@ -141,37 +217,47 @@ zpl_internal zpl_isize zpl__print_string(char *text, zpl_isize max_len, zpl__for
         return res;
     }
 
+    // NOTE: Whenever the output doesn't fit, we copy what we can and return max_len
+    // so the caller can tell the result was truncated.
     if (info && (info->width == 0 || info->flags & ZPL_FMT_MINUS)) {
         if (info->precision > 0) len = info->precision < len ? info->precision : len;
-        if (res+len > max_len) return res;
+        if (res+len > max_len) {
+            zpl_strlcpy(text, str, max_len);
+            return zpl__print_case(info, begin, max_len);
+        }
         res += zpl_strlcpy(text, str, len);
         text += res;
+        remaining -= res;
 
         if (info->width > res) {
             zpl_isize padding = info->width - len;
 
             char pad = (info->flags & ZPL_FMT_ZERO) ? '0' : ' ';
-            while (padding-- > 0 && remaining-- > 0) *text++ = pad, res++;
+            if (padding > remaining) {
+                zpl_memset(text, pad, remaining);
+                return zpl__print_case(info, begin, max_len);
+            }
+            while (padding-- > 0) *text++ = pad, res++;
         }
     } else {
         if (info && (info->width > res)) {
             zpl_isize padding = info->width - len;
             char pad = (info->flags & ZPL_FMT_ZERO) ? '0' : ' ';
+            if (padding > remaining) {
+                zpl_memset(text, pad, remaining);
+                return zpl__print_case(info, begin, max_len);
+            }
             while (padding-- > 0 && remaining-- > 0) *text++ = pad, res++;
         }
 
-        if (res+len > max_len) return res;
+        if (res+len > max_len) {
+            zpl_strlcpy(text, str, max_len - res);
+            return zpl__print_case(info, begin, max_len);
+        }
         res += zpl_strlcpy(text, str, len);
     }
 
-    if (info) {
-        if (info->flags & ZPL_FMT_UPPER)
-            zpl_str_to_upper(begin);
-        else if (info->flags & ZPL_FMT_LOWER)
-            zpl_str_to_lower(begin);
-    }
-
-    return res;
+    return zpl__print_case(info, begin, res);
 }
 
 zpl_internal zpl_isize zpl__print_char(char *text, zpl_isize max_len, zpl__format_info *info, char arg) {
@@ -184,273 +270,529 @@ zpl_internal zpl_isize zpl__print_repeated_char(char *text, zpl_isize max_len, z
     zpl_isize res = 0;
     zpl_i32 rem = (info) ? (info->width > 0) ? info->width : 1 : 1;
     res = rem;
+    if (rem > max_len) {
+        zpl_memset(text, arg, max_len);
+        return max_len;
+    }
     while (rem-- > 0) *text++ = arg;
 
     return res;
 }
 
+// NOTE: Plain decimals are the common case, they skip the padding logic and are copied straight to the output.
+// An explicit zero width ("%0d", "%*d" given 0) is not plain, zpl__print_string prints nothing for it in every base.
+zpl_internal ZPL_ALWAYS_INLINE zpl_b32 zpl__print_is_plain_dec(zpl__format_info *info) {
+    return info && info->base == 10 && info->width == 0 && info->precision < 0 && !(info->flags & ZPL_FMT_WIDTH);
+}
+
 zpl_internal zpl_isize zpl__print_i64(char *text, zpl_isize max_len, zpl__format_info *info, zpl_i64 value) {
     char num[130];
+    if (zpl__print_is_plain_dec(info)) {
+        zpl_u64 v = cast(zpl_u64)value;
+        zpl_isize len = 0;
+        if (value < 0) num[len++] = '-', v = 0 - v;
+        len += zpl__u64_to_dec(num + len, v);
+        return zpl__print_copy(text, max_len, num, len);
+    }
     zpl_i64_to_str(value, num, info ? info->base : 10);
     return zpl__print_string(text, max_len, info, num);
 }
 
 zpl_internal zpl_isize zpl__print_u64(char *text, zpl_isize max_len, zpl__format_info *info, zpl_u64 value) {
     char num[130];
+    if (zpl__print_is_plain_dec(info)) {
+        return zpl__print_copy(text, max_len, num, zpl__u64_to_dec(num, value));
+    }
     zpl_u64_to_str(value, num, info ? info->base : 10);
     return zpl__print_string(text, max_len, info, num);
 }
 
-zpl_internal zpl_isize zpl__print_f64(char *text, zpl_isize max_len, zpl__format_info *info, zpl_b32 is_hexadecimal, zpl_f64 arg) {
-    // TODO: Handle exponent notation
-    zpl_isize width, len, remaining = max_len;
-    char *text_begin = text;
-
-    if (arg) {
-        zpl_u64 value;
-        if (arg < 0) {
-            if (remaining > 1) *text = '-', remaining--;
-            text++;
-            arg = -arg;
-        } else if (info->flags & ZPL_FMT_MINUS) {
-            if (remaining > 1) *text = '+', remaining--;
-            text++;
+zpl_internal ZPL_ALWAYS_INLINE void zpl__print_put(char **text, zpl_isize *remaining, char c) {
+    if (*remaining > 1) {
+        *(*text)++ = c;
+        (*remaining)--;
+    } else {
+        *remaining = 0; // NOTE: out of space, reported as truncated by zpl__print_f64
+    }
+}
+
+zpl_internal zpl_isize zpl__print_f64(char *text, zpl_isize max_len, zpl__format_info *info, char format, zpl_f64 arg) {
+    zpl_isize remaining = max_len, len, width;
+    char *text_begin = text, sign = 0;
+    char const *special = NULL;
+    zpl_b32 upper = (format >= 'A' && format <= 'Z'), scientific = false, hex = false, point;
+    zpl_i32 prec = (info->precision < 0) ? 6 : info->precision, exp10 = 0, i, exp_digits = 2;
+    zpl__decimal d;
+    zpl_u64 man = 0;
+    zpl_i32 lead = 0, nd = 0;
+
+    if (zpl__f64_to_bits(arg) >> 63) {
+        sign = '-';
+        arg = -arg;
+    } else if (info->flags & ZPL_FMT_PLUS) {
+        sign = '+';
+    } else if (info->flags & ZPL_FMT_SPACE) {
+        sign = ' ';
+    }
+
+    if (arg != arg) {
+        special = upper ? "NAN" : "nan";
+    } else if (arg > ZPL_F64_MAX) {
+        special = upper ? "INF" : "inf";
+    } else {
+        switch (zpl_char_to_lower(format)) {
+            case 'e': {
+                zpl__f64_to_decimal(&d, arg, false, prec + 1);
+                scientific = true;
+            } break;
+
+            case 'g': {
+                zpl_i32 p = prec ? prec : 1;
+                zpl__f64_to_decimal(&d, arg, false, p);
+                exp10 = d.nd ? d.dp - 1 : 0;
+                scientific = (exp10 < -4 || exp10 >= p);
+                prec = scientific ? p - 1 : p - 1 - exp10;
+
+                /* trailing zeros are dropped, the digits are already trimmed */
+                if (!(info->flags & ZPL_FMT_ALT)) {
+                    zpl_i32 frac = scientific ? d.nd - 1 : d.nd - d.dp;
+                    prec = zpl_clamp(frac, 0, prec);
+                }
+            } break;
+
+            case 'a': {
+                /* exact binary digits: the leading one (zero for subnormals) and 13 nibbles of mantissa */
+                zpl_u64 bits = zpl__f64_to_bits(arg);
+                zpl_i32 e = cast(zpl_i32)(bits >> 52) & 0x7ff;
+                man = bits & ((1ull << 52) - 1);
+                lead = (e != 0);
+                exp10 = (e == 0) ? (man ? -1022 : 0) : e - 1023;
+                nd = 13;
+                hex = true;
+
+                if (info->precision < 0) {
+                    for (; nd > 0 && !(man & 15); nd--) man >>= 4;
+                    prec = nd;
+                } else if (prec < nd) {
+                    /* round half to even together with the leading digit, which takes the carry */
+                    zpl_i32 shift = 4 * (nd - prec);
+                    zpl_u64 full = cast(zpl_u64)lead << 52 | man;
+                    zpl_u64 rest = full & ((1ull << shift) - 1), half = 1ull << (shift - 1);
+                    full >>= shift;
+                    if (rest > half || (rest == half && (full & 1))) full++;
+                    nd = prec;
+                    lead = cast(zpl_i32)(full >> (4 * nd));
+                    man = full & ((1ull << (4 * nd)) - 1);
+                }
+
+                exp_digits = 1;
+                for (i = zpl_abs(exp10); i >= 10; i /= 10) exp_digits++;
+            } break;
+
+            default: zpl__f64_to_decimal(&d, arg, true, prec); break;
         }
 
-        value = cast(zpl_u64) arg;
-        len = zpl__print_u64(text, remaining, NULL, value);
-        text += len;
-
-        if (len >= remaining)
-            remaining = zpl_min(remaining, 1);
-        else
-            remaining -= len;
-        arg -= value;
-
-        if (info->precision < 0) info->precision = 6;
-
-        if ((info->flags & ZPL_FMT_ALT) || info->precision > 0) {
-            zpl_i64 mult = 10;
-            if (remaining > 1) *text = '.', remaining--;
-            text++;
-            while (info->precision-- > 0) {
-                value = cast(zpl_u64)(arg * mult);
-                len = zpl__print_u64(text, remaining, NULL, value);
-                text += len;
-                if (len >= remaining)
-                    remaining = zpl_min(remaining, 1);
-                else
-                    remaining -= len;
-                arg -= cast(zpl_f64) value / mult;
-                mult *= 10;
-            }
+        if (scientific) {
+            exp10 = d.nd ? d.dp - 1 : 0;
+            if (zpl_abs(exp10) >= 100) exp_digits = 3;
         }
+    }
+
+    /* measure first so that the padding can go on either side of the sign */
+    point = prec > 0 || (info->flags & ZPL_FMT_ALT);
+    if (special) {
+        len = 3;
+    } else if (scientific) {
+        len = 1 + point + prec + 2 + exp_digits;
+    } else if (hex) {
+        len = 2 + 1 + point + prec + 2 + exp_digits;
     } else {
-        if (remaining > 1) *text = '0', remaining--;
-        text++;
-        if (info->flags & ZPL_FMT_ALT) {
-            if (remaining > 1) *text = '.', remaining--;
-            text++;
-        }
+        len = ((d.dp > 0) ? d.dp : 1) + point + prec;
     }
+    len += (sign != 0);
 
-    width = info->width - (text - text_begin);
-    if (width > 0) {
-        char fill = (info->flags & ZPL_FMT_ZERO) ? '0' : ' ';
-        char *end = text + remaining - 1;
-        len = (text - text_begin);
+    width = info->width - len;
+    if (special && (info->flags & ZPL_FMT_ZERO)) info->flags &= ~ZPL_FMT_ZERO;
 
-        for (len = (text - text_begin); len--;) {
-            if ((text_begin + len + width) < end) *(text_begin + len + width) = *(text_begin + len);
-        }
+    if (!(info->flags & (ZPL_FMT_MINUS | ZPL_FMT_ZERO))) {
+        while (width-- > 0) zpl__print_put(&text, &remaining, ' ');
+    }
+    if (sign) zpl__print_put(&text, &remaining, sign);
+    if (hex) {
+        zpl__print_put(&text, &remaining, '0');
+        zpl__print_put(&text, &remaining, upper ? 'X' : 'x');
+    }
+    if (!(info->flags & ZPL_FMT_MINUS) && (info->flags & ZPL_FMT_ZERO)) {
+        while (width-- > 0) zpl__print_put(&text, &remaining, '0');
+    }
 
-        len = width;
-        text += len;
-        if (len >= remaining)
-            remaining = zpl_min(remaining, 1);
-        else
-            remaining -= len;
+    if (special) {
+        for (; *special; special++) zpl__print_put(&text, &remaining, *special);
+    } else if (scientific) {
+        zpl__print_put(&text, &remaining, cast(char)('0' + (d.nd ? d.d[0] : 0)));
+        if (point) zpl__print_put(&text, &remaining, '.');
+        for (i = 1; i <= prec; i++) zpl__print_put(&text, &remaining, cast(char)('0' + (i < d.nd ? d.d[i] : 0)));
+
+        zpl__print_put(&text, &remaining, upper ? 'E' : 'e');
+        zpl__print_put(&text, &remaining, (exp10 < 0) ? '-' : '+');
+        exp10 = zpl_abs(exp10);
+        if (exp_digits > 2) zpl__print_put(&text, &remaining, cast(char)('0' + exp10 / 100));
+        zpl__print_put(&text, &remaining, cast(char)('0' + (exp10 / 10) % 10));
+        zpl__print_put(&text, &remaining, cast(char)('0' + exp10 % 10));
+    } else if (hex) {
+        char const *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+        char exp_buf[4];
+        zpl__print_put(&text, &remaining, cast(char)('0' + lead));
+        if (point) zpl__print_put(&text, &remaining, '.');
+        for (i = 0; i < prec; i++) zpl__print_put(&text, &remaining, (i < nd) ? digits[(man >> (4 * (nd - 1 - i))) & 15] : '0');
+
+        zpl__print_put(&text, &remaining, upper ? 'P' : 'p');
+        zpl__print_put(&text, &remaining, (exp10 < 0) ? '-' : '+');
+        exp10 = zpl_abs(exp10);
+        for (i = exp_digits - 1; i >= 0; i--, exp10 /= 10) exp_buf[i] = cast(char)('0' + exp10 % 10);
+        for (i = 0; i < exp_digits; i++) zpl__print_put(&text, &remaining, exp_buf[i]);
+    } else {
+        if (d.dp <= 0) zpl__print_put(&text, &remaining, '0');
+        for (i = 0; i < d.dp; i++) zpl__print_put(&text, &remaining, cast(char)('0' + (i < d.nd ? d.d[i] : 0)));
+        if (point) zpl__print_put(&text, &remaining, '.');
+        for (i = d.dp; i < d.dp + prec; i++) zpl__print_put(&text, &remaining, cast(char)('0' + (i >= 0 && i < d.nd ? d.d[i] : 0)));
+    }
 
-        while (len--) {
-            if (text_begin + len < end) text_begin[len] = fill;
-        }
+    if (info->flags & ZPL_FMT_MINUS) {
+        while (width-- > 0) zpl__print_put(&text, &remaining, ' ');
     }
 
-    return (text - text_begin);
+    return (remaining == 0) ? max_len : (text - text_begin);
 }
 
-ZPL_NEVER_INLINE zpl_isize zpl_snprintf_va(char *text, zpl_isize max_len, char const *fmt, va_list va) {
-    char const *text_begin = text;
-    zpl_isize remaining = max_len, res;
+/* parses the conversion spec at fmt, which points at its '%', and returns the text following it */
+zpl_internal char const *zpl__fmt_parse(char const *fmt, zpl__format_info *info, char *conv) {
+    info->precision = -1;
+    do {
+        switch (*++fmt) {
+        case '-': {info->flags |= ZPL_FMT_MINUS; break;}
+        case '+': {info->flags |= ZPL_FMT_PLUS; break;}
+        case '#': {info->flags |= ZPL_FMT_ALT; break;}
+        case ' ': {info->flags |= ZPL_FMT_SPACE; break;}
+        case '0': {info->flags |= (ZPL_FMT_ZERO|ZPL_FMT_WIDTH); break;}
+        default: {info->flags |= ZPL_FMT_DONE; break;}
+        }
+    } while (!(info->flags & ZPL_FMT_DONE));
 
-    while (*fmt) {
-        zpl__format_info info = { 0 };
-        zpl_isize len = 0;
-        info.precision = -1;
-
-        while (*fmt && *fmt != '%' && remaining) *text++ = *fmt++;
-
-        if (*fmt == '%') {
-            do {
-                switch (*++fmt) {
-                case '-': {info.flags |= ZPL_FMT_MINUS; break;}
-                case '+': {info.flags |= ZPL_FMT_PLUS; break;}
-                case '#': {info.flags |= ZPL_FMT_ALT; break;}
-                case ' ': {info.flags |= ZPL_FMT_SPACE; break;}
-                case '0': {info.flags |= (ZPL_FMT_ZERO|ZPL_FMT_WIDTH); break;}
-                default: {info.flags |= ZPL_FMT_DONE; break;}
-                }
-            } while (!(info.flags & ZPL_FMT_DONE));
+    // NOTE: Optional Width
+    if (*fmt == '*') {
+        info->flags |= (ZPL_FMT_WIDTH | ZPL_FMT_WIDTH_ARG);
+        fmt++;
+    } else {
+        while (zpl_char_is_digit(*fmt)) info->width = info->width * 10 + (*fmt++ - '0');
+        if (info->width != 0) {
+            info->flags |= ZPL_FMT_WIDTH;
         }
+    }
 
-        // NOTE: Optional Width
+    // NOTE: Optional Precision
+    if (*fmt == '.') {
+        fmt++;
         if (*fmt == '*') {
-            int width = va_arg(va, int);
-            if (width < 0) {
-                info.flags |= ZPL_FMT_MINUS;
-                info.width = -width;
-            } else {
-                info.width = width;
-            }
-            info.flags |= ZPL_FMT_WIDTH;
+            info->flags |= ZPL_FMT_PRECISION_ARG;
             fmt++;
         } else {
-            info.width = cast(zpl_i32) zpl_str_to_i64(fmt, cast(char **) & fmt, 10);
-            if (info.width != 0) {
-                info.flags |= ZPL_FMT_WIDTH;
-            }
+            info->precision = 0;
+            while (zpl_char_is_digit(*fmt)) info->precision = info->precision * 10 + (*fmt++ - '0');
         }
+    }
 
-        // NOTE: Optional Precision
-        if (*fmt == '.') {
+    switch (*fmt++) {
+        case 'h':
+        if (*fmt == 'h') { // hh => char
+            info->flags |= ZPL_FMT_CHAR;
             fmt++;
-            if (*fmt == '*') {
-                info.precision = va_arg(va, int);
-                fmt++;
-            } else {
-                info.precision = cast(zpl_i32) zpl_str_to_i64(fmt, cast(char **) & fmt, 10);
-            }
-            info.flags &= ~ZPL_FMT_ZERO;
+        } else { // h => short
+            info->flags |= ZPL_FMT_SHORT;
         }
+        break;
 
-        switch (*fmt++) {
-            case 'h':
-            if (*fmt == 'h') { // hh => char
-                info.flags |= ZPL_FMT_CHAR;
-                fmt++;
-            } else { // h => short
-                info.flags |= ZPL_FMT_SHORT;
-            }
+        case 'l':
+        if (*fmt == 'l') { // ll => long long
+            info->flags |= ZPL_FMT_LLONG;
+            fmt++;
+        } else { // l => long
+            info->flags |= ZPL_FMT_LONG;
+        }
+        break;
+
+        case 'z': // NOTE: zpl_usize
+            info->flags |= ZPL_FMT_UNSIGNED;
+            // fallthrough
+        case 't': // NOTE: zpl_isize
+            info->flags |= ZPL_FMT_SIZE;
             break;
 
-            case 'l':
-            if (*fmt == 'l') { // ll => long long
-                info.flags |= ZPL_FMT_LLONG;
-                fmt++;
-            } else { // l => long
-                info.flags |= ZPL_FMT_LONG;
-            }
+        default: fmt--; break;
+    }
+
+    switch (*fmt) {
+        case 'u':
+            info->flags |= ZPL_FMT_UNSIGNED;
+            // fallthrough
+        case 'd':
+        case 'i': info->base = 10; break;
+
+        case 'o': info->base = 8; break;
+
+        case 'x':
+            info->base = 16;
+            info->flags |= (ZPL_FMT_UNSIGNED | ZPL_FMT_LOWER);
             break;
 
+        case 'X':
+            info->base = 16;
+            info->flags |= (ZPL_FMT_UNSIGNED | ZPL_FMT_UPPER);
             break;
 
-            case 'z': // NOTE: zpl_usize
-                info.flags |= ZPL_FMT_UNSIGNED;
-                // fallthrough
-            case 't': // NOTE: zpl_isize
-                info.flags |= ZPL_FMT_SIZE;
-                break;
+        case 'p':
+            info->base = 16;
+            info->flags |= (ZPL_FMT_LOWER | ZPL_FMT_UNSIGNED | ZPL_FMT_ALT | ZPL_FMT_INTPTR);
+            break;
+
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        case 'c': case 's': case 'r': case '%':
+            break;
+
+        // NOTE: Unknown conversions print nothing and leave their character to the literal text
+        default: *conv = 0; return fmt;
+    }
+
+    *conv = *fmt;
+    return fmt + 1;
+}
+
+typedef union {
+    zpl_i64     i;
+    zpl_u64     u;
+    zpl_f64     f;
+    char const *s;
+} zpl__fmt_value;
+
+/* fetches the arguments of one parsed conversion, '*' widths and precisions are applied to info */
+zpl_internal ZPL_ALWAYS_INLINE zpl__fmt_value zpl__fmt_fetch(zpl__format_info *info, char conv, va_list *va) {
+    zpl__fmt_value value;
+    value.u = 0;
+
+    if (info->flags & ZPL_FMT_WIDTH_ARG) {
+        int width = va_arg(*va, int);
+        if (width < 0) {
+            info->flags |= ZPL_FMT_MINUS;
+            info->width = -width;
+        } else {
+            info->width = width;
+        }
+    }
+    if (info->flags & ZPL_FMT_PRECISION_ARG) {
+        info->precision = va_arg(*va, int);
+    }
+
+    switch (conv) {
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            value.f = va_arg(*va, zpl_f64);
+            return value;
+
+        case 'c': case 'r': value.i = va_arg(*va, int); return value;
+        case 's': value.s = va_arg(*va, char *); return value;
+        case '%': return value;
+        default: break;
+    }
+
+    if (info->base == 0) return value;
+
+    if (info->flags & ZPL_FMT_UNSIGNED) {
+        switch (info->flags & ZPL_FMT_INTS) {
+            case ZPL_FMT_CHAR:   value.u = cast(zpl_u64) cast(zpl_u8) va_arg(*va, int); break;
+            case ZPL_FMT_SHORT:  value.u = cast(zpl_u64) cast(zpl_u16) va_arg(*va, int); break;
+            case ZPL_FMT_LONG:   value.u = cast(zpl_u64) va_arg(*va, unsigned long); break;
+            case ZPL_FMT_LLONG:  value.u = cast(zpl_u64) va_arg(*va, unsigned long long); break;
+            case ZPL_FMT_SIZE:   value.u = cast(zpl_u64) va_arg(*va, zpl_usize); break;
+            case ZPL_FMT_INTPTR: value.u = cast(zpl_u64) va_arg(*va, zpl_uintptr); break;
+            default: value.u             = cast(zpl_u64) va_arg(*va, unsigned int); break;
+        }
+    } else {
+        switch (info->flags & ZPL_FMT_INTS) {
+            case ZPL_FMT_CHAR:   value.i = cast(zpl_i64) cast(zpl_i8) va_arg(*va, int); break;
+            case ZPL_FMT_SHORT:  value.i = cast(zpl_i64) cast(zpl_i16) va_arg(*va, int); break;
+            case ZPL_FMT_LONG:   value.i = cast(zpl_i64) va_arg(*va, long); break;
+            case ZPL_FMT_LLONG:  value.i = cast(zpl_i64) va_arg(*va, long long); break;
+            case ZPL_FMT_SIZE:   value.i = cast(zpl_i64) va_arg(*va, zpl_usize); break;
+            case ZPL_FMT_INTPTR: value.i = cast(zpl_i64) va_arg(*va, zpl_uintptr); break;
+            default: value.i             = cast(zpl_i64) va_arg(*va, int); break;
+        }
+    }
+    return value;
+}
 
-            default: fmt--; break;
+/* prints one fetched conversion, returns the length like the print helpers */
+zpl_internal zpl_isize zpl__fmt_print(char *text, zpl_isize remaining, zpl__format_info *info, char conv, zpl__fmt_value value) {
+    // NOTE: Zero padding is ignored once a precision is given, except for floating-point values
+    if (info->precision >= 0) {
+        switch (conv) {
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': break;
+            default: info->flags &= ~ZPL_FMT_ZERO; break;
         }
+    }
 
-        switch (*fmt) {
-            case 'u':
-                info.flags |= ZPL_FMT_UNSIGNED;
-                // fallthrough
-            case 'd':
-            case 'i': info.base = 10; break;
+    switch (conv) {
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': return zpl__print_f64(text, remaining, info, conv, value.f);
 
-            case 'o': info.base = 8; break;
+        case 'c': return zpl__print_char(text, remaining, info, cast(char) value.i);
 
-            case 'x':
-                info.base = 16;
-                info.flags |= (ZPL_FMT_UNSIGNED | ZPL_FMT_LOWER);
-                break;
+        case 's': return zpl__print_string(text, remaining, info, value.s);
 
-            case 'X':
-                info.base = 16;
-                info.flags |= (ZPL_FMT_UNSIGNED | ZPL_FMT_UPPER);
-                break;
+        case 'r': return zpl__print_repeated_char(text, remaining, info, cast(char) value.i);
 
-            case 'f':
-            case 'F':
-            case 'g':
-            case 'G': len = zpl__print_f64(text, remaining, &info, 0, va_arg(va, zpl_f64)); break;
+        case '%': return zpl__print_char(text, remaining, info, '%');
 
-            case 'a':
-            case 'A':
-                len = zpl__print_f64(text, remaining, &info, 1, va_arg(va, zpl_f64)); break;
+        default: break;
+    }
+
+    if (info->base == 0) return 0;
+
+    if (info->flags & ZPL_FMT_UNSIGNED) {
+        return zpl__print_u64(text, remaining, info, value.u);
+    }
+    return zpl__print_i64(text, remaining, info, value.i);
+}
 
-            case 'c': len = zpl__print_char(text, remaining, &info, cast(char) va_arg(va, int)); break;
+/* fetches the arguments of one parsed conversion and prints it */
+zpl_internal ZPL_ALWAYS_INLINE zpl_isize zpl__fmt_arg(char *text, zpl_isize remaining, zpl__format_info *info, char conv, va_list *va) {
+    zpl__fmt_value value = zpl__fmt_fetch(info, conv, va);
+    return zpl__fmt_print(text, remaining, info, conv, value);
+}
 
-            case 's': len = zpl__print_string(text, remaining, &info, va_arg(va, char *)); break;
+/* copies literal text, false once it no longer fits next to the terminator */
+zpl_internal ZPL_ALWAYS_INLINE zpl_b32 zpl__fmt_literal(char **text, zpl_isize *remaining, char const *lit, zpl_isize len) {
+    zpl_isize n = zpl_min(len, *remaining - 1);
+    zpl_memcopy(*text, lit, n);
+    *text += n;
+    *remaining -= n;
+    return n == len;
+}
 
-            case 'r': len = zpl__print_repeated_char(text, remaining, &info, va_arg(va, int)); break;
+/* NOTE: Keep the last byte for the terminator, a truncated argument stops the formatting */
+#define ZPL__FMT_ADVANCE(len) \
+    if ((len) >= remaining) { \
+        text += remaining - 1; \
+        truncated = true; \
+        break; \
+    } \
+    text += (len); \
+    remaining -= (len)
 
-            case 'p':
-                info.base = 16;
-                info.flags |= (ZPL_FMT_LOWER | ZPL_FMT_UNSIGNED | ZPL_FMT_ALT | ZPL_FMT_INTPTR);
-                break;
+ZPL_NEVER_INLINE zpl_isize zpl_snprintf_va(char *text, zpl_isize max_len, char const *fmt, va_list va) {
+    char const *text_begin = text;
+    zpl_isize remaining = max_len, res;
+    zpl_b32 truncated = false;
+    va_list args;
 
-            case '%': len = zpl__print_char(text, remaining, &info, '%'); break;
+    if (max_len <= 0) return -1;
+    va_copy(args, va);
+    while (*fmt) {
+        zpl__format_info info = { 0 };
+        zpl_isize len;
+        char conv;
 
-            default: fmt--; break;
+        while (*fmt && *fmt != '%' && remaining > 1) *text++ = *fmt++, remaining--;
+        if (*fmt && *fmt != '%') {
+            truncated = true;
+            break;
         }
+        if (!*fmt) break;
 
-        fmt++;
+        fmt = zpl__fmt_parse(fmt, &info, &conv);
+        len = zpl__fmt_arg(text, remaining, &info, conv, &args);
+        ZPL__FMT_ADVANCE(len);
+    }
+    va_end(args);
 
-        if (info.base != 0) {
-            if (info.flags & ZPL_FMT_UNSIGNED) {
-                zpl_u64 value = 0;
-                switch (info.flags & ZPL_FMT_INTS) {
-                    case ZPL_FMT_CHAR:   value = cast(zpl_u64) cast(zpl_u8) va_arg(va, int); break;
-                    case ZPL_FMT_SHORT:  value = cast(zpl_u64) cast(zpl_u16) va_arg(va, int); break;
-                    case ZPL_FMT_LONG:   value = cast(zpl_u64) va_arg(va, unsigned long); break;
-                    case ZPL_FMT_LLONG:  value = cast(zpl_u64) va_arg(va, unsigned long long); break;
-                    case ZPL_FMT_SIZE:   value = cast(zpl_u64) va_arg(va, zpl_usize); break;
-                    case ZPL_FMT_INTPTR: value = cast(zpl_u64) va_arg(va, zpl_uintptr); break;
-                    default: value             = cast(zpl_u64) va_arg(va, unsigned int); break;
-                }
+    *text++ = '\0';
+    res = (text - text_begin);
+    return (truncated || res > max_len || res < 0) ? -1 : res;
+}
 
-                len = zpl__print_u64(text, remaining, &info, value);
-
-            } else {
-                zpl_i64 value = 0;
-                switch (info.flags & ZPL_FMT_INTS) {
-                    case ZPL_FMT_CHAR:   value = cast(zpl_i64) cast(zpl_i8) va_arg(va, int); break;
-                    case ZPL_FMT_SHORT:  value = cast(zpl_i64) cast(zpl_i16) va_arg(va, int); break;
-                    case ZPL_FMT_LONG:   value = cast(zpl_i64) va_arg(va, long); break;
-                    case ZPL_FMT_LLONG:  value = cast(zpl_i64) va_arg(va, long long); break;
-                    case ZPL_FMT_SIZE:   value = cast(zpl_i64) va_arg(va, zpl_usize); break;
-                    case ZPL_FMT_INTPTR: value = cast(zpl_i64) va_arg(va, zpl_uintptr); break;
-                    default: value             = cast(zpl_i64) va_arg(va, int); break;
-                }
+zpl_b32 zpl_fmt_compile(zpl_fmt *plan, char const *fmt) {
+    char const *lit = fmt;
+    ZPL_ASSERT_NOT_NULL(plan);
+    ZPL_ASSERT_NOT_NULL(fmt);
+    plan->text = fmt;
+    plan->count = 0;
 
-                len = zpl__print_i64(text, remaining, &info, value);
-            }
+    while (*fmt) {
+        zpl__format_info info = { 0 };
+        zpl_fmt_spec *spec;
+        char conv;
+
+        if (*fmt != '%') { fmt++; continue; }
+        if (plan->count == ZPL_FMT_MAX_SPECS) return false;
+
+        spec = plan->specs + plan->count++;
+        spec->literal_offset = cast(zpl_u32)(lit - plan->text);
+        spec->literal_len = cast(zpl_u32)(fmt - lit);
+        fmt = zpl__fmt_parse(fmt, &info, &conv);
+        spec->base = info.base;
+        spec->flags = info.flags;
+        spec->width = info.width;
+        spec->precision = info.precision;
+        spec->conv = conv;
+        lit = fmt;
+    }
+
+    plan->tail_offset = cast(zpl_u32)(lit - plan->text);
+    plan->tail_len = cast(zpl_u32)(fmt - lit);
+    return true;
+}
+
+zpl_isize zpl_fmt_snprintf_va(char *text, zpl_isize max_len, zpl_fmt const *plan, va_list va) {
+    char const *text_begin = text;
+    zpl_isize remaining = max_len, res, i;
+    zpl_b32 truncated = false;
+    va_list args;
+
+    ZPL_ASSERT_NOT_NULL(plan);
+    if (max_len <= 0) return -1;
+    va_copy(args, va);
+    for (i = 0; i < plan->count; i++) {
+        zpl_fmt_spec const *spec = plan->specs + i;
+        zpl__format_info info;
+        zpl_isize len;
+
+        if (!zpl__fmt_literal(&text, &remaining, plan->text + spec->literal_offset, spec->literal_len)) {
+            truncated = true;
+            break;
         }
 
-        text += len;
-        if (len >= remaining)
-            remaining = zpl_min(remaining, 1);
-        else
-            remaining -= len;
+        info.base = spec->base;
+        info.flags = spec->flags;
+        info.width = spec->width;
+        info.precision = spec->precision;
+        len = zpl__fmt_arg(text, remaining, &info, spec->conv, &args);
+        ZPL__FMT_ADVANCE(len);
+    }
+    va_end(args);
+
+    if (!truncated && !zpl__fmt_literal(&text, &remaining, plan->text + plan->tail_offset, plan->tail_len)) {
+        truncated = true;
     }
 
     *text++ = '\0';
     res = (text - text_begin);
-    return (res >= max_len || res < 0) ? -1 : res;
+    return (truncated || res > max_len || res < 0) ? -1 : res;
 }
 
+#undef ZPL__FMT_ADVANCE
+
 ZPL_END_C_DECLS
@@ -45,6 +45,81 @@ zpl_string zpl_string_make_length(zpl_allocator a, void const *init_str, zpl_isi
     return str;
 }
 
+zpl_string zpl_string_make_view(zpl_allocator a, zpl_strview view) {
+    return zpl_string_make_length(a, view.ptr, view.len);
+}
+
+zpl_b32 zpl_string_sso_set(zpl_string_sso *str, zpl_allocator a, zpl_strview text) {
+    ZPL_ASSERT_NOT_NULL(str);
+    if (zpl_string_sso_is_inline(str)) {
+        if (text.len <= ZPL_STRING_SSO_CAPACITY) {
+            zpl_memmove(str->buf, text.ptr, text.len);
+            str->buf[text.len] = '\0';
+            str->buf[ZPL_STRING_SSO_CAPACITY + 1] = cast(char)text.len;
+            return true;
+        } else {
+            zpl_string heap = zpl_string_make_view(a, text);
+            if (!heap) return false;
+            str->heap = heap;
+            str->buf[ZPL_STRING_SSO_CAPACITY + 1] = cast(char)ZPL__STRING_SSO_HEAP;
+            return true;
+        }
+    } else {
+        /* stay on the heap, the buffer is already paid for */
+        zpl_string heap = str->heap;
+        if (zpl_string_capacity(heap) < text.len) {
+            zpl_isize offset = text.ptr - heap;
+            zpl_b32 aliased = offset >= 0 && offset <= zpl_string_length(heap);
+            heap = zpl_string_make_space_for(heap, text.len - zpl_string_length(heap));
+            if (!heap) return false;
+            if (aliased) text.ptr = heap + offset;
+            str->heap = heap;
+        }
+        zpl_memmove(heap, text.ptr, text.len);
+        heap[text.len] = '\0';
+        zpl__set_string_length(heap, text.len);
+        return true;
+    }
+}
+
+zpl_b32 zpl_string_sso_append(zpl_string_sso *str, zpl_allocator a, zpl_strview text) {
+    ZPL_ASSERT_NOT_NULL(str);
+    if (zpl_string_sso_is_inline(str)) {
+        zpl_isize len = zpl_string_sso_length(str);
+        if (len + text.len <= ZPL_STRING_SSO_CAPACITY) {
+            zpl_memmove(str->buf + len, text.ptr, text.len);
+            str->buf[len + text.len] = '\0';
+            str->buf[ZPL_STRING_SSO_CAPACITY + 1] = cast(char)(len + text.len);
+            return true;
+        } else {
+            zpl_string heap = zpl_string_make_reserve(a, len + text.len);
+            if (!heap) return false;
+            zpl_memcopy(heap, str->buf, len);
+            zpl_memcopy(heap + len, text.ptr, text.len);
+            heap[len + text.len] = '\0';
+            zpl__set_string_length(heap, len + text.len);
+            str->heap = heap;
+            str->buf[ZPL_STRING_SSO_CAPACITY + 1] = cast(char)ZPL__STRING_SSO_HEAP;
+            return true;
+        }
+    } else {
+        zpl_string heap = str->heap;
+        zpl_isize offset = text.ptr - heap;
+        zpl_b32 aliased = offset >= 0 && offset <= zpl_string_length(heap);
+        heap = zpl_string_make_space_for(heap, text.len);
+        if (!heap) return false;
+        if (aliased) text.ptr = heap + offset;
+        str->heap = zpl_string_append_view(heap, text);
+        return true;
+    }
+}
+
+void zpl_string_sso_free(zpl_string_sso *str) {
+    ZPL_ASSERT_NOT_NULL(str);
+    if (!zpl_string_sso_is_inline(str)) zpl_string_free(str->heap);
+    zpl_zero_item(str);
+}
+
 zpl_string zpl_string_sprintf_buf(zpl_allocator a, const char *fmt, ...) {
     zpl_local_persist zpl_thread_local char buf[ZPL_PRINTF_MAXLEN] = { 0 };
     va_list va;
@@ -84,15 +159,20 @@ ZPL_ALWAYS_INLINE zpl_string zpl_string_appendc(zpl_string str, const char *othe
 
 ZPL_ALWAYS_INLINE zpl_string zpl_string_join(zpl_allocator a, const char **parts, zpl_isize count, const char *glue) {
     zpl_string ret;
-    zpl_isize i;
+    zpl_isize i, total = 0, glue_len = zpl_strlen(glue);
 
-    ret = zpl_string_make(a, NULL);
+    // NOTE: Measure the parts first so the result is allocated only once
+    for (i=0; i<count; ++i) total += zpl_strlen(parts[i]);
+    if (count > 1) total += glue_len * (count - 1);
+
+    ret = zpl_string_make_reserve(a, total);
+    if (ret == NULL) return NULL;
 
     for (i=0; i<count; ++i) {
         ret = zpl_string_appendc(ret, parts[i]);
 
         if ((i+1) < count) {
-            ret = zpl_string_appendc(ret, glue);
+            ret = zpl_string_append_length(ret, glue, glue_len);
         }
     }
 
@@ -201,4 +281,176 @@ zpl_string zpl_string_append_fmt(zpl_string str, const char *fmt, ...) {
     return zpl_string_append_length(str, buf, res);
 }
 
+#define ZPL__STRING_BUILDER_DATA(chunk) (cast(char *)((chunk) + 1))
+
+zpl_internal zpl_string_builder_chunk *zpl__string_builder_chunk_alloc(zpl_string_builder *b, zpl_isize cap) {
+    // NOTE: One spare byte past the capacity keeps room for the terminator zpl_snprintf_va always writes
+    zpl_string_builder_chunk *chunk = cast(zpl_string_builder_chunk *)zpl_alloc(b->allocator, zpl_size_of(zpl_string_builder_chunk) + cap + 1);
+    if (chunk == NULL) return NULL;
+    chunk->next = NULL;
+    chunk->len = 0;
+    chunk->cap = cap;
+    return chunk;
+}
+
+zpl_internal void zpl__string_builder_link(zpl_string_builder *b, zpl_string_builder_chunk *chunk) {
+    if (b->tail) b->tail->next = chunk;
+    else b->head = chunk;
+    b->tail = chunk;
+}
+
+void zpl_string_builder_init(zpl_string_builder *b, zpl_allocator a, zpl_isize chunk_size) {
+    ZPL_ASSERT_NOT_NULL(b);
+    zpl_zero_item(b);
+    b->allocator = a;
+    b->chunk_size = (chunk_size > 0) ? chunk_size : ZPL_STRING_BUILDER_CHUNK_SIZE;
+}
+
+void zpl_string_builder_free(zpl_string_builder *b) {
+    zpl_string_builder_chunk *chunk = b->head;
+    while (chunk) {
+        zpl_string_builder_chunk *next = chunk->next;
+        zpl_free(b->allocator, chunk);
+        chunk = next;
+    }
+    b->head = b->tail = NULL;
+    b->length = 0;
+}
+
+void zpl_string_builder_clear(zpl_string_builder *b) {
+    zpl_string_builder_chunk *chunk;
+    if (b->head == NULL) return;
+
+    chunk = b->head->next;
+    while (chunk) {
+        zpl_string_builder_chunk *next = chunk->next;
+        zpl_free(b->allocator, chunk);
+        chunk = next;
+    }
+    b->head->next = NULL;
+    b->head->len = 0;
+    b->tail = b->head;
+    b->length = 0;
+}
+
+zpl_b32 zpl_string_builder_append(zpl_string_builder *b, void const *data, zpl_isize len) {
+    char const *src = cast(char const *)data;
+    zpl_string_builder_chunk *tail = b->tail;
+
+    if (len <= 0) return true;
+
+    if (tail) {
+        zpl_isize n = zpl_min(tail->cap - tail->len, len);
+        zpl_memcopy(ZPL__STRING_BUILDER_DATA(tail) + tail->len, src, n);
+        tail->len += n;
+        b->length += n;
+        src += n;
+        len -= n;
+    }
+
+    if (len > 0) {
+        tail = zpl__string_builder_chunk_alloc(b, zpl_max(b->chunk_size, len));
+        if (tail == NULL) return false;
+        zpl__string_builder_link(b, tail);
+
+        zpl_memcopy(ZPL__STRING_BUILDER_DATA(tail), src, len);
+        tail->len = len;
+        b->length += len;
+    }
+
+    return true;
+}
+
+zpl_b32 zpl_string_builder_append_rune(zpl_string_builder *b, zpl_rune r) {
+    if (r >= 0) {
+        zpl_u8 buf[8] = { 0 };
+        zpl_isize len = zpl_utf8_encode_rune(buf, r);
+        return zpl_string_builder_append(b, buf, len);
+    }
+
+    return true;
+}
+
+zpl_b32 zpl_string_builder_append_fmt_va(zpl_string_builder *b, char const *fmt, va_list va) {
+    zpl_string_builder_chunk *chunk = b->tail;
+    zpl_isize res, cap;
+    va_list args;
+
+    // NOTE: Print straight into the free space of the tail chunk
+    if (chunk && chunk->len < chunk->cap) {
+        va_copy(args, va);
+        res = zpl_snprintf_va(ZPL__STRING_BUILDER_DATA(chunk) + chunk->len, chunk->cap - chunk->len + 1, fmt, args);
+        va_end(args);
+
+        if (res > 0) {
+            chunk->len += res - 1;
+            b->length += res - 1;
+            return true;
+        }
+    }
+
+    // NOTE: Doesn't fit, the output goes to a fresh chunk that is doubled until it does
+    for (cap = b->chunk_size;; cap *= 2) {
+        chunk = zpl__string_builder_chunk_alloc(b, cap);
+        if (chunk == NULL) return false;
+
+        va_copy(args, va);
+        res = zpl_snprintf_va(ZPL__STRING_BUILDER_DATA(chunk), cap + 1, fmt, args);
+        va_end(args);
+
+        if (res > 0) break;
+        zpl_free(b->allocator, chunk);
+    }
+
+    zpl__string_builder_link(b, chunk);
+    chunk->len = res - 1;
+    b->length += res - 1;
+    return true;
+}
+
+zpl_b32 zpl_string_builder_append_fmt(zpl_string_builder *b, char const *fmt, ...) {
+    zpl_b32 res;
+    va_list va;
+    va_start(va, fmt);
+    res = zpl_string_builder_append_fmt_va(b, fmt, va);
+    va_end(va);
+    return res;
+}
+
+zpl_string zpl_string_builder_to_string(zpl_string_builder const *b, zpl_allocator a) {
+    zpl_string_builder_chunk *chunk;
+    zpl_isize offset = 0;
+    zpl_string str = zpl_string_make_reserve(a, b->length);
+    if (str == NULL) return NULL;
+
+    for (chunk = b->head; chunk; chunk = chunk->next) {
+        zpl_memcopy(str + offset, ZPL__STRING_BUILDER_DATA(chunk), chunk->len);
+        offset += chunk->len;
+    }
+    str[offset] = '\0';
+    zpl__set_string_length(str, offset);
+
+    return str;
+}
+
+zpl_b32 zpl_string_builder_write_to(zpl_string_builder const *b, zpl_file *file) {
+    zpl_file_iovec iov[64];
+    zpl_string_builder_chunk *chunk = b->head;
+
+    while (chunk) {
+        zpl_isize count = 0;
+        for (; chunk && count < zpl_count_of(iov); chunk = chunk->next) {
+            if (chunk->len == 0) continue;
+            iov[count].data = ZPL__STRING_BUILDER_DATA(chunk);
+            iov[count].size = chunk->len;
+            count++;
+        }
+        if (count > 0 && !zpl_file_writev(file, iov, count)) return false;
+    }
+
+    return true;
+}
+
+#undef ZPL__STRING_BUILDER_DATA
+
 ZPL_END_C_DECLS
@@ -3,6 +3,43 @@
 
 #include <string.h>
 
+#if !defined(ZPL_DISABLE_SIMD) && !defined(ZPL_SYSTEM_EMSCRIPTEN) && !defined(ZPL_COMPILER_TINYC)
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define ZPL__SIMD_SSE2
+#        include <emmintrin.h>
+#        if defined(ZPL_ARCH_64_BIT) && (defined(ZPL_COMPILER_MSVC) || defined(ZPL_COMPILER_GCC) || defined(ZPL_COMPILER_CLANG))
+#            define ZPL__SIMD_AVX2
+#            include <immintrin.h>
+#            if defined(ZPL_COMPILER_MSVC)
+#                define ZPL__SIMD_TARGET_AVX2
+#            else
+#                include <cpuid.h>
+#                define ZPL__SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#            endif
+#        endif
+#    elif (defined(__aarch64__) && defined(__ARM_NEON)) || defined(_M_ARM64)
+#        define ZPL__SIMD_NEON
+#        include <arm_neon.h>
+#    endif
+#endif
+
+/* the NUL-terminated scans below read whole aligned blocks around the string, which AddressSanitizer reports */
+#if defined(__SANITIZE_ADDRESS__)
+#    define ZPL__SIMD_ASAN
+#elif defined(__has_feature)
+#    if __has_feature(address_sanitizer)
+#        define ZPL__SIMD_ASAN
+#    endif
+#endif
+
+#if defined(ZPL__SIMD_ASAN) && defined(ZPL_COMPILER_MSVC)
+#    define ZPL__SIMD_NO_ASAN __declspec(no_sanitize_address)
+#elif defined(ZPL__SIMD_ASAN)
+#    define ZPL__SIMD_NO_ASAN __attribute__((no_sanitize_address))
+#else
+#    define ZPL__SIMD_NO_ASAN
+#endif
+
 ZPL_BEGIN_C_DECLS
 
 
@@ -35,13 +72,70 @@ void zpl_memswap(void *i, void *j, zpl_isize size) {
     }
 }
 
-void const *zpl_memchr(void const *data, zpl_u8 c, zpl_isize n) {
+////////////////////////////////////////////////////////////////
+//
+// Vectorized byte scanning
+//
+// Every kernel comes in a scalar flavor and, where the target allows it, SSE2/AVX2 or NEON ones.
+// The variant is picked by CPU detection on first use. NUL-terminated scans load whole aligned
+// blocks, those never cross a page boundary so reading past the terminator can't fault.
+//
+
+typedef struct {
+    void const *(*memchr)(void const *data, zpl_u8 c, zpl_isize n);
+    void const *(*memrchr)(void const *data, zpl_u8 c, zpl_isize n);
+    char const *(*str_find)(char const *str, char c);                             //< first c or NUL
+    char const *(*str_skip_space)(char const *str, zpl_b32 catch_newline);        //< first non-space
+    char const *(*str_find_any)(char const *str, char const *set, zpl_isize len); //< first byte of set or NUL
+    void const *(*memchr_any)(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize len);
+    void const *(*memchr_pair)(void const *data, zpl_isize n, zpl_u8 const *first, zpl_u8 const *second, zpl_isize len); //< first i with data[i], data[i+1] equal to a pair
+    zpl_isize (*ascii_span)(void const *data, zpl_isize n);    //< length of the leading 7-bit run
+    zpl_isize (*utf8_validate)(void const *data, zpl_isize n); //< offset of the first invalid sequence or n
+} zpl__simd_ops;
+
+#if defined(ZPL__SIMD_SSE2) || defined(ZPL__SIMD_NEON)
+zpl_internal ZPL_ALWAYS_INLINE zpl_i32 zpl__simd_ctz(zpl_u64 x) {
+#    if defined(ZPL_COMPILER_MSVC)
+    unsigned long i;
+#        if defined(ZPL_ARCH_64_BIT)
+    _BitScanForward64(&i, x);
+#        else
+    if (!_BitScanForward(&i, cast(unsigned long)x)) {
+        _BitScanForward(&i, cast(unsigned long)(x >> 32));
+        i += 32;
+    }
+#        endif
+    return cast(zpl_i32)i;
+#    else
+    return __builtin_ctzll(x);
+#    endif
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_i32 zpl__simd_msb(zpl_u64 x) {
+#    if defined(ZPL_COMPILER_MSVC)
+    unsigned long i;
+#        if defined(ZPL_ARCH_64_BIT)
+    _BitScanReverse64(&i, x);
+#        else
+    if (_BitScanReverse(&i, cast(unsigned long)(x >> 32))) i += 32;
+    else _BitScanReverse(&i, cast(unsigned long)x);
+#        endif
+    return cast(zpl_i32)i;
+#    else
+    return 63 - __builtin_clzll(x);
+#    endif
+}
+#endif
+
+/* scalar */
+
+zpl_internal void const *zpl__memchr_scalar(void const *data, zpl_u8 c, zpl_isize n) {
     zpl_u8 const *s = cast(zpl_u8 const *) data;
-    while ((cast(zpl_uintptr) s & (sizeof(zpl_usize) - 1)) && n && *s != c) {
+    while ((cast(zpl_uintptr) s & (sizeof(zpl_usize) - 1)) && n > 0 && *s != c) {
         s++;
         n--;
     }
-    if (n && *s != c) {
+    if (n > 0 && *s != c) {
         zpl_isize const *w;
         zpl_isize k = ZPL__ONES * c;
         w = cast(zpl_isize const *) s;
@@ -50,23 +144,855 @@ void const *zpl_memchr(void const *data, zpl_u8 c, zpl_isize n) {
             n -= zpl_size_of(zpl_isize);
         }
         s = cast(zpl_u8 const *) w;
-        while (n && *s != c) {
+        while (n > 0 && *s != c) {
             s++;
             n--;
         }
     }
 
-    return n ? cast(void const *) s : NULL;
+    return (n > 0) ? cast(void const *) s : NULL;
 }
 
-void const *zpl_memrchr(void const *data, zpl_u8 c, zpl_isize n) {
+zpl_internal void const *zpl__memrchr_scalar(void const *data, zpl_u8 c, zpl_isize n) {
     zpl_u8 const *s = cast(zpl_u8 const *) data;
-    while (n--) {
+    while (n-- > 0) {
         if (s[n] == c) return cast(void const *)(s + n);
     }
     return NULL;
 }
 
+zpl_internal char const *zpl__str_find_scalar(char const *str, char c) {
+    while (*str && *str != c) { ++str; }
+    return str;
+}
+
+zpl_internal char const *zpl__str_skip_space_scalar(char const *str, zpl_b32 catch_newline) {
+    while (*str && (*str == ' ' || (*str >= '\t' && *str <= '\r')) && (!catch_newline || *str != '\n')) { ++str; }
+    return str;
+}
+
+zpl_internal char const *zpl__str_find_any_scalar(char const *str, char const *set, zpl_isize len) {
+    zpl_u32 bits[8] = {1}; // NUL always terminates
+    zpl_u8 const *s = cast(zpl_u8 const *)str;
+    for (zpl_isize i = 0; i < len; i++) {
+        zpl_u8 b = cast(zpl_u8)set[i];
+        bits[b >> 5] |= 1u << (b & 31);
+    }
+    while (!(bits[*s >> 5] & (1u << (*s & 31)))) { ++s; }
+    return cast(char const *)s;
+}
+
+zpl_internal void const *zpl__memchr_any_scalar(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize len) {
+    zpl_u32 bits[8] = {0};
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    for (zpl_isize i = 0; i < len; i++) bits[set[i] >> 5] |= 1u << (set[i] & 31);
+    for (; n > 0; ++s, --n) {
+        if (bits[*s >> 5] & (1u << (*s & 31))) return s;
+    }
+    return NULL;
+}
+
+zpl_internal void const *zpl__memchr_pair_scalar(void const *data, zpl_isize n, zpl_u8 const *first, zpl_u8 const *second, zpl_isize len) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    for (zpl_isize i = 0; i + 1 < n; i++) {
+        for (zpl_isize k = 0; k < len; k++) {
+            if (s[i] == first[k] && s[i + 1] == second[k]) return s + i;
+        }
+    }
+    return NULL;
+}
+
+zpl_internal zpl_isize zpl__ascii_span_scalar(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0;
+    while ((cast(zpl_uintptr)(s + i) & (sizeof(zpl_usize) - 1)) && i < n && s[i] < 0x80) i++;
+    if (i < n && s[i] < 0x80) {
+        while (i + zpl_size_of(zpl_usize) <= n && !(*cast(zpl_usize const *)(s + i) & ZPL__HIGHS)) i += zpl_size_of(zpl_usize);
+        while (i < n && s[i] < 0x80) i++;
+    }
+    return i;
+}
+
+/* width of the well-formed multi-byte sequence at s, 0 if it's invalid or cut short */
+zpl_internal ZPL_ALWAYS_INLINE zpl_isize zpl__utf8_sequence(zpl_u8 const *s, zpl_isize n) {
+    zpl_u8 c = s[0], lo = 0x80, hi = 0xbf;
+    zpl_isize sz;
+    if (c < 0xc2) return 0;
+    else if (c < 0xe0) sz = 2;
+    else if (c < 0xf0) {
+        sz = 3;
+        if (c == 0xe0) lo = 0xa0;      // overlong
+        else if (c == 0xed) hi = 0x9f; // surrogates
+    } else if (c < 0xf5) {
+        sz = 4;
+        if (c == 0xf0) lo = 0x90;      // overlong
+        else if (c == 0xf4) hi = 0x8f; // above U+10FFFF
+    } else return 0;
+    if (n < sz || s[1] < lo || s[1] > hi) return 0;
+    if (sz > 2 && (s[2] & 0xc0) != 0x80) return 0;
+    if (sz > 3 && (s[3] & 0xc0) != 0x80) return 0;
+    return sz;
+}
+
+zpl_internal zpl_isize zpl__utf8_validate_scalar(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0, w;
+    while (i < n) {
+        if (s[i] < 0x80) { i += (i + 1 < n && s[i + 1] < 0x80) ? zpl__ascii_span_scalar(s + i, n - i) : 1; continue; }
+        if ((w = zpl__utf8_sequence(s + i, n - i)) == 0) return i;
+        i += w;
+    }
+    return n;
+}
+
+/* SSE2 */
+
+#if defined(ZPL__SIMD_SSE2)
+zpl_internal ZPL_ALWAYS_INLINE __m128i zpl__sse2_is_space(__m128i v, zpl_b32 catch_newline) {
+    /* ' ' or \t..\r, the unsigned range check is min(v - 9, 4) == v - 9 */
+    __m128i t = _mm_sub_epi8(v, _mm_set1_epi8(9));
+    __m128i r = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(4)), t));
+    if (catch_newline) r = _mm_andnot_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), r);
+    return r;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE void const *zpl__memchr_sse2(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    __m128i vc = _mm_set1_epi8(cast(char)c);
+    zpl_u32 mask;
+    if (n < 16) return zpl__memchr_scalar(s, c, n);
+    for (; n >= 16; s += 16, n -= 16) {
+        mask = cast(zpl_u32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(cast(__m128i const *)s), vc));
+        if (mask) return s + zpl__simd_ctz(mask);
+    }
+    if (n == 0) return NULL;
+    /* the tail overlaps bytes already checked, skip their lanes */
+    mask = cast(zpl_u32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(cast(__m128i const *)(s + n - 16)), vc)) >> (16 - n);
+    return mask ? s + zpl__simd_ctz(mask) : NULL;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE void const *zpl__memrchr_sse2(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    __m128i vc = _mm_set1_epi8(cast(char)c);
+    zpl_u32 mask;
+    if (n < 16) return zpl__memrchr_scalar(s, c, n);
+    for (; n >= 16; n -= 16) {
+        mask = cast(zpl_u32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(cast(__m128i const *)(s + n - 16)), vc));
+        if (mask) return s + n - 16 + zpl__simd_msb(mask);
+    }
+    if (n == 0) return NULL;
+    mask = cast(zpl_u32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(cast(__m128i const *)s), vc)) & ((1u << n) - 1);
+    return mask ? s + zpl__simd_msb(mask) : NULL;
+}
+
+ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_find_sse2(char const *str, char c) {
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 15);
+    __m128i const *p = cast(__m128i const *)(str - off);
+    __m128i vc = _mm_set1_epi8(c), z = _mm_setzero_si128();
+    __m128i v = _mm_load_si128(p);
+    zpl_u32 mask = cast(zpl_u32)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, vc), _mm_cmpeq_epi8(v, z))) >> off;
+    if (mask) return str + zpl__simd_ctz(mask);
+    for (;;) {
+        v = _mm_load_si128(++p);
+        mask = cast(zpl_u32)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, vc), _mm_cmpeq_epi8(v, z)));
+        if (mask) return cast(char const *)p + zpl__simd_ctz(mask);
+    }
+}
+
+ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_skip_space_sse2(char const *str, zpl_b32 catch_newline) {
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 15);
+    __m128i const *p = cast(__m128i const *)(str - off);
+    zpl_u32 mask = (~cast(zpl_u32)_mm_movemask_epi8(zpl__sse2_is_space(_mm_load_si128(p), catch_newline)) & 0xFFFF) >> off;
+    if (mask) return str + zpl__simd_ctz(mask);
+    for (;;) {
+        mask = ~cast(zpl_u32)_mm_movemask_epi8(zpl__sse2_is_space(_mm_load_si128(++p), catch_newline)) & 0xFFFF;
+        if (mask) return cast(char const *)p + zpl__simd_ctz(mask);
+    }
+}
+
+ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_find_any_sse2(char const *str, char const *set, zpl_isize len) {
+    __m128i sv[16], z = _mm_setzero_si128();
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 15);
+    __m128i const *p = cast(__m128i const *)(str - off);
+    zpl_u32 mask;
+    if (len > zpl_count_of(sv)) return zpl__str_find_any_scalar(str, set, len);
+    for (zpl_isize i = 0; i < len; i++) sv[i] = _mm_set1_epi8(set[i]);
+    for (;; ++p, off = 0) {
+        __m128i v = _mm_load_si128(p);
+        __m128i r = _mm_cmpeq_epi8(v, z);
+        for (zpl_isize i = 0; i < len; i++) r = _mm_or_si128(r, _mm_cmpeq_epi8(v, sv[i]));
+        mask = cast(zpl_u32)_mm_movemask_epi8(r) >> off;
+        if (mask) return cast(char const *)p + off + zpl__simd_ctz(mask);
+    }
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u32 zpl__sse2_any_of(__m128i v, __m128i const *sv, zpl_isize len) {
+    __m128i r = _mm_cmpeq_epi8(v, sv[0]);
+    for (zpl_isize i = 1; i < len; i++) r = _mm_or_si128(r, _mm_cmpeq_epi8(v, sv[i]));
+    return cast(zpl_u32)_mm_movemask_epi8(r);
+}
+
+zpl_internal ZPL_ALWAYS_INLINE void const *zpl__memchr_any_sse2(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize len) {
+    __m128i sv[16];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u32 mask;
+    if (n < 16 || len > zpl_count_of(sv)) return zpl__memchr_any_scalar(s, n, set, len);
+    for (zpl_isize i = 0; i < len; i++) sv[i] = _mm_set1_epi8(cast(char)set[i]);
+    for (; n >= 16; s += 16, n -= 16) {
+        mask = zpl__sse2_any_of(_mm_loadu_si128(cast(__m128i const *)s), sv, len);
+        if (mask) return s + zpl__simd_ctz(mask);
+    }
+    if (n == 0) return NULL;
+    mask = zpl__sse2_any_of(_mm_loadu_si128(cast(__m128i const *)(s + n - 16)), sv, len) >> (16 - n);
+    return mask ? s + zpl__simd_ctz(mask) : NULL;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u32 zpl__sse2_pair_of(zpl_u8 const *s, __m128i const *a, __m128i const *b, zpl_isize len) {
+    __m128i v0 = _mm_loadu_si128(cast(__m128i const *)s), v1 = _mm_loadu_si128(cast(__m128i const *)(s + 1));
+    __m128i r = _mm_and_si128(_mm_cmpeq_epi8(v0, a[0]), _mm_cmpeq_epi8(v1, b[0]));
+    for (zpl_isize i = 1; i < len; i++) r = _mm_or_si128(r, _mm_and_si128(_mm_cmpeq_epi8(v0, a[i]), _mm_cmpeq_epi8(v1, b[i])));
+    return cast(zpl_u32)_mm_movemask_epi8(r);
+}
+
+zpl_internal ZPL_ALWAYS_INLINE void const *zpl__memchr_pair_sse2(void const *data, zpl_isize n, zpl_u8 const *first, zpl_u8 const *second, zpl_isize len) {
+    __m128i a[8], b[8];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u32 mask;
+    if (n < 17 || len > zpl_count_of(a)) return zpl__memchr_pair_scalar(s, n, first, second, len);
+    for (zpl_isize i = 0; i < len; i++) a[i] = _mm_set1_epi8(cast(char)first[i]), b[i] = _mm_set1_epi8(cast(char)second[i]);
+    /* a block checks 16 positions and reads one byte past them */
+    for (; n >= 17; s += 16, n -= 16) {
+        mask = zpl__sse2_pair_of(s, a, b, len);
+        if (mask) return s + zpl__simd_ctz(mask);
+    }
+    if (n < 2) return NULL;
+    mask = zpl__sse2_pair_of(s + n - 17, a, b, len) >> (17 - n);
+    return mask ? s + zpl__simd_ctz(mask) : NULL;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_isize zpl__ascii_span_sse2(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0;
+    zpl_u32 mask;
+    if (n < 16) return zpl__ascii_span_scalar(s, n);
+    for (; i + 16 <= n; i += 16) {
+        mask = cast(zpl_u32)_mm_movemask_epi8(_mm_loadu_si128(cast(__m128i const *)(s + i)));
+        if (mask) return i + zpl__simd_ctz(mask);
+    }
+    if (i == n) return n;
+    mask = cast(zpl_u32)_mm_movemask_epi8(_mm_loadu_si128(cast(__m128i const *)(s + n - 16))) >> (i + 16 - n);
+    return mask ? i + zpl__simd_ctz(mask) : n;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_isize zpl__utf8_validate_sse2(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0, w;
+    while (i < n) {
+        if (s[i] < 0x80) { i += (i + 1 < n && s[i + 1] < 0x80) ? zpl__ascii_span_sse2(s + i, n - i) : 1; continue; }
+        if ((w = zpl__utf8_sequence(s + i, n - i)) == 0) return i;
+        i += w;
+    }
+    return n;
+}
+#endif
+
+/* AVX2 */
+
+#if defined(ZPL__SIMD_AVX2)
+ZPL__SIMD_TARGET_AVX2 zpl_internal ZPL_ALWAYS_INLINE __m256i zpl__avx2_is_space(__m256i v, zpl_b32 catch_newline) {
+    __m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8(9));
+    __m256i r = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(4)), t));
+    if (catch_newline) r = _mm256_andnot_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), r);
+    return r;
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal void const *zpl__memchr_avx2(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    __m256i vc;
+    zpl_u32 mask;
+    /* the SSE2 kernels are inlined here, so short inputs stay VEX encoded and don't stall on dirty upper lanes */
+    if (n < 32) return zpl__memchr_sse2(s, c, n);
+    vc = _mm256_set1_epi8(cast(char)c);
+    for (; n >= 32; s += 32, n -= 32) {
+        mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(cast(__m256i const *)s), vc));
+        if (mask) return s + zpl__simd_ctz(mask);
+    }
+    if (n == 0) return NULL;
+    mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(cast(__m256i const *)(s + n - 32)), vc)) >> (32 - n);
+    return mask ? s + zpl__simd_ctz(mask) : NULL;
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal void const *zpl__memrchr_avx2(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    __m256i vc;
+    zpl_u32 mask;
+    if (n < 32) return zpl__memrchr_sse2(s, c, n);
+    vc = _mm256_set1_epi8(cast(char)c);
+    for (; n >= 32; n -= 32) {
+        mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(cast(__m256i const *)(s + n - 32)), vc));
+        if (mask) return s + n - 32 + zpl__simd_msb(mask);
+    }
+    if (n == 0) return NULL;
+    mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(cast(__m256i const *)s), vc)) & ((1u << n) - 1);
+    return mask ? s + zpl__simd_msb(mask) : NULL;
+}
+
+ZPL__SIMD_TARGET_AVX2 ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_find_avx2(char const *str, char c) {
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 31);
+    __m256i const *p = cast(__m256i const *)(str - off);
+    __m256i vc = _mm256_set1_epi8(c), z = _mm256_setzero_si256();
+    __m256i v = _mm256_load_si256(p);
+    zpl_u32 mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, vc), _mm256_cmpeq_epi8(v, z))) >> off;
+    if (mask) return str + zpl__simd_ctz(mask);
+    for (;;) {
+        v = _mm256_load_si256(++p);
+        mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, vc), _mm256_cmpeq_epi8(v, z)));
+        if (mask) return cast(char const *)p + zpl__simd_ctz(mask);
+    }
+}
+
+ZPL__SIMD_TARGET_AVX2 ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_skip_space_avx2(char const *str, zpl_b32 catch_newline) {
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 31);
+    __m256i const *p = cast(__m256i const *)(str - off);
+    zpl_u32 mask = ~cast(zpl_u32)_mm256_movemask_epi8(zpl__avx2_is_space(_mm256_load_si256(p), catch_newline)) >> off;
+    if (mask) return str + zpl__simd_ctz(mask);
+    for (;;) {
+        mask = ~cast(zpl_u32)_mm256_movemask_epi8(zpl__avx2_is_space(_mm256_load_si256(++p), catch_newline));
+        if (mask) return cast(char const *)p + zpl__simd_ctz(mask);
+    }
+}
+
+ZPL__SIMD_TARGET_AVX2 ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_find_any_avx2(char const *str, char const *set, zpl_isize len) {
+    __m256i sv[16], z = _mm256_setzero_si256();
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 31);
+    __m256i const *p = cast(__m256i const *)(str - off);
+    zpl_u32 mask;
+    if (len > zpl_count_of(sv)) return zpl__str_find_any_scalar(str, set, len);
+    for (zpl_isize i = 0; i < len; i++) sv[i] = _mm256_set1_epi8(set[i]);
+    for (;; ++p, off = 0) {
+        __m256i v = _mm256_load_si256(p);
+        __m256i r = _mm256_cmpeq_epi8(v, z);
+        for (zpl_isize i = 0; i < len; i++) r = _mm256_or_si256(r, _mm256_cmpeq_epi8(v, sv[i]));
+        mask = cast(zpl_u32)_mm256_movemask_epi8(r) >> off;
+        if (mask) return cast(char const *)p + off + zpl__simd_ctz(mask);
+    }
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal ZPL_ALWAYS_INLINE zpl_u32 zpl__avx2_any_of(__m256i v, __m256i const *sv, zpl_isize len) {
+    __m256i r = _mm256_cmpeq_epi8(v, sv[0]);
+    for (zpl_isize i = 1; i < len; i++) r = _mm256_or_si256(r, _mm256_cmpeq_epi8(v, sv[i]));
+    return cast(zpl_u32)_mm256_movemask_epi8(r);
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal void const *zpl__memchr_any_avx2(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize len) {
+    __m256i sv[16];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u32 mask;
+    if (n < 32 || len > zpl_count_of(sv)) return zpl__memchr_any_sse2(s, n, set, len);
+    for (zpl_isize i = 0; i < len; i++) sv[i] = _mm256_set1_epi8(cast(char)set[i]);
+    for (; n >= 32; s += 32, n -= 32) {
+        mask = zpl__avx2_any_of(_mm256_loadu_si256(cast(__m256i const *)s), sv, len);
+        if (mask) return s + zpl__simd_ctz(mask);
+    }
+    if (n == 0) return NULL;
+    mask = zpl__avx2_any_of(_mm256_loadu_si256(cast(__m256i const *)(s + n - 32)), sv, len) >> (32 - n);
+    return mask ? s + zpl__simd_ctz(mask) : NULL;
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal ZPL_ALWAYS_INLINE zpl_u32 zpl__avx2_pair_of(zpl_u8 const *s, __m256i const *a, __m256i const *b, zpl_isize len) {
+    __m256i v0 = _mm256_loadu_si256(cast(__m256i const *)s), v1 = _mm256_loadu_si256(cast(__m256i const *)(s + 1));
+    __m256i r = _mm256_and_si256(_mm256_cmpeq_epi8(v0, a[0]), _mm256_cmpeq_epi8(v1, b[0]));
+    for (zpl_isize i = 1; i < len; i++) r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpeq_epi8(v0, a[i]), _mm256_cmpeq_epi8(v1, b[i])));
+    return cast(zpl_u32)_mm256_movemask_epi8(r);
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal void const *zpl__memchr_pair_avx2(void const *data, zpl_isize n, zpl_u8 const *first, zpl_u8 const *second, zpl_isize len) {
+    __m256i a[8], b[8];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u32 mask;
+    if (n < 33 || len > zpl_count_of(a)) return zpl__memchr_pair_sse2(s, n, first, second, len);
+    for (zpl_isize i = 0; i < len; i++) a[i] = _mm256_set1_epi8(cast(char)first[i]), b[i] = _mm256_set1_epi8(cast(char)second[i]);
+    for (; n >= 33; s += 32, n -= 32) {
+        mask = zpl__avx2_pair_of(s, a, b, len);
+        if (mask) return s + zpl__simd_ctz(mask);
+    }
+    if (n < 2) return NULL;
+    mask = zpl__avx2_pair_of(s + n - 33, a, b, len) >> (33 - n);
+    return mask ? s + zpl__simd_ctz(mask) : NULL;
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal zpl_isize zpl__ascii_span_avx2(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0;
+    zpl_u32 mask;
+    if (n < 32) return zpl__ascii_span_sse2(s, n);
+    for (; i + 32 <= n; i += 32) {
+        mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_loadu_si256(cast(__m256i const *)(s + i)));
+        if (mask) return i + zpl__simd_ctz(mask);
+    }
+    if (i == n) return n;
+    mask = cast(zpl_u32)_mm256_movemask_epi8(_mm256_loadu_si256(cast(__m256i const *)(s + n - 32))) >> (i + 32 - n);
+    return mask ? i + zpl__simd_ctz(mask) : n;
+}
+
+/* input shifted by k bytes towards the end, the gap filled from the previous block */
+#define zpl__avx2_prev(input, prev, k) _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - (k))
+
+/*
+ * Classifies every byte pair by the high nibble of the first byte, its low nibble and the high nibble
+ * of the second byte. Each table marks the error classes a nibble is compatible with, so a bit surviving
+ * the AND of all three is an error. The one exception are continuations expected as the 3rd or 4th byte,
+ * those are reported as TWO_CONTS and cancelled out by the lead byte two or three positions back.
+ * See "Validating UTF-8 In Less Than One Instruction Per Byte" by Keiser and Lemire.
+ */
+ZPL__SIMD_TARGET_AVX2 zpl_internal ZPL_ALWAYS_INLINE __m256i zpl__avx2_utf8_check(__m256i input, __m256i prev_input) {
+    enum {
+        TOO_SHORT = 1 << 0, TOO_LONG = 1 << 1, OVERLONG_3 = 1 << 2, TOO_LARGE = 1 << 3, SURROGATE = 1 << 4,
+        OVERLONG_2 = 1 << 5, TOO_LARGE_1000 = 1 << 6, OVERLONG_4 = 1 << 6, TWO_CONTS = 1 << 7,
+        CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS,
+    };
+    __m256i const low_nibble = _mm256_set1_epi8(0x0f);
+    __m256i const byte_1_high = _mm256_setr_epi8(
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+        TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+        TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+        TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+        TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+    __m256i const byte_1_low = _mm256_setr_epi8(
+        CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY, CARRY,
+        CARRY | TOO_LARGE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY, CARRY,
+        CARRY | TOO_LARGE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000);
+    __m256i const byte_2_high = _mm256_setr_epi8(
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+    __m256i prev1 = zpl__avx2_prev(input, prev_input, 1);
+    __m256i special = _mm256_and_si256(_mm256_and_si256(
+        _mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble)),
+        _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, low_nibble))),
+        _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble)));
+    /* 0xe0+ two bytes back or 0xf0+ three bytes back, the saturated difference keeps its top bit */
+    __m256i is_third = _mm256_subs_epu8(zpl__avx2_prev(input, prev_input, 2), _mm256_set1_epi8(0xe0 - 0x80));
+    __m256i is_fourth = _mm256_subs_epu8(zpl__avx2_prev(input, prev_input, 3), _mm256_set1_epi8(cast(char)(0xf0 - 0x80)));
+    __m256i must_be_cont = _mm256_and_si256(_mm256_or_si256(is_third, is_fourth), _mm256_set1_epi8(cast(char)0x80));
+    return _mm256_xor_si256(must_be_cont, special);
+}
+
+ZPL__SIMD_TARGET_AVX2 zpl_internal zpl_isize zpl__utf8_validate_avx2(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0, k;
+    __m256i error = _mm256_setzero_si256(), prev_input = error, prev_incomplete = error;
+    /* a block ending within a sequence leaves a byte above these limits in one of its last 3 lanes */
+    __m256i const max_value = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                               -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                               cast(char)(0xf0 - 1), cast(char)(0xe0 - 1), cast(char)(0xc0 - 1));
+    if (n < 32) return zpl__utf8_validate_sse2(s, n);
+    for (; i + 32 <= n; i += 32) {
+        __m256i input = _mm256_loadu_si256(cast(__m256i const *)(s + i));
+        if (!_mm256_movemask_epi8(input)) {
+            error = prev_incomplete;
+        } else {
+            error = zpl__avx2_utf8_check(input, prev_input);
+            prev_incomplete = _mm256_subs_epu8(input, max_value);
+        }
+        if (!_mm256_testz_si256(error, error)) break;
+        prev_input = input;
+    }
+    /* resume from the start of the sequence the last clean block ended in, that also locates any error */
+    for (k = 0; k < 3 && i - k > 0 && (s[i - k - 1] & 0xc0) == 0x80; k++) {}
+    if (i - k > 0 && s[i - k - 1] >= 0xc0) k++;
+    i -= k;
+    k = zpl__utf8_validate_sse2(s + i, n - i);
+    return i + k;
+}
+
+#undef zpl__avx2_prev
+#endif
+
+/* NEON */
+
+#if defined(ZPL__SIMD_NEON)
+/* narrows a byte mask to 4 bits per lane, so bit index / 4 is the lane */
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__neon_mask(uint8x16_t v) {
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+}
+
+zpl_internal ZPL_ALWAYS_INLINE uint8x16_t zpl__neon_is_space(uint8x16_t v, zpl_b32 catch_newline) {
+    uint8x16_t r = vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vcltq_u8(vsubq_u8(v, vdupq_n_u8(9)), vdupq_n_u8(5)));
+    if (catch_newline) r = vbicq_u8(r, vceqq_u8(v, vdupq_n_u8('\n')));
+    return r;
+}
+
+zpl_internal void const *zpl__memchr_neon(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    uint8x16_t vc = vdupq_n_u8(c);
+    zpl_u64 mask;
+    if (n < 16) return zpl__memchr_scalar(s, c, n);
+    for (; n >= 16; s += 16, n -= 16) {
+        mask = zpl__neon_mask(vceqq_u8(vld1q_u8(s), vc));
+        if (mask) return s + (zpl__simd_ctz(mask) >> 2);
+    }
+    if (n == 0) return NULL;
+    mask = zpl__neon_mask(vceqq_u8(vld1q_u8(s + n - 16), vc)) >> ((16 - n) * 4);
+    return mask ? s + (zpl__simd_ctz(mask) >> 2) : NULL;
+}
+
+zpl_internal void const *zpl__memrchr_neon(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    uint8x16_t vc = vdupq_n_u8(c);
+    zpl_u64 mask;
+    if (n < 16) return zpl__memrchr_scalar(s, c, n);
+    for (; n >= 16; n -= 16) {
+        mask = zpl__neon_mask(vceqq_u8(vld1q_u8(s + n - 16), vc));
+        if (mask) return s + n - 16 + (zpl__simd_msb(mask) >> 2);
+    }
+    if (n == 0) return NULL;
+    mask = zpl__neon_mask(vceqq_u8(vld1q_u8(s), vc)) & ((1ull << (n * 4)) - 1);
+    return mask ? s + (zpl__simd_msb(mask) >> 2) : NULL;
+}
+
+ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_find_neon(char const *str, char c) {
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 15);
+    zpl_u8 const *p = cast(zpl_u8 const *)(str - off);
+    uint8x16_t vc = vdupq_n_u8(cast(zpl_u8)c);
+    for (;; p += 16, off = 0) {
+        uint8x16_t v = vld1q_u8(p);
+        zpl_u64 mask = zpl__neon_mask(vorrq_u8(vceqq_u8(v, vc), vceqzq_u8(v))) >> (off * 4);
+        if (mask) return cast(char const *)p + off + (zpl__simd_ctz(mask) >> 2);
+    }
+}
+
+ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_skip_space_neon(char const *str, zpl_b32 catch_newline) {
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 15);
+    zpl_u8 const *p = cast(zpl_u8 const *)(str - off);
+    for (;; p += 16, off = 0) {
+        zpl_u64 mask = zpl__neon_mask(vmvnq_u8(zpl__neon_is_space(vld1q_u8(p), catch_newline))) >> (off * 4);
+        if (mask) return cast(char const *)p + off + (zpl__simd_ctz(mask) >> 2);
+    }
+}
+
+ZPL__SIMD_NO_ASAN zpl_internal char const *zpl__str_find_any_neon(char const *str, char const *set, zpl_isize len) {
+    uint8x16_t sv[16];
+    zpl_isize off = cast(zpl_isize)(cast(zpl_uintptr)str & 15);
+    zpl_u8 const *p = cast(zpl_u8 const *)(str - off);
+    if (len > zpl_count_of(sv)) return zpl__str_find_any_scalar(str, set, len);
+    for (zpl_isize i = 0; i < len; i++) sv[i] = vdupq_n_u8(cast(zpl_u8)set[i]);
+    for (;; p += 16, off = 0) {
+        uint8x16_t v = vld1q_u8(p);
+        uint8x16_t r = vceqzq_u8(v);
+        zpl_u64 mask;
+        for (zpl_isize i = 0; i < len; i++) r = vorrq_u8(r, vceqq_u8(v, sv[i]));
+        mask = zpl__neon_mask(r) >> (off * 4);
+        if (mask) return cast(char const *)p + off + (zpl__simd_ctz(mask) >> 2);
+    }
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__neon_any_of(uint8x16_t v, uint8x16_t const *sv, zpl_isize len) {
+    uint8x16_t r = vceqq_u8(v, sv[0]);
+    for (zpl_isize i = 1; i < len; i++) r = vorrq_u8(r, vceqq_u8(v, sv[i]));
+    return zpl__neon_mask(r);
+}
+
+zpl_internal void const *zpl__memchr_any_neon(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize len) {
+    uint8x16_t sv[16];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u64 mask;
+    if (n < 16 || len > zpl_count_of(sv)) return zpl__memchr_any_scalar(s, n, set, len);
+    for (zpl_isize i = 0; i < len; i++) sv[i] = vdupq_n_u8(set[i]);
+    for (; n >= 16; s += 16, n -= 16) {
+        mask = zpl__neon_any_of(vld1q_u8(s), sv, len);
+        if (mask) return s + (zpl__simd_ctz(mask) >> 2);
+    }
+    if (n == 0) return NULL;
+    mask = zpl__neon_any_of(vld1q_u8(s + n - 16), sv, len) >> ((16 - n) * 4);
+    return mask ? s + (zpl__simd_ctz(mask) >> 2) : NULL;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__neon_pair_of(zpl_u8 const *s, uint8x16_t const *a, uint8x16_t const *b, zpl_isize len) {
+    uint8x16_t v0 = vld1q_u8(s), v1 = vld1q_u8(s + 1);
+    uint8x16_t r = vandq_u8(vceqq_u8(v0, a[0]), vceqq_u8(v1, b[0]));
+    for (zpl_isize i = 1; i < len; i++) r = vorrq_u8(r, vandq_u8(vceqq_u8(v0, a[i]), vceqq_u8(v1, b[i])));
+    return zpl__neon_mask(r);
+}
+
+zpl_internal void const *zpl__memchr_pair_neon(void const *data, zpl_isize n, zpl_u8 const *first, zpl_u8 const *second, zpl_isize len) {
+    uint8x16_t a[8], b[8];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u64 mask;
+    if (n < 17 || len > zpl_count_of(a)) return zpl__memchr_pair_scalar(s, n, first, second, len);
+    for (zpl_isize i = 0; i < len; i++) a[i] = vdupq_n_u8(first[i]), b[i] = vdupq_n_u8(second[i]);
+    for (; n >= 17; s += 16, n -= 16) {
+        mask = zpl__neon_pair_of(s, a, b, len);
+        if (mask) return s + (zpl__simd_ctz(mask) >> 2);
+    }
+    if (n < 2) return NULL;
+    mask = zpl__neon_pair_of(s + n - 17, a, b, len) >> ((17 - n) * 4);
+    return mask ? s + (zpl__simd_ctz(mask) >> 2) : NULL;
+}
+
+zpl_internal zpl_isize zpl__ascii_span_neon(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    uint8x16_t high = vdupq_n_u8(0x80);
+    zpl_isize i = 0;
+    zpl_u64 mask;
+    if (n < 16) return zpl__ascii_span_scalar(s, n);
+    for (; i + 16 <= n; i += 16) {
+        mask = zpl__neon_mask(vtstq_u8(vld1q_u8(s + i), high));
+        if (mask) return i + (zpl__simd_ctz(mask) >> 2);
+    }
+    if (i == n) return n;
+    mask = zpl__neon_mask(vtstq_u8(vld1q_u8(s + n - 16), high)) >> ((i + 16 - n) * 4);
+    return mask ? i + (zpl__simd_ctz(mask) >> 2) : n;
+}
+
+zpl_internal zpl_isize zpl__utf8_validate_neon_tail(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0, w;
+    while (i < n) {
+        if (s[i] < 0x80) { i += (i + 1 < n && s[i + 1] < 0x80) ? zpl__ascii_span_neon(s + i, n - i) : 1; continue; }
+        if ((w = zpl__utf8_sequence(s + i, n - i)) == 0) return i;
+        i += w;
+    }
+    return n;
+}
+
+/* the same nibble classification as zpl__avx2_utf8_check, vqtbl1q_u8 does the table lookups */
+zpl_internal ZPL_ALWAYS_INLINE uint8x16_t zpl__neon_utf8_check(uint8x16_t input, uint8x16_t prev_input) {
+    enum {
+        TOO_SHORT = 1 << 0, TOO_LONG = 1 << 1, OVERLONG_3 = 1 << 2, TOO_LARGE = 1 << 3, SURROGATE = 1 << 4,
+        OVERLONG_2 = 1 << 5, TOO_LARGE_1000 = 1 << 6, OVERLONG_4 = 1 << 6, TWO_CONTS = 1 << 7,
+        CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS,
+    };
+    zpl_local_persist zpl_u8 const byte_1_high[16] = {
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+        TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+        TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+    };
+    zpl_local_persist zpl_u8 const byte_1_low[16] = {
+        CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY, CARRY,
+        CARRY | TOO_LARGE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+    };
+    zpl_local_persist zpl_u8 const byte_2_high[16] = {
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    };
+    uint8x16_t prev1 = vextq_u8(prev_input, input, 15);
+    uint8x16_t special = vandq_u8(vandq_u8(
+        vqtbl1q_u8(vld1q_u8(byte_1_high), vshrq_n_u8(prev1, 4)),
+        vqtbl1q_u8(vld1q_u8(byte_1_low), vandq_u8(prev1, vdupq_n_u8(0x0f)))),
+        vqtbl1q_u8(vld1q_u8(byte_2_high), vshrq_n_u8(input, 4)));
+    /* 0xe0+ two bytes back or 0xf0+ three bytes back, the saturated difference keeps its top bit */
+    uint8x16_t is_third = vqsubq_u8(vextq_u8(prev_input, input, 14), vdupq_n_u8(0xe0 - 0x80));
+    uint8x16_t is_fourth = vqsubq_u8(vextq_u8(prev_input, input, 13), vdupq_n_u8(0xf0 - 0x80));
+    uint8x16_t must_be_cont = vandq_u8(vorrq_u8(is_third, is_fourth), vdupq_n_u8(0x80));
+    return veorq_u8(must_be_cont, special);
+}
+
+zpl_internal zpl_isize zpl__utf8_validate_neon(void const *data, zpl_isize n) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_isize i = 0, k;
+    uint8x16_t error = vdupq_n_u8(0), prev_input = error, prev_incomplete = error;
+    /* a block ending within a sequence leaves a byte above these limits in one of its last 3 lanes */
+    zpl_local_persist zpl_u8 const max_value[16] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                                     0xf0 - 1, 0xe0 - 1, 0xc0 - 1 };
+    uint8x16_t const limits = vld1q_u8(max_value);
+    if (n < 16) return zpl__utf8_validate_neon_tail(s, n);
+    for (; i + 16 <= n; i += 16) {
+        uint8x16_t input = vld1q_u8(s + i);
+        if (vmaxvq_u8(input) < 0x80) {
+            error = prev_incomplete;
+        } else {
+            error = zpl__neon_utf8_check(input, prev_input);
+            prev_incomplete = vqsubq_u8(input, limits);
+        }
+        if (vmaxvq_u8(error)) break;
+        prev_input = input;
+    }
+    /* resume from the start of the sequence the last clean block ended in, that also locates any error */
+    for (k = 0; k < 3 && i - k > 0 && (s[i - k - 1] & 0xc0) == 0x80; k++) {}
+    if (i - k > 0 && s[i - k - 1] >= 0xc0) k++;
+    i -= k;
+    k = zpl__utf8_validate_neon_tail(s + i, n - i);
+    return i + k;
+}
+#endif
+
+/* dispatch */
+
+zpl_internal void zpl__simd_resolve(void);
+
+zpl_internal void const *zpl__memchr_resolve(void const *data, zpl_u8 c, zpl_isize n);
+zpl_internal void const *zpl__memrchr_resolve(void const *data, zpl_u8 c, zpl_isize n);
+zpl_internal char const *zpl__str_find_resolve(char const *str, char c);
+zpl_internal char const *zpl__str_skip_space_resolve(char const *str, zpl_b32 catch_newline);
+zpl_internal char const *zpl__str_find_any_resolve(char const *str, char const *set, zpl_isize len);
+zpl_internal void const *zpl__memchr_any_resolve(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize len);
+zpl_internal void const *zpl__memchr_pair_resolve(void const *data, zpl_isize n, zpl_u8 const *first, zpl_u8 const *second, zpl_isize len);
+zpl_internal zpl_isize zpl__ascii_span_resolve(void const *data, zpl_isize n);
+zpl_internal zpl_isize zpl__utf8_validate_resolve(void const *data, zpl_isize n);
+
+zpl_global zpl__simd_ops zpl__simd = {
+    zpl__memchr_resolve, zpl__memrchr_resolve, zpl__str_find_resolve, zpl__str_skip_space_resolve, zpl__str_find_any_resolve,
+    zpl__memchr_any_resolve, zpl__memchr_pair_resolve, zpl__ascii_span_resolve, zpl__utf8_validate_resolve
+};
+zpl_global zpl_simd_level zpl__simd_level_active = ZPL_SIMD_SCALAR;
+
+zpl_internal void const *zpl__memchr_resolve(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl__simd_resolve();
+    return zpl__simd.memchr(data, c, n);
+}
+
+zpl_internal void const *zpl__memrchr_resolve(void const *data, zpl_u8 c, zpl_isize n) {
+    zpl__simd_resolve();
+    return zpl__simd.memrchr(data, c, n);
+}
+
+zpl_internal char const *zpl__str_find_resolve(char const *str, char c) {
+    zpl__simd_resolve();
+    return zpl__simd.str_find(str, c);
+}
+
+zpl_internal char const *zpl__str_skip_space_resolve(char const *str, zpl_b32 catch_newline) {
+    zpl__simd_resolve();
+    return zpl__simd.str_skip_space(str, catch_newline);
+}
+
+zpl_internal char const *zpl__str_find_any_resolve(char const *str, char const *set, zpl_isize len) {
+    zpl__simd_resolve();
+    return zpl__simd.str_find_any(str, set, len);
+}
+
+zpl_internal void const *zpl__memchr_any_resolve(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize len) {
+    zpl__simd_resolve();
+    return zpl__simd.memchr_any(data, n, set, len);
+}
+
+zpl_internal void const *zpl__memchr_pair_resolve(void const *data, zpl_isize n, zpl_u8 const *first, zpl_u8 const *second, zpl_isize len) {
+    zpl__simd_resolve();
+    return zpl__simd.memchr_pair(data, n, first, second, len);
+}
+
+zpl_internal zpl_isize zpl__ascii_span_resolve(void const *data, zpl_isize n) {
+    zpl__simd_resolve();
+    return zpl__simd.ascii_span(data, n);
+}
+
+zpl_internal zpl_isize zpl__utf8_validate_resolve(void const *data, zpl_isize n) {
+    zpl__simd_resolve();
+    return zpl__simd.utf8_validate(data, n);
+}
+
+zpl_internal zpl_simd_level zpl__simd_detect(void) {
+#if defined(ZPL__SIMD_AVX2)
+    /* AVX2 needs the CPU flag and the OS saving the YMM state */
+    zpl_u32 r[4] = {0};
+    zpl_b32 os_avx = false;
+#    if defined(ZPL_COMPILER_MSVC)
+    __cpuid(cast(int *)r, 1);
+    if ((r[2] & ZPL_BIT(27)) && (r[2] & ZPL_BIT(28))) os_avx = (_xgetbv(0) & 6) == 6;
+    __cpuidex(cast(int *)r, 7, 0);
+#    else
+    if (__get_cpuid(1, &r[0], &r[1], &r[2], &r[3]) && (r[2] & ZPL_BIT(27)) && (r[2] & ZPL_BIT(28))) {
+        zpl_u32 lo, hi;
+        __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+        os_avx = (lo & 6) == 6;
+    }
+    if (__get_cpuid_max(0, NULL) >= 7) __cpuid_count(7, 0, r[0], r[1], r[2], r[3]);
+    else r[1] = 0;
+#    endif
+    if (os_avx && (r[1] & ZPL_BIT(5))) return ZPL_SIMD_AVX2;
+#endif
+#if defined(ZPL__SIMD_SSE2)
+    return ZPL_SIMD_SSE2;
+#elif defined(ZPL__SIMD_NEON)
+    return ZPL_SIMD_NEON;
+#else
+    return ZPL_SIMD_SCALAR;
+#endif
+}
+
+zpl_internal void zpl__simd_use(zpl_simd_level level) {
+    zpl__simd_ops ops = { zpl__memchr_scalar, zpl__memrchr_scalar, zpl__str_find_scalar, zpl__str_skip_space_scalar, zpl__str_find_any_scalar, zpl__memchr_any_scalar, zpl__memchr_pair_scalar,
+                           zpl__ascii_span_scalar, zpl__utf8_validate_scalar };
+    switch (level) {
+#if defined(ZPL__SIMD_AVX2)
+        case ZPL_SIMD_AVX2: {
+            zpl__simd_ops avx2 = { zpl__memchr_avx2, zpl__memrchr_avx2, zpl__str_find_avx2, zpl__str_skip_space_avx2, zpl__str_find_any_avx2, zpl__memchr_any_avx2, zpl__memchr_pair_avx2,
+                                   zpl__ascii_span_avx2, zpl__utf8_validate_avx2 };
+            ops = avx2;
+        } break;
+#endif
+#if defined(ZPL__SIMD_SSE2)
+        case ZPL_SIMD_SSE2: {
+            zpl__simd_ops sse2 = { zpl__memchr_sse2, zpl__memrchr_sse2, zpl__str_find_sse2, zpl__str_skip_space_sse2, zpl__str_find_any_sse2, zpl__memchr_any_sse2, zpl__memchr_pair_sse2,
+                                   zpl__ascii_span_sse2, zpl__utf8_validate_sse2 };
+            ops = sse2;
+        } break;
+#endif
+#if defined(ZPL__SIMD_NEON)
+        case ZPL_SIMD_NEON: {
+            zpl__simd_ops neon = { zpl__memchr_neon, zpl__memrchr_neon, zpl__str_find_neon, zpl__str_skip_space_neon, zpl__str_find_any_neon, zpl__memchr_any_neon, zpl__memchr_pair_neon,
+                                   zpl__ascii_span_neon, zpl__utf8_validate_neon };
+            ops = neon;
+        } break;
+#endif
+        default: level = ZPL_SIMD_SCALAR; break;
+    }
+    /* NOTE: racing resolvers store identical pointers, so no locking is needed */
+    zpl__simd = ops;
+    zpl__simd_level_active = level;
+}
+
+zpl_internal void zpl__simd_resolve(void) {
+    zpl__simd_use(zpl__simd_detect());
+}
+
+zpl_simd_level zpl_simd_level_get(void) {
+    if (zpl__simd.memchr == zpl__memchr_resolve) zpl__simd_resolve();
+    return zpl__simd_level_active;
+}
+
+zpl_simd_level zpl_simd_level_set(zpl_simd_level level) {
+    zpl_simd_level best = zpl__simd_detect();
+    zpl_b32 supported = (level == ZPL_SIMD_SCALAR || level == best || (level == ZPL_SIMD_SSE2 && best == ZPL_SIMD_AVX2));
+    zpl__simd_use(supported ? level : best);
+    return zpl__simd_level_active;
+}
+
+void const *zpl_memchr(void const *data, zpl_u8 c, zpl_isize n) {
+    return zpl__simd.memchr(data, c, n);
+}
+
+void const *zpl_memrchr(void const *data, zpl_u8 c, zpl_isize n) {
+    return zpl__simd.memrchr(data, c, n);
+}
+
+void const *zpl_memchr_any(void const *data, zpl_isize n, zpl_u8 const *set, zpl_isize set_len) {
+    if (set_len <= 0) return NULL;
+    return zpl__simd.memchr_any(data, n, set, set_len);
+}
+
 void *zpl_memcopy(void *dest, void const *source, zpl_isize n) {
     if (dest == NULL) { return NULL; }
 
@@ -0,0 +1,359 @@
+// file: source/file_async.c
+
+///////////////////////////////////////////////////////////////
+//
+// Asynchronous file I/O
+//
+
+#if defined(ZPL_SYSTEM_LINUX) && !defined(ZPL_FILE_ASYNC_DISABLE_IO_URING) && defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#        define ZPL__FILE_ASYNC_IO_URING
+#        include <linux/io_uring.h>
+#        include <sys/syscall.h>
+#        include <sys/uio.h>
+#    endif
+#endif
+
+ZPL_BEGIN_C_DECLS
+
+enum {
+    ZPL__FILE_ASYNC_READ,
+    ZPL__FILE_ASYNC_WRITE,
+};
+
+typedef struct {
+    zpl_file_async *q;
+    zpl_file *file;
+    void *buffer;
+    zpl_isize size;
+    zpl_i64 offset;
+    void *user_data;
+    zpl_isize result;
+    zpl_u8 op;
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    struct iovec iov;
+#endif
+} zpl__file_async_slot;
+
+typedef struct {
+    zpl__file_async_slot *slots;
+    zpl_u32 *free_slots;
+    zpl_u32 free_count;
+    zpl_u32 *done; ///< finished slots not reported yet, guarded by the queue lock
+    zpl_u32 done_count;
+
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    int ring_fd;
+    zpl_u32 to_submit;
+    void *sq_ring, *cq_ring;
+    zpl_isize sq_ring_size, cq_ring_size;
+    struct io_uring_sqe *sqes;
+    zpl_isize sqes_size;
+    zpl_u32 *sq_head, *sq_tail, *sq_mask, *sq_array;
+    zpl_u32 *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+#endif
+} zpl__file_async_state;
+
+zpl_internal void zpl__file_async_finish(zpl__file_async_slot *slot) {
+    zpl_file_async *q = slot->q;
+    zpl__file_async_state *s = cast(zpl__file_async_state *)q->state;
+    zpl_mutex_lock(&q->lock);
+    s->done[s->done_count++] = cast(zpl_u32)(slot - s->slots);
+    zpl_mutex_unlock(&q->lock);
+}
+
+zpl_internal void zpl__file_async_run(zpl__file_async_slot *slot) {
+    zpl_isize n = 0;
+    zpl_b32 ok;
+    if (slot->op == ZPL__FILE_ASYNC_READ)
+        ok = zpl_file_read_at_check(slot->file, slot->buffer, slot->size, slot->offset, &n);
+    else
+        ok = zpl_file_write_at_check(slot->file, slot->buffer, slot->size, slot->offset, &n);
+    slot->result = ok ? n : -1;
+}
+
+zpl_internal void zpl__file_async_job(void *data) {
+    zpl__file_async_slot *slot = cast(zpl__file_async_slot *)data;
+    zpl__file_async_run(slot);
+    zpl__file_async_finish(slot);
+}
+
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    zpl_internal zpl_b32 zpl__file_async_ring_init(zpl__file_async_state *s, zpl_u32 depth) {
+        struct io_uring_params p;
+        zpl_zero_item(&p);
+        s->ring_fd = cast(int)syscall(__NR_io_uring_setup, depth, &p);
+        if (s->ring_fd < 0) return false;
+
+        s->sq_ring_size = p.sq_off.array + p.sq_entries * zpl_size_of(zpl_u32);
+        s->cq_ring_size = p.cq_off.cqes + p.cq_entries * zpl_size_of(struct io_uring_cqe);
+        if (p.features & IORING_FEAT_SINGLE_MMAP) {
+            s->sq_ring_size = s->cq_ring_size = zpl_max(s->sq_ring_size, s->cq_ring_size);
+        }
+
+        s->sq_ring = mmap(NULL, s->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, s->ring_fd, IORING_OFF_SQ_RING);
+        if (s->sq_ring == MAP_FAILED) {
+            close(s->ring_fd);
+            return false;
+        }
+        if (p.features & IORING_FEAT_SINGLE_MMAP) {
+            s->cq_ring = s->sq_ring;
+        } else {
+            s->cq_ring = mmap(NULL, s->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, s->ring_fd, IORING_OFF_CQ_RING);
+            if (s->cq_ring == MAP_FAILED) {
+                munmap(s->sq_ring, s->sq_ring_size);
+                close(s->ring_fd);
+                return false;
+            }
+        }
+
+        s->sqes_size = p.sq_entries * zpl_size_of(struct io_uring_sqe);
+        s->sqes = cast(struct io_uring_sqe *)mmap(NULL, s->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, s->ring_fd, IORING_OFF_SQES);
+        if (s->sqes == MAP_FAILED) {
+            if (s->cq_ring != s->sq_ring) munmap(s->cq_ring, s->cq_ring_size);
+            munmap(s->sq_ring, s->sq_ring_size);
+            close(s->ring_fd);
+            return false;
+        }
+
+        s->sq_head  = cast(zpl_u32 *)zpl_pointer_add(s->sq_ring, p.sq_off.head);
+        s->sq_tail  = cast(zpl_u32 *)zpl_pointer_add(s->sq_ring, p.sq_off.tail);
+        s->sq_mask  = cast(zpl_u32 *)zpl_pointer_add(s->sq_ring, p.sq_off.ring_mask);
+        s->sq_array = cast(zpl_u32 *)zpl_pointer_add(s->sq_ring, p.sq_off.array);
+        s->cq_head  = cast(zpl_u32 *)zpl_pointer_add(s->cq_ring, p.cq_off.head);
+        s->cq_tail  = cast(zpl_u32 *)zpl_pointer_add(s->cq_ring, p.cq_off.tail);
+        s->cq_mask  = cast(zpl_u32 *)zpl_pointer_add(s->cq_ring, p.cq_off.ring_mask);
+        s->cqes     = cast(struct io_uring_cqe *)zpl_pointer_add(s->cq_ring, p.cq_off.cqes);
+        return true;
+    }
+
+    zpl_internal void zpl__file_async_ring_free(zpl__file_async_state *s) {
+        munmap(s->sqes, s->sqes_size);
+        if (s->cq_ring != s->sq_ring) munmap(s->cq_ring, s->cq_ring_size);
+        munmap(s->sq_ring, s->sq_ring_size);
+        close(s->ring_fd);
+    }
+
+    zpl_internal void zpl__file_async_ring_push(zpl__file_async_state *s, zpl__file_async_slot *slot) {
+        /* the queue never holds more requests than the ring has entries, so there is always room */
+        zpl_u32 tail = *s->sq_tail;
+        zpl_u32 index = tail & *s->sq_mask;
+        struct io_uring_sqe *sqe = s->sqes + index;
+
+        slot->iov.iov_base = slot->buffer;
+        slot->iov.iov_len = cast(size_t)slot->size;
+
+        zpl_zero_item(sqe);
+        sqe->opcode = (slot->op == ZPL__FILE_ASYNC_READ) ? IORING_OP_READV : IORING_OP_WRITEV;
+        sqe->fd = cast(int)slot->file->fd.i;
+        sqe->off = cast(zpl_u64)slot->offset;
+        sqe->addr = cast(zpl_u64)cast(zpl_uintptr)&slot->iov;
+        sqe->len = 1;
+        sqe->user_data = cast(zpl_u64)(slot - s->slots);
+
+        s->sq_array[index] = index;
+        __atomic_store_n(s->sq_tail, tail + 1, __ATOMIC_RELEASE);
+        s->to_submit++;
+    }
+
+    zpl_internal void zpl__file_async_ring_enter(zpl__file_async_state *s, zpl_u32 min_complete) {
+        zpl_u32 flags = min_complete ? IORING_ENTER_GETEVENTS : 0;
+        if (!s->to_submit && !min_complete) return;
+        for (;;) {
+            long res = syscall(__NR_io_uring_enter, s->ring_fd, s->to_submit, min_complete, flags, NULL, 0);
+            if (res >= 0) {
+                s->to_submit -= cast(zpl_u32)res;
+                break;
+            }
+            if (errno != EINTR) break;
+        }
+    }
+
+    zpl_internal void zpl__file_async_ring_reap(zpl__file_async_state *s) {
+        zpl_u32 head = *s->cq_head;
+        zpl_u32 tail = __atomic_load_n(s->cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            struct io_uring_cqe *cqe = s->cqes + (head & *s->cq_mask);
+            zpl__file_async_slot *slot = s->slots + cqe->user_data;
+            slot->result = cqe->res < 0 ? -1 : cast(zpl_isize)cqe->res;
+            s->done[s->done_count++] = cast(zpl_u32)cqe->user_data;
+            head++;
+        }
+        __atomic_store_n(s->cq_head, head, __ATOMIC_RELEASE);
+    }
+#endif
+
+zpl_b32 zpl_file_async_init(zpl_file_async *q, zpl_allocator a, zpl_u32 depth, zpl_u32 flags) {
+    ZPL_ASSERT_NOT_NULL(q);
+    ZPL_ASSERT(depth > 0);
+    zpl_zero_item(q);
+    q->alloc = a;
+
+    zpl__file_async_state *s = cast(zpl__file_async_state *)zpl_alloc(a, zpl_size_of(zpl__file_async_state));
+    if (!s) return false;
+    zpl_zero_item(s);
+    q->state = s;
+
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    if (!(flags & ZPL_FILE_ASYNC_FORCE_THREADS)) {
+        /* the kernel rounds the ring up to a power of two, we stay within what we asked for */
+        q->uses_io_uring = zpl__file_async_ring_init(s, depth);
+    }
+#else
+    zpl_unused(flags);
+#endif
+
+    s->slots = cast(zpl__file_async_slot *)zpl_alloc(a, depth * zpl_size_of(zpl__file_async_slot));
+    s->free_slots = cast(zpl_u32 *)zpl_alloc(a, depth * zpl_size_of(zpl_u32));
+    s->done = cast(zpl_u32 *)zpl_alloc(a, depth * zpl_size_of(zpl_u32));
+    if (!s->slots || !s->free_slots || !s->done) {
+        zpl_file_async_free(q);
+        return false;
+    }
+
+    for (zpl_u32 i = 0; i < depth; i++) {
+        s->free_slots[i] = depth - 1 - i;
+    }
+    s->free_count = depth;
+    q->depth = depth;
+
+    zpl_mutex_init(&q->lock);
+    if (!q->uses_io_uring) {
+        zpl_affinity af;
+        zpl_affinity_init(&af);
+        zpl_u32 threads = cast(zpl_u32)zpl_clamp(af.thread_count, 2, cast(zpl_isize)depth);
+        zpl_affinity_destroy(&af);
+        zpl_jobs_init_with_limit(&q->pool, a, threads, depth + 1);
+    }
+    return true;
+}
+
+void zpl_file_async_free(zpl_file_async *q) {
+    zpl__file_async_state *s = cast(zpl__file_async_state *)q->state;
+    if (!s) return;
+
+    if (q->depth) {
+        while (q->in_flight > 0) {
+            zpl_file_async_completion c[16];
+            zpl_file_async_wait(q, c, zpl_count_of(c));
+        }
+        if (!q->uses_io_uring) zpl_jobs_free(&q->pool);
+        zpl_mutex_destroy(&q->lock);
+    }
+
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    if (q->uses_io_uring) zpl__file_async_ring_free(s);
+#endif
+
+    if (s->slots) zpl_free(q->alloc, s->slots);
+    if (s->free_slots) zpl_free(q->alloc, s->free_slots);
+    if (s->done) zpl_free(q->alloc, s->done);
+    zpl_free(q->alloc, s);
+    q->state = NULL;
+}
+
+zpl_internal zpl_b32 zpl__file_async_queue(zpl_file_async *q, zpl_u8 op, zpl_file *file, void *buffer, zpl_isize size, zpl_i64 offset, void *user_data) {
+    zpl__file_async_state *s = cast(zpl__file_async_state *)q->state;
+    if (s->free_count == 0) return false;
+
+    zpl__file_async_slot *slot = s->slots + s->free_slots[--s->free_count];
+    slot->q = q;
+    slot->file = file;
+    slot->buffer = buffer;
+    slot->size = size;
+    slot->offset = offset;
+    slot->user_data = user_data;
+    slot->result = 0;
+    slot->op = op;
+    q->in_flight++;
+
+    if (!file->ops.read_at) file->ops = zpl_default_file_operations;
+
+    /* only plain OS files can run concurrently, anything else is served right away */
+    if (file->ops.read_at != zpl_default_file_operations.read_at) {
+        zpl__file_async_run(slot);
+        zpl__file_async_finish(slot);
+        return true;
+    }
+
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    if (q->uses_io_uring) {
+        zpl__file_async_ring_push(s, slot);
+        return true;
+    }
+#endif
+
+    zpl_jobs_enqueue(&q->pool, zpl__file_async_job, slot);
+    return true;
+}
+
+zpl_b32 zpl_file_read_async(zpl_file_async *q, zpl_file *file, void *buffer, zpl_isize size, zpl_i64 offset, void *user_data) {
+    ZPL_ASSERT_NOT_NULL(q);
+    ZPL_ASSERT_NOT_NULL(file);
+    return zpl__file_async_queue(q, ZPL__FILE_ASYNC_READ, file, buffer, size, offset, user_data);
+}
+
+zpl_b32 zpl_file_write_async(zpl_file_async *q, zpl_file *file, void const *buffer, zpl_isize size, zpl_i64 offset, void *user_data) {
+    ZPL_ASSERT_NOT_NULL(q);
+    ZPL_ASSERT_NOT_NULL(file);
+    return zpl__file_async_queue(q, ZPL__FILE_ASYNC_WRITE, file, cast(void *)buffer, size, offset, user_data);
+}
+
+void zpl_file_async_submit(zpl_file_async *q) {
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    if (q->uses_io_uring) {
+        zpl__file_async_ring_enter(cast(zpl__file_async_state *)q->state, 0);
+        return;
+    }
+#endif
+    zpl_jobs_process(&q->pool);
+}
+
+zpl_internal zpl_isize zpl__file_async_collect(zpl_file_async *q, zpl_file_async_completion *completions, zpl_isize max) {
+    zpl__file_async_state *s = cast(zpl__file_async_state *)q->state;
+    zpl_isize count = 0;
+
+    zpl_mutex_lock(&q->lock);
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+    if (q->uses_io_uring) zpl__file_async_ring_reap(s);
+#endif
+    while (count < max && s->done_count > 0) {
+        zpl_u32 index = s->done[0];
+        zpl__file_async_slot *slot = s->slots + index;
+        completions[count].user_data = slot->user_data;
+        completions[count].result = slot->result;
+        count++;
+
+        s->done[0] = s->done[--s->done_count];
+        s->free_slots[s->free_count++] = index;
+    }
+    zpl_mutex_unlock(&q->lock);
+
+    q->in_flight -= cast(zpl_u32)count;
+    return count;
+}
+
+zpl_isize zpl_file_async_poll(zpl_file_async *q, zpl_file_async_completion *completions, zpl_isize max) {
+    ZPL_ASSERT_NOT_NULL(q);
+    zpl_file_async_submit(q);
+    return zpl__file_async_collect(q, completions, max);
+}
+
+zpl_isize zpl_file_async_wait(zpl_file_async *q, zpl_file_async_completion *completions, zpl_isize max) {
+    ZPL_ASSERT_NOT_NULL(q);
+    for (;;) {
+        zpl_isize count = zpl_file_async_poll(q, completions, max);
+        if (count > 0 || q->in_flight == 0) return count;
+
+#if defined(ZPL__FILE_ASYNC_IO_URING)
+        if (q->uses_io_uring) {
+            zpl__file_async_ring_enter(cast(zpl__file_async_state *)q->state, 1);
+            continue;
+        }
+#endif
+        zpl_yield();
+    }
+}
+
+ZPL_END_C_DECLS
@@ -39,98 +39,1262 @@ zpl_u32 zpl_adler32(void const *data, zpl_isize len) {
     return (b << 16) | a;
 }
 
-zpl_global zpl_u32 const zpl__crc32_table[256] = {
-    0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3, 0x0edb8832,
-    0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
-    0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7, 0x136c9856, 0x646ba8c0, 0xfd62f97a,
-    0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
-    0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3,
-    0x45df5c75, 0xdcd60dcf, 0xabd13d59, 0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
-    0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab,
-    0xb6662d3d, 0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
-    0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01, 0x6b6b51f4,
-    0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
-    0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65, 0x4db26158, 0x3ab551ce, 0xa3bc0074,
-    0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
-    0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525,
-    0x206f85b3, 0xb966d409, 0xce61e49f, 0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
-    0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615,
-    0x73dc1683, 0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
-    0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7, 0xfed41b76,
-    0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
-    0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b, 0xd80d2bda, 0xaf0a1b4c, 0x36034af6,
-    0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
-    0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7,
-    0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d, 0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
-    0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7,
-    0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
-    0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45, 0xa00ae278,
-    0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
-    0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9, 0xbdbdf21c, 0xcabac28a, 0x53b39330,
-    0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
-    0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+/* slice-by-8 tables, [0] is the bytewise table and [k] advances its entries by k more zero bytes */
+zpl_global zpl_u32 const zpl__crc32_table[8][256] = {
+    {
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+    },
+    {
+        0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+        0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+        0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+        0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+        0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+        0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+        0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+        0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+        0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+        0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+        0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+        0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+        0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+        0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+        0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+        0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+        0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+        0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+        0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 0x271b2d9c, 0x3e001cdd,
+        0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+        0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+        0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+        0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+        0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+        0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+        0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+        0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+        0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x06a0d9d0,
+        0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b,
+        0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+        0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+        0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72,
+    },
+    {
+        0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 0x048d7cb2, 0x054f1685,
+        0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d,
+        0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+        0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+        0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+        0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+        0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+        0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+        0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+        0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+        0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+        0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+        0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+        0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+        0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+        0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+        0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+        0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+        0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+        0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+        0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+        0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+        0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+        0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+        0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+        0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+        0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+        0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+        0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+        0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+        0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+        0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed,
+    },
+    {
+        0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+        0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+        0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+        0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x087a47c9,
+        0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+        0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+        0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+        0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7,
+        0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+        0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+        0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+        0x0eb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+        0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 0x1e4da8df, 0xa6f1cfba,
+        0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+        0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+        0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+        0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+        0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+        0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+        0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+        0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+        0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+        0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+        0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+        0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+        0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+        0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+        0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+        0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+        0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+        0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+        0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1,
+    },
+    {
+        0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+        0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+        0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+        0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+        0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314,
+        0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+        0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+        0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+        0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+        0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+        0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+        0x0863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+        0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+        0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+        0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+        0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 0x46e25eae, 0x7b82771e,
+        0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82,
+        0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+        0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+        0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+        0x70279f96, 0x4d47b626, 0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+        0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+        0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+        0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+        0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+        0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+        0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+        0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 0x36c5c138, 0x0ba5e888,
+        0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+        0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+        0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+        0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c,
+    },
+    {
+        0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+        0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+        0x03d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+        0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+        0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+        0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+        0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+        0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+        0x0f580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+        0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+        0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+        0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+        0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+        0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+        0x0b220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+        0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+        0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460,
+        0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+        0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x006326fb,
+        0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+        0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+        0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+        0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd,
+        0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+        0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0x0ced2e0c,
+        0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+        0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+        0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+        0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a,
+        0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+        0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x089729a1,
+        0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc,
+    },
+    {
+        0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+        0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+        0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+        0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 0x37e1e793, 0x9196ec27,
+        0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712,
+        0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+        0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+        0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+        0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+        0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+        0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+        0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+        0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+        0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+        0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+        0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+        0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+        0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+        0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+        0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+        0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+        0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+        0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+        0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+        0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x09baa105,
+        0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+        0xabc30345, 0x0db408f1, 0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+        0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+        0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+        0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+        0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 0x07ae0fe3, 0xa1d90457,
+        0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30,
+    },
+    {
+        0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 0xc66f0987, 0x0ac50919,
+        0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+        0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+        0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+        0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+        0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+        0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+        0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+        0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+        0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+        0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+        0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+        0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+        0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217,
+        0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+        0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+        0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+        0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+        0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+        0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+        0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+        0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+        0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+        0x0513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+        0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+        0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+        0x061d761c, 0xcab77682, 0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+        0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+        0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+        0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+        0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+        0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6,
+    },
 };
 
-zpl_global zpl_u64 const zpl__crc64_table[256] = {
-    0x0000000000000000ull, 0x7ad870c830358979ull, 0xf5b0e190606b12f2ull, 0x8f689158505e9b8bull, 0xc038e5739841b68full, 0xbae095bba8743ff6ull,
-    0x358804e3f82aa47dull, 0x4f50742bc81f2d04ull, 0xab28ecb46814fe75ull, 0xd1f09c7c5821770cull, 0x5e980d24087fec87ull, 0x24407dec384a65feull,
-    0x6b1009c7f05548faull, 0x11c8790fc060c183ull, 0x9ea0e857903e5a08ull, 0xe478989fa00bd371ull, 0x7d08ff3b88be6f81ull, 0x07d08ff3b88be6f8ull,
-    0x88b81eabe8d57d73ull, 0xf2606e63d8e0f40aull, 0xbd301a4810ffd90eull, 0xc7e86a8020ca5077ull, 0x4880fbd87094cbfcull, 0x32588b1040a14285ull,
-    0xd620138fe0aa91f4ull, 0xacf86347d09f188dull, 0x2390f21f80c18306ull, 0x594882d7b0f40a7full, 0x1618f6fc78eb277bull, 0x6cc0863448deae02ull,
-    0xe3a8176c18803589ull, 0x997067a428b5bcf0ull, 0xfa11fe77117cdf02ull, 0x80c98ebf2149567bull,
-    0x0fa11fe77117cdf0ull, 0x75796f2f41224489ull, 0x3a291b04893d698dull, 0x40f16bccb908e0f4ull, 0xcf99fa94e9567b7full, 0xb5418a5cd963f206ull,
-    0x513912c379682177ull, 0x2be1620b495da80eull, 0xa489f35319033385ull, 0xde51839b2936bafcull, 0x9101f7b0e12997f8ull, 0xebd98778d11c1e81ull,
-    0x64b116208142850aull, 0x1e6966e8b1770c73ull, 0x8719014c99c2b083ull, 0xfdc17184a9f739faull, 0x72a9e0dcf9a9a271ull, 0x08719014c99c2b08ull,
-    0x4721e43f0183060cull, 0x3df994f731b68f75ull, 0xb29105af61e814feull, 0xc849756751dd9d87ull, 0x2c31edf8f1d64ef6ull, 0x56e99d30c1e3c78full,
-    0xd9810c6891bd5c04ull, 0xa3597ca0a188d57dull, 0xec09088b6997f879ull, 0x96d1784359a27100ull, 0x19b9e91b09fcea8bull, 0x636199d339c963f2ull,
-    0xdf7adabd7a6e2d6full, 0xa5a2aa754a5ba416ull, 0x2aca3b2d1a053f9dull, 0x50124be52a30b6e4ull, 0x1f423fcee22f9be0ull, 0x659a4f06d21a1299ull,
-    0xeaf2de5e82448912ull, 0x902aae96b271006bull, 0x74523609127ad31aull, 0x0e8a46c1224f5a63ull, 0x81e2d7997211c1e8ull, 0xfb3aa75142244891ull,
-    0xb46ad37a8a3b6595ull, 0xceb2a3b2ba0eececull, 0x41da32eaea507767ull, 0x3b024222da65fe1eull, 0xa2722586f2d042eeull, 0xd8aa554ec2e5cb97ull,
-    0x57c2c41692bb501cull, 0x2d1ab4dea28ed965ull, 0x624ac0f56a91f461ull, 0x1892b03d5aa47d18ull, 0x97fa21650afae693ull, 0xed2251ad3acf6feaull,
-    0x095ac9329ac4bc9bull, 0x7382b9faaaf135e2ull, 0xfcea28a2faafae69ull, 0x8632586aca9a2710ull, 0xc9622c4102850a14ull, 0xb3ba5c8932b0836dull,
-    0x3cd2cdd162ee18e6ull, 0x460abd1952db919full, 0x256b24ca6b12f26dull, 0x5fb354025b277b14ull, 0xd0dbc55a0b79e09full, 0xaa03b5923b4c69e6ull,
-    0xe553c1b9f35344e2ull, 0x9f8bb171c366cd9bull, 0x10e3202993385610ull, 0x6a3b50e1a30ddf69ull, 0x8e43c87e03060c18ull, 0xf49bb8b633338561ull,
-    0x7bf329ee636d1eeaull, 0x012b592653589793ull, 0x4e7b2d0d9b47ba97ull, 0x34a35dc5ab7233eeull, 0xbbcbcc9dfb2ca865ull, 0xc113bc55cb19211cull,
-    0x5863dbf1e3ac9decull, 0x22bbab39d3991495ull, 0xadd33a6183c78f1eull, 0xd70b4aa9b3f20667ull, 0x985b3e827bed2b63ull, 0xe2834e4a4bd8a21aull,
-    0x6debdf121b863991ull, 0x1733afda2bb3b0e8ull, 0xf34b37458bb86399ull, 0x8993478dbb8deae0ull, 0x06fbd6d5ebd3716bull, 0x7c23a61ddbe6f812ull,
-    0x3373d23613f9d516ull, 0x49aba2fe23cc5c6full, 0xc6c333a67392c7e4ull, 0xbc1b436e43a74e9dull, 0x95ac9329ac4bc9b5ull, 0xef74e3e19c7e40ccull,
-    0x601c72b9cc20db47ull, 0x1ac40271fc15523eull, 0x5594765a340a7f3aull, 0x2f4c0692043ff643ull, 0xa02497ca54616dc8ull, 0xdafce7026454e4b1ull,
-    0x3e847f9dc45f37c0ull, 0x445c0f55f46abeb9ull, 0xcb349e0da4342532ull, 0xb1eceec59401ac4bull, 0xfebc9aee5c1e814full, 0x8464ea266c2b0836ull,
-    0x0b0c7b7e3c7593bdull, 0x71d40bb60c401ac4ull, 0xe8a46c1224f5a634ull, 0x927c1cda14c02f4dull, 0x1d148d82449eb4c6ull, 0x67ccfd4a74ab3dbfull,
-    0x289c8961bcb410bbull, 0x5244f9a98c8199c2ull, 0xdd2c68f1dcdf0249ull, 0xa7f41839ecea8b30ull, 0x438c80a64ce15841ull, 0x3954f06e7cd4d138ull,
-    0xb63c61362c8a4ab3ull, 0xcce411fe1cbfc3caull, 0x83b465d5d4a0eeceull, 0xf96c151de49567b7ull, 0x76048445b4cbfc3cull, 0x0cdcf48d84fe7545ull,
-    0x6fbd6d5ebd3716b7ull, 0x15651d968d029fceull, 0x9a0d8ccedd5c0445ull, 0xe0d5fc06ed698d3cull, 0xaf85882d2576a038ull, 0xd55df8e515432941ull,
-    0x5a3569bd451db2caull, 0x20ed197575283bb3ull, 0xc49581ead523e8c2ull, 0xbe4df122e51661bbull, 0x3125607ab548fa30ull, 0x4bfd10b2857d7349ull,
-    0x04ad64994d625e4dull, 0x7e7514517d57d734ull, 0xf11d85092d094cbfull, 0x8bc5f5c11d3cc5c6ull, 0x12b5926535897936ull, 0x686de2ad05bcf04full,
-    0xe70573f555e26bc4ull, 0x9ddd033d65d7e2bdull, 0xd28d7716adc8cfb9ull, 0xa85507de9dfd46c0ull, 0x273d9686cda3dd4bull, 0x5de5e64efd965432ull,
-    0xb99d7ed15d9d8743ull, 0xc3450e196da80e3aull, 0x4c2d9f413df695b1ull, 0x36f5ef890dc31cc8ull, 0x79a59ba2c5dc31ccull, 0x037deb6af5e9b8b5ull,
-    0x8c157a32a5b7233eull, 0xf6cd0afa9582aa47ull, 0x4ad64994d625e4daull, 0x300e395ce6106da3ull, 0xbf66a804b64ef628ull, 0xc5bed8cc867b7f51ull,
-    0x8aeeace74e645255ull, 0xf036dc2f7e51db2cull, 0x7f5e4d772e0f40a7ull, 0x05863dbf1e3ac9deull, 0xe1fea520be311aafull, 0x9b26d5e88e0493d6ull,
-    0x144e44b0de5a085dull, 0x6e963478ee6f8124ull, 0x21c640532670ac20ull, 0x5b1e309b16452559ull, 0xd476a1c3461bbed2ull, 0xaeaed10b762e37abull,
-    0x37deb6af5e9b8b5bull, 0x4d06c6676eae0222ull, 0xc26e573f3ef099a9ull, 0xb8b627f70ec510d0ull, 0xf7e653dcc6da3dd4ull, 0x8d3e2314f6efb4adull,
-    0x0256b24ca6b12f26ull, 0x788ec2849684a65full, 0x9cf65a1b368f752eull, 0xe62e2ad306bafc57ull, 0x6946bb8b56e467dcull, 0x139ecb4366d1eea5ull,
-    0x5ccebf68aecec3a1ull, 0x2616cfa09efb4ad8ull, 0xa97e5ef8cea5d153ull, 0xd3a62e30fe90582aull, 0xb0c7b7e3c7593bd8ull, 0xca1fc72bf76cb2a1ull,
-    0x45775673a732292aull, 0x3faf26bb9707a053ull, 0x70ff52905f188d57ull, 0x0a2722586f2d042eull, 0x854fb3003f739fa5ull, 0xff97c3c80f4616dcull,
-    0x1bef5b57af4dc5adull, 0x61372b9f9f784cd4ull, 0xee5fbac7cf26d75full, 0x9487ca0fff135e26ull, 0xdbd7be24370c7322ull, 0xa10fceec0739fa5bull,
-    0x2e675fb4576761d0ull, 0x54bf2f7c6752e8a9ull, 0xcdcf48d84fe75459ull, 0xb71738107fd2dd20ull, 0x387fa9482f8c46abull, 0x42a7d9801fb9cfd2ull,
-    0x0df7adabd7a6e2d6ull, 0x772fdd63e7936bafull, 0xf8474c3bb7cdf024ull, 0x829f3cf387f8795dull, 0x66e7a46c27f3aa2cull, 0x1c3fd4a417c62355ull,
-    0x935745fc4798b8deull, 0xe98f353477ad31a7ull, 0xa6df411fbfb21ca3ull, 0xdc0731d78f8795daull, 0x536fa08fdfd90e51ull, 0x29b7d047efec8728ull,
+zpl_global zpl_u32 const zpl__crc32c_table[8][256] = {
+    {
+        0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+        0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+        0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+        0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+        0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+        0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+        0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+        0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a, 0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+        0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+        0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+        0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+        0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+        0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+        0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+        0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+        0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+        0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+        0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+        0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+        0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+        0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+        0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+        0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d, 0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+        0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+        0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+        0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+        0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+        0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+        0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+        0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+        0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+        0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+    },
+    {
+        0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc, 0x5d28f9ab, 0x69cf5132, 0x7a6dc945,
+        0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21, 0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd,
+        0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0x0b225918, 0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+        0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92, 0xcb1e630b, 0xd8bcfb7c,
+        0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b, 0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47,
+        0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823, 0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+        0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28, 0x298143b1, 0x3a23dbc6,
+        0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2, 0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e,
+        0xff17c604, 0xecb55e73, 0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+        0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25, 0x2c896460, 0x3f2bfc17, 0x0bcc548e, 0x186eccf9,
+        0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c, 0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0,
+        0x5dc6f43d, 0x4e646c4a, 0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f, 0x27ab3d78,
+        0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f, 0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43,
+        0x1d88e6be, 0x0e2a7ec9, 0x3acdd650, 0x296f4e27, 0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb,
+        0xbf59d487, 0xacfb4cf0, 0x981ce469, 0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+        0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3, 0x7f65ee94, 0x4b82460d, 0x5820de7a,
+        0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260, 0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc,
+        0x66d73941, 0x7575a136, 0x419209af, 0x523091d8, 0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004,
+        0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3, 0xadc95a4a, 0xbe6bc23d,
+        0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059, 0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185,
+        0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162, 0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+        0x195cda43, 0x0afe4234, 0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8, 0x70938b71, 0x63311306,
+        0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3, 0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f,
+        0x26992bc2, 0x353bb3b5, 0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+        0x04d43cfd, 0x1776a48a, 0x23910c13, 0x30339464, 0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+        0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc, 0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600,
+        0x3b11cd7c, 0x28b3550b, 0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+        0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d, 0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781,
+        0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766, 0x35d5be23, 0x26772654, 0x12908ecd, 0x013216ba,
+        0xe64b1c47, 0xf5e98430, 0xc10e2ca9, 0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+        0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2, 0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b,
+        0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f, 0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+    },
+    {
+        0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a, 0x3b9f3664, 0xd1b1f617, 0x74f06469,
+        0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6, 0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2, 0x4ca15aac,
+        0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9, 0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3,
+        0x48f3434f, 0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b, 0x9942b558, 0x3c032726,
+        0xe144fb14, 0x4405696a, 0xae2ba919, 0x0b6a3b67, 0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+        0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2, 0x47cb61cb, 0xe28af3b5, 0x08a433c6, 0xade5a1b8,
+        0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa, 0x40577089, 0xe516e2f7,
+        0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828, 0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32,
+        0xc76580d9, 0x622412a7, 0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+        0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f, 0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+        0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20, 0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a,
+        0x8f96c396, 0x2ad751e8, 0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+        0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe, 0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4,
+        0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b, 0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161,
+        0x56830647, 0xf3c29439, 0x19ec544a, 0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+        0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98, 0x554d0ee6, 0xbf63ce95, 0x1a225ceb,
+        0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730, 0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a,
+        0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5, 0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+        0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad, 0x2a34fcde, 0x8f756ea0,
+        0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f, 0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+        0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24, 0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+        0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6, 0x83834485, 0x26c2d6fb,
+        0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae, 0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4,
+        0x2290cf18, 0x87d15d66, 0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+        0x4c42f79a, 0xe90365e4, 0x032da597, 0xa66c37e9, 0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+        0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c, 0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0x00e3ad36,
+        0x3ce08a10, 0x99a1186e, 0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07, 0x4810ee79,
+        0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6, 0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc,
+        0xad060c8e, 0x08479ef0, 0xe2695e83, 0x4728ccfd, 0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7,
+        0x9557324b, 0x3016a035, 0xda386046, 0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+        0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e, 0xe63b4760, 0x0c158713, 0xa954156d,
+        0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0x0fdb8fb2, 0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+    },
+    {
+        0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3, 0xa6679b4b, 0xc4451272, 0x1900b8ca,
+        0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf, 0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c,
+        0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804, 0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+        0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990, 0xdb65c0a9, 0x06206a11,
+        0xd725148b, 0x0a60be33, 0x6842370a, 0xb5079db2, 0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+        0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54, 0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+        0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd, 0xfa04b7c4, 0x27411d7c,
+        0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69, 0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a,
+        0xaba65fe7, 0x76e3f55f, 0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+        0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538, 0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+        0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3, 0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610,
+        0xb4868d3c, 0x69c32784, 0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+        0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255, 0x07a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6,
+        0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3, 0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040,
+        0x95e7fa51, 0x48a250e9, 0x2a80d9d0, 0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+        0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844, 0xc5c402fc, 0xa7e68bc5, 0x7aa3217d,
+        0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006, 0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5,
+        0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0, 0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213,
+        0xbbc47802, 0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349, 0x7f816a70, 0xa2c4c0c8,
+        0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd, 0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+        0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d, 0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+        0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519, 0xb784ac20, 0x6ac10698,
+        0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0, 0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443,
+        0x9aa50f6f, 0x47e0a5d7, 0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+        0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1, 0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+        0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07, 0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4,
+        0x106227e5, 0xcd278d5d, 0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597, 0x09629f2f,
+        0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a, 0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9,
+        0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a, 0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99,
+        0xd867e1b5, 0x05224b0d, 0x6700c234, 0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+        0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d, 0x6120a825, 0x0302211c, 0xde478ba4,
+        0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1, 0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+    },
+    {
+        0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0, 0xd854d11c, 0x906761e8, 0xa8760e44,
+        0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65, 0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5,
+        0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127, 0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+        0x4a456a42, 0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e, 0xda220baa, 0xe2336406,
+        0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3, 0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+        0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32, 0x3e8a0076, 0x069b6fda, 0x4ea8df2e, 0x76b9b082,
+        0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598, 0x04edb56c, 0x3cfcdac0,
+        0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1, 0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151,
+        0x37516aae, 0x0f400502, 0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+        0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb, 0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+        0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89, 0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539,
+        0x7d1400ec, 0x45056f40, 0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+        0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d, 0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd,
+        0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c, 0x09db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c,
+        0xa3dbbe2a, 0x9bcad186, 0xd3f96172, 0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+        0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b, 0xbee864a7, 0xf6dbd453, 0xcecabbff,
+        0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8, 0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18,
+        0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39, 0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089,
+        0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593, 0x71e7d567, 0x49f6bacb,
+        0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea, 0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+        0x750a600b, 0x4d1b0fa7, 0x0528bf53, 0x3d39d0ff, 0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+        0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86, 0x200a0a72, 0x181b65de,
+        0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c, 0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c,
+        0x3f4f0a49, 0x075e65e5, 0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+        0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06, 0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+        0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497, 0x7cd10ad3, 0x44c0657f, 0x0cf3d58b, 0x34e2ba27,
+        0xd6d1de21, 0xeec0b18d, 0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9, 0x7ea7d065,
+        0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544, 0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4,
+        0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0x0a68ba51, 0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1,
+        0x873c0134, 0xbf2d6e98, 0xf71ede6c, 0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+        0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6, 0x152dba6a, 0x5d1e0a9e, 0x650f6532,
+        0x081e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013, 0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+    },
+    {
+        0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777, 0x5dc55c6e, 0x697997b4, 0x8649fcad,
+        0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5, 0xd2f32f68, 0x3dc34471, 0x097f8fab, 0xe64fe4b2,
+        0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4, 0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+        0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f, 0xc973bf95, 0x2643d48c,
+        0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57, 0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20,
+        0xe5f20e92, 0x0ac2658b, 0x3e7eae51, 0xd14ec548, 0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+        0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add, 0x2c81b107, 0xc3b1da1e,
+        0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576, 0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201,
+        0x0e045beb, 0xe13430f2, 0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+        0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e, 0xdcf77483, 0x33c71f9a, 0x077bd440, 0xe84bbf59,
+        0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f, 0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778,
+        0xae0e73ca, 0x413e18d3, 0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+        0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc, 0x39057a11, 0xd6351108, 0xe289dad2, 0x0db9b1cb,
+        0xebf65579, 0x04c63e60, 0x307af5ba, 0xdf4a9ea3, 0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4,
+        0x4bfc7d58, 0xa4cc1641, 0x9070dd9b, 0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+        0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230, 0x763f3929, 0x4283f2f3, 0xadb399ea,
+        0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c, 0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b,
+        0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413, 0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+        0xdc0487e8, 0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86, 0xb57d105c, 0x5a4d7b45,
+        0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d, 0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+        0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81, 0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+        0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a, 0x90832ef0, 0x7fb345e9,
+        0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf, 0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8,
+        0x39f6897a, 0xd6c6e263, 0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+        0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7, 0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+        0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8, 0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f,
+        0xd200dc03, 0x3d30b71a, 0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+        0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6, 0x00f3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1,
+        0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a, 0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d,
+        0xf7fee2af, 0x18ce89b6, 0x2c72426c, 0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+        0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9, 0x0a3196e0, 0x3e8d5d3a, 0xd1bd3623,
+        0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x034e194b, 0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+    },
+    {
+        0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1, 0xcde3e919, 0x75e69c41, 0x1de5b089,
+        0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b, 0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda,
+        0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe, 0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+        0xd27607f5, 0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec, 0xa7909bb4, 0xcf93b77c,
+        0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5, 0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+        0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6, 0xd696bb3f, 0xbe9597f7, 0x0690e2af, 0x6e93ce67,
+        0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002, 0xd4e6e55a, 0xbce5c992,
+        0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110, 0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1,
+        0x7ab7077a, 0x12b42bb2, 0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63, 0x0f519b3b, 0x6752b7f3,
+        0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71, 0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+        0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884, 0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55,
+        0xa8c1008f, 0xc0c22c47, 0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+        0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f, 0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e,
+        0x09c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc, 0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d,
+        0xdbb77e61, 0xb3b452a9, 0x0bb127f1, 0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+        0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3, 0x58796a2b, 0xe07c1f73, 0x887f33bb,
+        0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac, 0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d,
+        0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x034686ff, 0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+        0x6935f452, 0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b, 0x1cd36813, 0x74d044db,
+        0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59, 0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+        0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811, 0x6dd54898, 0x05d66450, 0xbdd31108, 0xd5d03dc0,
+        0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903, 0xf3feec5b, 0x9bfdc093,
+        0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7, 0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766,
+        0x1a438abc, 0x7240a674, 0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x07a63a35,
+        0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6, 0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+        0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185, 0x6414310c, 0x0c171dc4, 0xb412689c, 0xdc114454,
+        0x1382f328, 0x7b81dfe0, 0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69, 0x0e6743a1,
+        0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23, 0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2,
+        0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0x0a87ff6b, 0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba,
+        0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0, 0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+        0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544, 0xe33a998c, 0x5b3fecd4, 0x333cc01c,
+        0x60f48dc6, 0x08f7a10e, 0xb0f2d456, 0xd8f1f89e, 0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+    },
+    {
+        0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d, 0x6821ff4a, 0xb3657823, 0xfa590504,
+        0x423b04da, 0x0b0779fd, 0xd043fe94, 0x997f83b3, 0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de,
+        0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd, 0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+        0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224, 0x7528754d, 0x3c14086a,
+        0x0d006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0, 0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+        0x4f3b6143, 0x06071c64, 0xdd439b0d, 0x947fe62a, 0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+        0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367, 0x3a13140e, 0x732f6929,
+        0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e, 0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3,
+        0x1a00cb32, 0x533cb615, 0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+        0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881, 0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+        0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef, 0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782,
+        0xdc4dc65c, 0x9571bb7b, 0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+        0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2, 0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf,
+        0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18, 0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75,
+        0x9376a71f, 0xda4ada38, 0x010e5d51, 0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+        0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8, 0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1,
+        0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d, 0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360,
+        0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7, 0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+        0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a, 0x0312e7f3, 0x4a2e9ad4,
+        0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63, 0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e,
+        0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494, 0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+        0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d, 0xc85f8f04, 0x8163f223,
+        0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20, 0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d,
+        0xff4cfe93, 0xb67083b4, 0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x0515fb97,
+        0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f, 0x0f1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+        0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5, 0x4d27dbe1, 0x041ba6c6, 0xdf5f21af, 0x96635c88,
+        0xaa7754e2, 0xe34b29c5, 0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+        0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751, 0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c,
+        0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6, 0x021cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb,
+        0x613a3c15, 0x28064132, 0xf342c65b, 0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+        0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316, 0xcf56ce31, 0x14124958, 0x5d2e347f,
+        0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8, 0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+    },
 };
 
+zpl_global zpl_u64 const zpl__crc64_table[8][256] = {
+    {
+        0x0000000000000000ull, 0x7ad870c830358979ull, 0xf5b0e190606b12f2ull, 0x8f689158505e9b8bull,
+        0xc038e5739841b68full, 0xbae095bba8743ff6ull, 0x358804e3f82aa47dull, 0x4f50742bc81f2d04ull,
+        0xab28ecb46814fe75ull, 0xd1f09c7c5821770cull, 0x5e980d24087fec87ull, 0x24407dec384a65feull,
+        0x6b1009c7f05548faull, 0x11c8790fc060c183ull, 0x9ea0e857903e5a08ull, 0xe478989fa00bd371ull,
+        0x7d08ff3b88be6f81ull, 0x07d08ff3b88be6f8ull, 0x88b81eabe8d57d73ull, 0xf2606e63d8e0f40aull,
+        0xbd301a4810ffd90eull, 0xc7e86a8020ca5077ull, 0x4880fbd87094cbfcull, 0x32588b1040a14285ull,
+        0xd620138fe0aa91f4ull, 0xacf86347d09f188dull, 0x2390f21f80c18306ull, 0x594882d7b0f40a7full,
+        0x1618f6fc78eb277bull, 0x6cc0863448deae02ull, 0xe3a8176c18803589ull, 0x997067a428b5bcf0ull,
+        0xfa11fe77117cdf02ull, 0x80c98ebf2149567bull, 0x0fa11fe77117cdf0ull, 0x75796f2f41224489ull,
+        0x3a291b04893d698dull, 0x40f16bccb908e0f4ull, 0xcf99fa94e9567b7full, 0xb5418a5cd963f206ull,
+        0x513912c379682177ull, 0x2be1620b495da80eull, 0xa489f35319033385ull, 0xde51839b2936bafcull,
+        0x9101f7b0e12997f8ull, 0xebd98778d11c1e81ull, 0x64b116208142850aull, 0x1e6966e8b1770c73ull,
+        0x8719014c99c2b083ull, 0xfdc17184a9f739faull, 0x72a9e0dcf9a9a271ull, 0x08719014c99c2b08ull,
+        0x4721e43f0183060cull, 0x3df994f731b68f75ull, 0xb29105af61e814feull, 0xc849756751dd9d87ull,
+        0x2c31edf8f1d64ef6ull, 0x56e99d30c1e3c78full, 0xd9810c6891bd5c04ull, 0xa3597ca0a188d57dull,
+        0xec09088b6997f879ull, 0x96d1784359a27100ull, 0x19b9e91b09fcea8bull, 0x636199d339c963f2ull,
+        0xdf7adabd7a6e2d6full, 0xa5a2aa754a5ba416ull, 0x2aca3b2d1a053f9dull, 0x50124be52a30b6e4ull,
+        0x1f423fcee22f9be0ull, 0x659a4f06d21a1299ull, 0xeaf2de5e82448912ull, 0x902aae96b271006bull,
+        0x74523609127ad31aull, 0x0e8a46c1224f5a63ull, 0x81e2d7997211c1e8ull, 0xfb3aa75142244891ull,
+        0xb46ad37a8a3b6595ull, 0xceb2a3b2ba0eececull, 0x41da32eaea507767ull, 0x3b024222da65fe1eull,
+        0xa2722586f2d042eeull, 0xd8aa554ec2e5cb97ull, 0x57c2c41692bb501cull, 0x2d1ab4dea28ed965ull,
+        0x624ac0f56a91f461ull, 0x1892b03d5aa47d18ull, 0x97fa21650afae693ull, 0xed2251ad3acf6feaull,
+        0x095ac9329ac4bc9bull, 0x7382b9faaaf135e2ull, 0xfcea28a2faafae69ull, 0x8632586aca9a2710ull,
+        0xc9622c4102850a14ull, 0xb3ba5c8932b0836dull, 0x3cd2cdd162ee18e6ull, 0x460abd1952db919full,
+        0x256b24ca6b12f26dull, 0x5fb354025b277b14ull, 0xd0dbc55a0b79e09full, 0xaa03b5923b4c69e6ull,
+        0xe553c1b9f35344e2ull, 0x9f8bb171c366cd9bull, 0x10e3202993385610ull, 0x6a3b50e1a30ddf69ull,
+        0x8e43c87e03060c18ull, 0xf49bb8b633338561ull, 0x7bf329ee636d1eeaull, 0x012b592653589793ull,
+        0x4e7b2d0d9b47ba97ull, 0x34a35dc5ab7233eeull, 0xbbcbcc9dfb2ca865ull, 0xc113bc55cb19211cull,
+        0x5863dbf1e3ac9decull, 0x22bbab39d3991495ull, 0xadd33a6183c78f1eull, 0xd70b4aa9b3f20667ull,
+        0x985b3e827bed2b63ull, 0xe2834e4a4bd8a21aull, 0x6debdf121b863991ull, 0x1733afda2bb3b0e8ull,
+        0xf34b37458bb86399ull, 0x8993478dbb8deae0ull, 0x06fbd6d5ebd3716bull, 0x7c23a61ddbe6f812ull,
+        0x3373d23613f9d516ull, 0x49aba2fe23cc5c6full, 0xc6c333a67392c7e4ull, 0xbc1b436e43a74e9dull,
+        0x95ac9329ac4bc9b5ull, 0xef74e3e19c7e40ccull, 0x601c72b9cc20db47ull, 0x1ac40271fc15523eull,
+        0x5594765a340a7f3aull, 0x2f4c0692043ff643ull, 0xa02497ca54616dc8ull, 0xdafce7026454e4b1ull,
+        0x3e847f9dc45f37c0ull, 0x445c0f55f46abeb9ull, 0xcb349e0da4342532ull, 0xb1eceec59401ac4bull,
+        0xfebc9aee5c1e814full, 0x8464ea266c2b0836ull, 0x0b0c7b7e3c7593bdull, 0x71d40bb60c401ac4ull,
+        0xe8a46c1224f5a634ull, 0x927c1cda14c02f4dull, 0x1d148d82449eb4c6ull, 0x67ccfd4a74ab3dbfull,
+        0x289c8961bcb410bbull, 0x5244f9a98c8199c2ull, 0xdd2c68f1dcdf0249ull, 0xa7f41839ecea8b30ull,
+        0x438c80a64ce15841ull, 0x3954f06e7cd4d138ull, 0xb63c61362c8a4ab3ull, 0xcce411fe1cbfc3caull,
+        0x83b465d5d4a0eeceull, 0xf96c151de49567b7ull, 0x76048445b4cbfc3cull, 0x0cdcf48d84fe7545ull,
+        0x6fbd6d5ebd3716b7ull, 0x15651d968d029fceull, 0x9a0d8ccedd5c0445ull, 0xe0d5fc06ed698d3cull,
+        0xaf85882d2576a038ull, 0xd55df8e515432941ull, 0x5a3569bd451db2caull, 0x20ed197575283bb3ull,
+        0xc49581ead523e8c2ull, 0xbe4df122e51661bbull, 0x3125607ab548fa30ull, 0x4bfd10b2857d7349ull,
+        0x04ad64994d625e4dull, 0x7e7514517d57d734ull, 0xf11d85092d094cbfull, 0x8bc5f5c11d3cc5c6ull,
+        0x12b5926535897936ull, 0x686de2ad05bcf04full, 0xe70573f555e26bc4ull, 0x9ddd033d65d7e2bdull,
+        0xd28d7716adc8cfb9ull, 0xa85507de9dfd46c0ull, 0x273d9686cda3dd4bull, 0x5de5e64efd965432ull,
+        0xb99d7ed15d9d8743ull, 0xc3450e196da80e3aull, 0x4c2d9f413df695b1ull, 0x36f5ef890dc31cc8ull,
+        0x79a59ba2c5dc31ccull, 0x037deb6af5e9b8b5ull, 0x8c157a32a5b7233eull, 0xf6cd0afa9582aa47ull,
+        0x4ad64994d625e4daull, 0x300e395ce6106da3ull, 0xbf66a804b64ef628ull, 0xc5bed8cc867b7f51ull,
+        0x8aeeace74e645255ull, 0xf036dc2f7e51db2cull, 0x7f5e4d772e0f40a7ull, 0x05863dbf1e3ac9deull,
+        0xe1fea520be311aafull, 0x9b26d5e88e0493d6ull, 0x144e44b0de5a085dull, 0x6e963478ee6f8124ull,
+        0x21c640532670ac20ull, 0x5b1e309b16452559ull, 0xd476a1c3461bbed2ull, 0xaeaed10b762e37abull,
+        0x37deb6af5e9b8b5bull, 0x4d06c6676eae0222ull, 0xc26e573f3ef099a9ull, 0xb8b627f70ec510d0ull,
+        0xf7e653dcc6da3dd4ull, 0x8d3e2314f6efb4adull, 0x0256b24ca6b12f26ull, 0x788ec2849684a65full,
+        0x9cf65a1b368f752eull, 0xe62e2ad306bafc57ull, 0x6946bb8b56e467dcull, 0x139ecb4366d1eea5ull,
+        0x5ccebf68aecec3a1ull, 0x2616cfa09efb4ad8ull, 0xa97e5ef8cea5d153ull, 0xd3a62e30fe90582aull,
+        0xb0c7b7e3c7593bd8ull, 0xca1fc72bf76cb2a1ull, 0x45775673a732292aull, 0x3faf26bb9707a053ull,
+        0x70ff52905f188d57ull, 0x0a2722586f2d042eull, 0x854fb3003f739fa5ull, 0xff97c3c80f4616dcull,
+        0x1bef5b57af4dc5adull, 0x61372b9f9f784cd4ull, 0xee5fbac7cf26d75full, 0x9487ca0fff135e26ull,
+        0xdbd7be24370c7322ull, 0xa10fceec0739fa5bull, 0x2e675fb4576761d0ull, 0x54bf2f7c6752e8a9ull,
+        0xcdcf48d84fe75459ull, 0xb71738107fd2dd20ull, 0x387fa9482f8c46abull, 0x42a7d9801fb9cfd2ull,
+        0x0df7adabd7a6e2d6ull, 0x772fdd63e7936bafull, 0xf8474c3bb7cdf024ull, 0x829f3cf387f8795dull,
+        0x66e7a46c27f3aa2cull, 0x1c3fd4a417c62355ull, 0x935745fc4798b8deull, 0xe98f353477ad31a7ull,
+        0xa6df411fbfb21ca3ull, 0xdc0731d78f8795daull, 0x536fa08fdfd90e51ull, 0x29b7d047efec8728ull,
+    },
+    {
+        0x0000000000000000ull, 0x89e99ffd73bddf69ull, 0x388a19a9bfec2db9ull, 0xb1638654cc51f2d0ull,
+        0x711433537fd85b72ull, 0xf8fdacae0c65841bull, 0x499e2afac03476cbull, 0xc077b507b389a9a2ull,
+        0xe22866a6ffb0b6e4ull, 0x6bc1f95b8c0d698dull, 0xdaa27f0f405c9b5dull, 0x534be0f233e14434ull,
+        0x933c55f58068ed96ull, 0x1ad5ca08f3d532ffull, 0xabb64c5c3f84c02full, 0x225fd3a14c391f46ull,
+        0xef09eb1ea7f6fea3ull, 0x66e074e3d44b21caull, 0xd783f2b7181ad31aull, 0x5e6a6d4a6ba70c73ull,
+        0x9e1dd84dd82ea5d1ull, 0x17f447b0ab937ab8ull, 0xa697c1e467c28868ull, 0x2f7e5e19147f5701ull,
+        0x0d218db858464847ull, 0x84c812452bfb972eull, 0x35ab9411e7aa65feull, 0xbc420bec9417ba97ull,
+        0x7c35beeb279e1335ull, 0xf5dc21165423cc5cull, 0x44bfa74298723e8cull, 0xcd5638bfebcfe1e5ull,
+        0xf54af06e177a6e2dull, 0x7ca36f9364c7b144ull, 0xcdc0e9c7a8964394ull, 0x4429763adb2b9cfdull,
+        0x845ec33d68a2355full, 0x0db75cc01b1fea36ull, 0xbcd4da94d74e18e6ull, 0x353d4569a4f3c78full,
+        0x176296c8e8cad8c9ull, 0x9e8b09359b7707a0ull, 0x2fe88f615726f570ull, 0xa601109c249b2a19ull,
+        0x6676a59b971283bbull, 0xef9f3a66e4af5cd2ull, 0x5efcbc3228feae02ull, 0xd71523cf5b43716bull,
+        0x1a431b70b08c908eull, 0x93aa848dc3314fe7ull, 0x22c902d90f60bd37ull, 0xab209d247cdd625eull,
+        0x6b572823cf54cbfcull, 0xe2beb7debce91495ull, 0x53dd318a70b8e645ull, 0xda34ae770305392cull,
+        0xf86b7dd64f3c266aull, 0x7182e22b3c81f903ull, 0xc0e1647ff0d00bd3ull, 0x4908fb82836dd4baull,
+        0x897f4e8530e47d18ull, 0x0096d1784359a271ull, 0xb1f5572c8f0850a1ull, 0x381cc8d1fcb58fc8ull,
+        0xc1ccc68f76634f31ull, 0x4825597205de9058ull, 0xf946df26c98f6288ull, 0x70af40dbba32bde1ull,
+        0xb0d8f5dc09bb1443ull, 0x39316a217a06cb2aull, 0x8852ec75b65739faull, 0x01bb7388c5eae693ull,
+        0x23e4a02989d3f9d5ull, 0xaa0d3fd4fa6e26bcull, 0x1b6eb980363fd46cull, 0x9287267d45820b05ull,
+        0x52f0937af60ba2a7ull, 0xdb190c8785b67dceull, 0x6a7a8ad349e78f1eull, 0xe393152e3a5a5077ull,
+        0x2ec52d91d195b192ull, 0xa72cb26ca2286efbull, 0x164f34386e799c2bull, 0x9fa6abc51dc44342ull,
+        0x5fd11ec2ae4deae0ull, 0xd638813fddf03589ull, 0x675b076b11a1c759ull, 0xeeb29896621c1830ull,
+        0xcced4b372e250776ull, 0x4504d4ca5d98d81full, 0xf467529e91c92acfull, 0x7d8ecd63e274f5a6ull,
+        0xbdf9786451fd5c04ull, 0x3410e7992240836dull, 0x857361cdee1171bdull, 0x0c9afe309dacaed4ull,
+        0x348636e16119211cull, 0xbd6fa91c12a4fe75ull, 0x0c0c2f48def50ca5ull, 0x85e5b0b5ad48d3ccull,
+        0x459205b21ec17a6eull, 0xcc7b9a4f6d7ca507ull, 0x7d181c1ba12d57d7ull, 0xf4f183e6d29088beull,
+        0xd6ae50479ea997f8ull, 0x5f47cfbaed144891ull, 0xee2449ee2145ba41ull, 0x67cdd61352f86528ull,
+        0xa7ba6314e171cc8aull, 0x2e53fce992cc13e3ull, 0x9f307abd5e9de133ull, 0x16d9e5402d203e5aull,
+        0xdb8fddffc6efdfbfull, 0x52664202b55200d6ull, 0xe305c4567903f206ull, 0x6aec5bab0abe2d6full,
+        0xaa9beeacb93784cdull, 0x23727151ca8a5ba4ull, 0x9211f70506dba974ull, 0x1bf868f87566761dull,
+        0x39a7bb59395f695bull, 0xb04e24a44ae2b632ull, 0x012da2f086b344e2ull, 0x88c43d0df50e9b8bull,
+        0x48b3880a46873229ull, 0xc15a17f7353aed40ull, 0x703991a3f96b1f90ull, 0xf9d00e5e8ad6c0f9ull,
+        0xa8c0ab4db4510d09ull, 0x212934b0c7ecd260ull, 0x904ab2e40bbd20b0ull, 0x19a32d197800ffd9ull,
+        0xd9d4981ecb89567bull, 0x503d07e3b8348912ull, 0xe15e81b774657bc2ull, 0x68b71e4a07d8a4abull,
+        0x4ae8cdeb4be1bbedull, 0xc3015216385c6484ull, 0x7262d442f40d9654ull, 0xfb8b4bbf87b0493dull,
+        0x3bfcfeb83439e09full, 0xb215614547843ff6ull, 0x0376e7118bd5cd26ull, 0x8a9f78ecf868124full,
+        0x47c9405313a7f3aaull, 0xce20dfae601a2cc3ull, 0x7f4359faac4bde13ull, 0xf6aac607dff6017aull,
+        0x36dd73006c7fa8d8ull, 0xbf34ecfd1fc277b1ull, 0x0e576aa9d3938561ull, 0x87bef554a02e5a08ull,
+        0xa5e126f5ec17454eull, 0x2c08b9089faa9a27ull, 0x9d6b3f5c53fb68f7ull, 0x1482a0a12046b79eull,
+        0xd4f515a693cf1e3cull, 0x5d1c8a5be072c155ull, 0xec7f0c0f2c233385ull, 0x659693f25f9eececull,
+        0x5d8a5b23a32b6324ull, 0xd463c4ded096bc4dull, 0x6500428a1cc74e9dull, 0xece9dd776f7a91f4ull,
+        0x2c9e6870dcf33856ull, 0xa577f78daf4ee73full, 0x141471d9631f15efull, 0x9dfdee2410a2ca86ull,
+        0xbfa23d855c9bd5c0ull, 0x364ba2782f260aa9ull, 0x8728242ce377f879ull, 0x0ec1bbd190ca2710ull,
+        0xceb60ed623438eb2ull, 0x475f912b50fe51dbull, 0xf63c177f9cafa30bull, 0x7fd58882ef127c62ull,
+        0xb283b03d04dd9d87ull, 0x3b6a2fc0776042eeull, 0x8a09a994bb31b03eull, 0x03e03669c88c6f57ull,
+        0xc397836e7b05c6f5ull, 0x4a7e1c9308b8199cull, 0xfb1d9ac7c4e9eb4cull, 0x72f4053ab7543425ull,
+        0x50abd69bfb6d2b63ull, 0xd942496688d0f40aull, 0x6821cf32448106daull, 0xe1c850cf373cd9b3ull,
+        0x21bfe5c884b57011ull, 0xa8567a35f708af78ull, 0x1935fc613b595da8ull, 0x90dc639c48e482c1ull,
+        0x690c6dc2c2324238ull, 0xe0e5f23fb18f9d51ull, 0x5186746b7dde6f81ull, 0xd86feb960e63b0e8ull,
+        0x18185e91bdea194aull, 0x91f1c16cce57c623ull, 0x20924738020634f3ull, 0xa97bd8c571bbeb9aull,
+        0x8b240b643d82f4dcull, 0x02cd94994e3f2bb5ull, 0xb3ae12cd826ed965ull, 0x3a478d30f1d3060cull,
+        0xfa303837425aafaeull, 0x73d9a7ca31e770c7ull, 0xc2ba219efdb68217ull, 0x4b53be638e0b5d7eull,
+        0x860586dc65c4bc9bull, 0x0fec1921167963f2ull, 0xbe8f9f75da289122ull, 0x37660088a9954e4bull,
+        0xf711b58f1a1ce7e9ull, 0x7ef82a7269a13880ull, 0xcf9bac26a5f0ca50ull, 0x467233dbd64d1539ull,
+        0x642de07a9a740a7full, 0xedc47f87e9c9d516ull, 0x5ca7f9d3259827c6ull, 0xd54e662e5625f8afull,
+        0x1539d329e5ac510dull, 0x9cd04cd496118e64ull, 0x2db3ca805a407cb4ull, 0xa45a557d29fda3ddull,
+        0x9c469dacd5482c15ull, 0x15af0251a6f5f37cull, 0xa4cc84056aa401acull, 0x2d251bf81919dec5ull,
+        0xed52aeffaa907767ull, 0x64bb3102d92da80eull, 0xd5d8b756157c5adeull, 0x5c3128ab66c185b7ull,
+        0x7e6efb0a2af89af1ull, 0xf78764f759454598ull, 0x46e4e2a39514b748ull, 0xcf0d7d5ee6a96821ull,
+        0x0f7ac8595520c183ull, 0x869357a4269d1eeaull, 0x37f0d1f0eaccec3aull, 0xbe194e0d99713353ull,
+        0x734f76b272bed2b6ull, 0xfaa6e94f01030ddfull, 0x4bc56f1bcd52ff0full, 0xc22cf0e6beef2066ull,
+        0x025b45e10d6689c4ull, 0x8bb2da1c7edb56adull, 0x3ad15c48b28aa47dull, 0xb338c3b5c1377b14ull,
+        0x916710148d0e6452ull, 0x188e8fe9feb3bb3bull, 0xa9ed09bd32e249ebull, 0x20049640415f9682ull,
+        0xe0732347f2d63f20ull, 0x699abcba816be049ull, 0xd8f93aee4d3a1299ull, 0x5110a5133e87cdf0ull,
+    },
+    {
+        0x0000000000000000ull, 0xf4125129ce4038beull, 0xc37d8400c417e217ull, 0x376fd5290a57daa9ull,
+        0xada22e52d0b85745ull, 0x59b07f7b1ef86ffbull, 0x6edfaa5214afb552ull, 0x9acdfb7bdaef8decull,
+        0x701d7af6f9e73de1ull, 0x840f2bdf37a7055full, 0xb360fef63df0dff6ull, 0x4772afdff3b0e748ull,
+        0xddbf54a4295f6aa4ull, 0x29ad058de71f521aull, 0x1ec2d0a4ed4888b3ull, 0xead0818d2308b00dull,
+        0xe03af5edf3ce7bc2ull, 0x1428a4c43d8e437cull, 0x234771ed37d999d5ull, 0xd75520c4f999a16bull,
+        0x4d98dbbf23762c87ull, 0xb98a8a96ed361439ull, 0x8ee55fbfe761ce90ull, 0x7af70e962921f62eull,
+        0x90278f1b0a294623ull, 0x6435de32c4697e9dull, 0x535a0b1bce3ea434ull, 0xa7485a32007e9c8aull,
+        0x3d85a149da911166ull, 0xc997f06014d129d8ull, 0xfef825491e86f371ull, 0x0aea7460d0c6cbcfull,
+        0xeb2ccd88bf0b64efull, 0x1f3e9ca1714b5c51ull, 0x285149887b1c86f8ull, 0xdc4318a1b55cbe46ull,
+        0x468ee3da6fb333aaull, 0xb29cb2f3a1f30b14ull, 0x85f367daaba4d1bdull, 0x71e136f365e4e903ull,
+        0x9b31b77e46ec590eull, 0x6f23e65788ac61b0ull, 0x584c337e82fbbb19ull, 0xac5e62574cbb83a7ull,
+        0x3693992c96540e4bull, 0xc281c805581436f5ull, 0xf5ee1d2c5243ec5cull, 0x01fc4c059c03d4e2ull,
+        0x0b1638654cc51f2dull, 0xff04694c82852793ull, 0xc86bbc6588d2fd3aull, 0x3c79ed4c4692c584ull,
+        0xa6b416379c7d4868ull, 0x52a6471e523d70d6ull, 0x65c99237586aaa7full, 0x91dbc31e962a92c1ull,
+        0x7b0b4293b52222ccull, 0x8f1913ba7b621a72ull, 0xb876c6937135c0dbull, 0x4c6497babf75f865ull,
+        0xd6a96cc1659a7589ull, 0x22bb3de8abda4d37ull, 0x15d4e8c1a18d979eull, 0xe1c6b9e86fcdaf20ull,
+        0xfd00bd4226815ab5ull, 0x0912ec6be8c1620bull, 0x3e7d3942e296b8a2ull, 0xca6f686b2cd6801cull,
+        0x50a29310f6390df0ull, 0xa4b0c2393879354eull, 0x93df1710322eefe7ull, 0x67cd4639fc6ed759ull,
+        0x8d1dc7b4df666754ull, 0x790f969d11265feaull, 0x4e6043b41b718543ull, 0xba72129dd531bdfdull,
+        0x20bfe9e60fde3011ull, 0xd4adb8cfc19e08afull, 0xe3c26de6cbc9d206ull, 0x17d03ccf0589eab8ull,
+        0x1d3a48afd54f2177ull, 0xe92819861b0f19c9ull, 0xde47ccaf1158c360ull, 0x2a559d86df18fbdeull,
+        0xb09866fd05f77632ull, 0x448a37d4cbb74e8cull, 0x73e5e2fdc1e09425ull, 0x87f7b3d40fa0ac9bull,
+        0x6d2732592ca81c96ull, 0x99356370e2e82428ull, 0xae5ab659e8bffe81ull, 0x5a48e77026ffc63full,
+        0xc0851c0bfc104bd3ull, 0x34974d223250736dull, 0x03f8980b3807a9c4ull, 0xf7eac922f647917aull,
+        0x162c70ca998a3e5aull, 0xe23e21e357ca06e4ull, 0xd551f4ca5d9ddc4dull, 0x2143a5e393dde4f3ull,
+        0xbb8e5e984932691full, 0x4f9c0fb1877251a1ull, 0x78f3da988d258b08ull, 0x8ce18bb14365b3b6ull,
+        0x66310a3c606d03bbull, 0x92235b15ae2d3b05ull, 0xa54c8e3ca47ae1acull, 0x515edf156a3ad912ull,
+        0xcb93246eb0d554feull, 0x3f8175477e956c40ull, 0x08eea06e74c2b6e9ull, 0xfcfcf147ba828e57ull,
+        0xf61685276a444598ull, 0x0204d40ea4047d26ull, 0x356b0127ae53a78full, 0xc179500e60139f31ull,
+        0x5bb4ab75bafc12ddull, 0xafa6fa5c74bc2a63ull, 0x98c92f757eebf0caull, 0x6cdb7e5cb0abc874ull,
+        0x860bffd193a37879ull, 0x7219aef85de340c7ull, 0x45767bd157b49a6eull, 0xb1642af899f4a2d0ull,
+        0x2ba9d183431b2f3cull, 0xdfbb80aa8d5b1782ull, 0xe8d45583870ccd2bull, 0x1cc604aa494cf595ull,
+        0xd1585cd715952601ull, 0x254a0dfedbd51ebfull, 0x1225d8d7d182c416ull, 0xe63789fe1fc2fca8ull,
+        0x7cfa7285c52d7144ull, 0x88e823ac0b6d49faull, 0xbf87f685013a9353ull, 0x4b95a7accf7aabedull,
+        0xa1452621ec721be0ull, 0x555777082232235eull, 0x6238a2212865f9f7ull, 0x962af308e625c149ull,
+        0x0ce708733cca4ca5ull, 0xf8f5595af28a741bull, 0xcf9a8c73f8ddaeb2ull, 0x3b88dd5a369d960cull,
+        0x3162a93ae65b5dc3ull, 0xc570f813281b657dull, 0xf21f2d3a224cbfd4ull, 0x060d7c13ec0c876aull,
+        0x9cc0876836e30a86ull, 0x68d2d641f8a33238ull, 0x5fbd0368f2f4e891ull, 0xabaf52413cb4d02full,
+        0x417fd3cc1fbc6022ull, 0xb56d82e5d1fc589cull, 0x820257ccdbab8235ull, 0x761006e515ebba8bull,
+        0xecddfd9ecf043767ull, 0x18cfacb701440fd9ull, 0x2fa0799e0b13d570ull, 0xdbb228b7c553edceull,
+        0x3a74915faa9e42eeull, 0xce66c07664de7a50ull, 0xf909155f6e89a0f9ull, 0x0d1b4476a0c99847ull,
+        0x97d6bf0d7a2615abull, 0x63c4ee24b4662d15ull, 0x54ab3b0dbe31f7bcull, 0xa0b96a247071cf02ull,
+        0x4a69eba953797f0full, 0xbe7bba809d3947b1ull, 0x89146fa9976e9d18ull, 0x7d063e80592ea5a6ull,
+        0xe7cbc5fb83c1284aull, 0x13d994d24d8110f4ull, 0x24b641fb47d6ca5dull, 0xd0a410d28996f2e3ull,
+        0xda4e64b25950392cull, 0x2e5c359b97100192ull, 0x1933e0b29d47db3bull, 0xed21b19b5307e385ull,
+        0x77ec4ae089e86e69ull, 0x83fe1bc947a856d7ull, 0xb491cee04dff8c7eull, 0x40839fc983bfb4c0ull,
+        0xaa531e44a0b704cdull, 0x5e414f6d6ef73c73ull, 0x692e9a4464a0e6daull, 0x9d3ccb6daae0de64ull,
+        0x07f13016700f5388ull, 0xf3e3613fbe4f6b36ull, 0xc48cb416b418b19full, 0x309ee53f7a588921ull,
+        0x2c58e19533147cb4ull, 0xd84ab0bcfd54440aull, 0xef256595f7039ea3ull, 0x1b3734bc3943a61dull,
+        0x81facfc7e3ac2bf1ull, 0x75e89eee2dec134full, 0x42874bc727bbc9e6ull, 0xb6951aeee9fbf158ull,
+        0x5c459b63caf34155ull, 0xa857ca4a04b379ebull, 0x9f381f630ee4a342ull, 0x6b2a4e4ac0a49bfcull,
+        0xf1e7b5311a4b1610ull, 0x05f5e418d40b2eaeull, 0x329a3131de5cf407ull, 0xc6886018101cccb9ull,
+        0xcc621478c0da0776ull, 0x387045510e9a3fc8ull, 0x0f1f907804cde561ull, 0xfb0dc151ca8ddddfull,
+        0x61c03a2a10625033ull, 0x95d26b03de22688dull, 0xa2bdbe2ad475b224ull, 0x56afef031a358a9aull,
+        0xbc7f6e8e393d3a97ull, 0x486d3fa7f77d0229ull, 0x7f02ea8efd2ad880ull, 0x8b10bba7336ae03eull,
+        0x11dd40dce9856dd2ull, 0xe5cf11f527c5556cull, 0xd2a0c4dc2d928fc5ull, 0x26b295f5e3d2b77bull,
+        0xc7742c1d8c1f185bull, 0x33667d34425f20e5ull, 0x0409a81d4808fa4cull, 0xf01bf9348648c2f2ull,
+        0x6ad6024f5ca74f1eull, 0x9ec4536692e777a0ull, 0xa9ab864f98b0ad09ull, 0x5db9d76656f095b7ull,
+        0xb76956eb75f825baull, 0x437b07c2bbb81d04ull, 0x7414d2ebb1efc7adull, 0x800683c27fafff13ull,
+        0x1acb78b9a54072ffull, 0xeed929906b004a41ull, 0xd9b6fcb9615790e8ull, 0x2da4ad90af17a856ull,
+        0x274ed9f07fd16399ull, 0xd35c88d9b1915b27ull, 0xe4335df0bbc6818eull, 0x10210cd97586b930ull,
+        0x8aecf7a2af6934dcull, 0x7efea68b61290c62ull, 0x499173a26b7ed6cbull, 0xbd83228ba53eee75ull,
+        0x5753a30686365e78ull, 0xa341f22f487666c6ull, 0x942e27064221bc6full, 0x603c762f8c6184d1ull,
+        0xfaf18d54568e093dull, 0x0ee3dc7d98ce3183ull, 0x398c09549299eb2aull, 0xcd9e587d5cd9d394ull,
+    },
+    {
+        0x0000000000000000ull, 0x8ce168638c796306ull, 0x329bf69440655567ull, 0xbe7a9ef7cc1c3661ull,
+        0x6537ed2880caaaceull, 0xe9d6854b0cb3c9c8ull, 0x57ac1bbcc0afffa9ull, 0xdb4d73df4cd69cafull,
+        0xca6fda510195559cull, 0x468eb2328dec369aull, 0xf8f42cc541f000fbull, 0x741544a6cd8963fdull,
+        0xaf583779815fff52ull, 0x23b95f1a0d269c54ull, 0x9dc3c1edc13aaa35ull, 0x1122a98e4d43c933ull,
+        0xbf8692f15bbd3853ull, 0x3367fa92d7c45b55ull, 0x8d1d64651bd86d34ull, 0x01fc0c0697a10e32ull,
+        0xdab17fd9db77929dull, 0x565017ba570ef19bull, 0xe82a894d9b12c7faull, 0x64cbe12e176ba4fcull,
+        0x75e948a05a286dcfull, 0xf90820c3d6510ec9ull, 0x4772be341a4d38a8ull, 0xcb93d65796345baeull,
+        0x10dea588dae2c701ull, 0x9c3fcdeb569ba407ull, 0x2245531c9a879266ull, 0xaea43b7f16fef160ull,
+        0x545403b1efede3cdull, 0xd8b56bd2639480cbull, 0x66cff525af88b6aaull, 0xea2e9d4623f1d5acull,
+        0x3163ee996f274903ull, 0xbd8286fae35e2a05ull, 0x03f8180d2f421c64ull, 0x8f19706ea33b7f62ull,
+        0x9e3bd9e0ee78b651ull, 0x12dab1836201d557ull, 0xaca02f74ae1de336ull, 0x2041471722648030ull,
+        0xfb0c34c86eb21c9full, 0x77ed5cabe2cb7f99ull, 0xc997c25c2ed749f8ull, 0x4576aa3fa2ae2afeull,
+        0xebd29140b450db9eull, 0x6733f9233829b898ull, 0xd94967d4f4358ef9ull, 0x55a80fb7784cedffull,
+        0x8ee57c68349a7150ull, 0x0204140bb8e31256ull, 0xbc7e8afc74ff2437ull, 0x309fe29ff8864731ull,
+        0x21bd4b11b5c58e02ull, 0xad5c237239bced04ull, 0x1326bd85f5a0db65ull, 0x9fc7d5e679d9b863ull,
+        0x448aa639350f24ccull, 0xc86bce5ab97647caull, 0x761150ad756a71abull, 0xfaf038cef91312adull,
+        0xa8a80763dfdbc79aull, 0x24496f0053a2a49cull, 0x9a33f1f79fbe92fdull, 0x16d2999413c7f1fbull,
+        0xcd9fea4b5f116d54ull, 0x417e8228d3680e52ull, 0xff041cdf1f743833ull, 0x73e574bc930d5b35ull,
+        0x62c7dd32de4e9206ull, 0xee26b5515237f100ull, 0x505c2ba69e2bc761ull, 0xdcbd43c51252a467ull,
+        0x07f0301a5e8438c8ull, 0x8b115879d2fd5bceull, 0x356bc68e1ee16dafull, 0xb98aaeed92980ea9ull,
+        0x172e95928466ffc9ull, 0x9bcffdf1081f9ccfull, 0x25b56306c403aaaeull, 0xa9540b65487ac9a8ull,
+        0x721978ba04ac5507ull, 0xfef810d988d53601ull, 0x40828e2e44c90060ull, 0xcc63e64dc8b06366ull,
+        0xdd414fc385f3aa55ull, 0x51a027a0098ac953ull, 0xefdab957c596ff32ull, 0x633bd13449ef9c34ull,
+        0xb876a2eb0539009bull, 0x3497ca888940639dull, 0x8aed547f455c55fcull, 0x060c3c1cc92536faull,
+        0xfcfc04d230362457ull, 0x701d6cb1bc4f4751ull, 0xce67f24670537130ull, 0x42869a25fc2a1236ull,
+        0x99cbe9fab0fc8e99ull, 0x152a81993c85ed9full, 0xab501f6ef099dbfeull, 0x27b1770d7ce0b8f8ull,
+        0x3693de8331a371cbull, 0xba72b6e0bdda12cdull, 0x0408281771c624acull, 0x88e94074fdbf47aaull,
+        0x53a433abb169db05ull, 0xdf455bc83d10b803ull, 0x613fc53ff10c8e62ull, 0xeddead5c7d75ed64ull,
+        0x437a96236b8b1c04ull, 0xcf9bfe40e7f27f02ull, 0x71e160b72bee4963ull, 0xfd0008d4a7972a65ull,
+        0x264d7b0beb41b6caull, 0xaaac13686738d5ccull, 0x14d68d9fab24e3adull, 0x9837e5fc275d80abull,
+        0x89154c726a1e4998ull, 0x05f42411e6672a9eull, 0xbb8ebae62a7b1cffull, 0x376fd285a6027ff9ull,
+        0xec22a15aead4e356ull, 0x60c3c93966ad8050ull, 0xdeb957ceaab1b631ull, 0x52583fad26c8d537ull,
+        0x7a092894e7201c5full, 0xf6e840f76b597f59ull, 0x4892de00a7454938ull, 0xc473b6632b3c2a3eull,
+        0x1f3ec5bc67eab691ull, 0x93dfaddfeb93d597ull, 0x2da53328278fe3f6ull, 0xa1445b4babf680f0ull,
+        0xb066f2c5e6b549c3ull, 0x3c879aa66acc2ac5ull, 0x82fd0451a6d01ca4ull, 0x0e1c6c322aa97fa2ull,
+        0xd5511fed667fe30dull, 0x59b0778eea06800bull, 0xe7cae979261ab66aull, 0x6b2b811aaa63d56cull,
+        0xc58fba65bc9d240cull, 0x496ed20630e4470aull, 0xf7144cf1fcf8716bull, 0x7bf524927081126dull,
+        0xa0b8574d3c578ec2ull, 0x2c593f2eb02eedc4ull, 0x9223a1d97c32dba5ull, 0x1ec2c9baf04bb8a3ull,
+        0x0fe06034bd087190ull, 0x8301085731711296ull, 0x3d7b96a0fd6d24f7ull, 0xb19afec3711447f1ull,
+        0x6ad78d1c3dc2db5eull, 0xe636e57fb1bbb858ull, 0x584c7b887da78e39ull, 0xd4ad13ebf1deed3full,
+        0x2e5d2b2508cdff92ull, 0xa2bc434684b49c94ull, 0x1cc6ddb148a8aaf5ull, 0x9027b5d2c4d1c9f3ull,
+        0x4b6ac60d8807555cull, 0xc78bae6e047e365aull, 0x79f13099c862003bull, 0xf51058fa441b633dull,
+        0xe432f1740958aa0eull, 0x68d399178521c908ull, 0xd6a907e0493dff69ull, 0x5a486f83c5449c6full,
+        0x81051c5c899200c0ull, 0x0de4743f05eb63c6ull, 0xb39eeac8c9f755a7ull, 0x3f7f82ab458e36a1ull,
+        0x91dbb9d45370c7c1ull, 0x1d3ad1b7df09a4c7ull, 0xa3404f40131592a6ull, 0x2fa127239f6cf1a0ull,
+        0xf4ec54fcd3ba6d0full, 0x780d3c9f5fc30e09ull, 0xc677a26893df3868ull, 0x4a96ca0b1fa65b6eull,
+        0x5bb4638552e5925dull, 0xd7550be6de9cf15bull, 0x692f95111280c73aull, 0xe5cefd729ef9a43cull,
+        0x3e838eadd22f3893ull, 0xb262e6ce5e565b95ull, 0x0c187839924a6df4ull, 0x80f9105a1e330ef2ull,
+        0xd2a12ff738fbdbc5ull, 0x5e404794b482b8c3ull, 0xe03ad963789e8ea2ull, 0x6cdbb100f4e7eda4ull,
+        0xb796c2dfb831710bull, 0x3b77aabc3448120dull, 0x850d344bf854246cull, 0x09ec5c28742d476aull,
+        0x18cef5a6396e8e59ull, 0x942f9dc5b517ed5full, 0x2a550332790bdb3eull, 0xa6b46b51f572b838ull,
+        0x7df9188eb9a42497ull, 0xf11870ed35dd4791ull, 0x4f62ee1af9c171f0ull, 0xc383867975b812f6ull,
+        0x6d27bd066346e396ull, 0xe1c6d565ef3f8090ull, 0x5fbc4b922323b6f1ull, 0xd35d23f1af5ad5f7ull,
+        0x0810502ee38c4958ull, 0x84f1384d6ff52a5eull, 0x3a8ba6baa3e91c3full, 0xb66aced92f907f39ull,
+        0xa748675762d3b60aull, 0x2ba90f34eeaad50cull, 0x95d391c322b6e36dull, 0x1932f9a0aecf806bull,
+        0xc27f8a7fe2191cc4ull, 0x4e9ee21c6e607fc2ull, 0xf0e47ceba27c49a3ull, 0x7c0514882e052aa5ull,
+        0x86f52c46d7163808ull, 0x0a1444255b6f5b0eull, 0xb46edad297736d6full, 0x388fb2b11b0a0e69ull,
+        0xe3c2c16e57dc92c6ull, 0x6f23a90ddba5f1c0ull, 0xd15937fa17b9c7a1ull, 0x5db85f999bc0a4a7ull,
+        0x4c9af617d6836d94ull, 0xc07b9e745afa0e92ull, 0x7e01008396e638f3ull, 0xf2e068e01a9f5bf5ull,
+        0x29ad1b3f5649c75aull, 0xa54c735cda30a45cull, 0x1b36edab162c923dull, 0x97d785c89a55f13bull,
+        0x3973beb78cab005bull, 0xb592d6d400d2635dull, 0x0be84823ccce553cull, 0x8709204040b7363aull,
+        0x5c44539f0c61aa95ull, 0xd0a53bfc8018c993ull, 0x6edfa50b4c04fff2ull, 0xe23ecd68c07d9cf4ull,
+        0xf31c64e68d3e55c7ull, 0x7ffd0c85014736c1ull, 0xc1879272cd5b00a0ull, 0x4d66fa11412263a6ull,
+        0x962b89ce0df4ff09ull, 0x1acae1ad818d9c0full, 0xa4b07f5a4d91aa6eull, 0x28511739c1e8c968ull,
+    },
+    {
+        0x0000000000000000ull, 0x3504e58b9ba6dd1eull, 0x6a09cb17374dba3cull, 0x5f0d2e9caceb6722ull,
+        0xd413962e6e9b7478ull, 0xe11773a5f53da966ull, 0xbe1a5d3959d6ce44ull, 0x8b1eb8b2c270135aull,
+        0x837e0a0f85a17b9bull, 0xb67aef841e07a685ull, 0xe977c118b2ecc1a7ull, 0xdc732493294a1cb9ull,
+        0x576d9c21eb3a0fe3ull, 0x626979aa709cd2fdull, 0x3d645736dc77b5dfull, 0x0860b2bd47d168c1ull,
+        0x2da5324c53d5645dull, 0x18a1d7c7c873b943ull, 0x47acf95b6498de61ull, 0x72a81cd0ff3e037full,
+        0xf9b6a4623d4e1025ull, 0xccb241e9a6e8cd3bull, 0x93bf6f750a03aa19ull, 0xa6bb8afe91a57707ull,
+        0xaedb3843d6741fc6ull, 0x9bdfddc84dd2c2d8ull, 0xc4d2f354e139a5faull, 0xf1d616df7a9f78e4ull,
+        0x7ac8ae6db8ef6bbeull, 0x4fcc4be62349b6a0ull, 0x10c1657a8fa2d182ull, 0x25c580f114040c9cull,
+        0x5b4a6498a7aac8baull, 0x6e4e81133c0c15a4ull, 0x3143af8f90e77286ull, 0x04474a040b41af98ull,
+        0x8f59f2b6c931bcc2ull, 0xba5d173d529761dcull, 0xe55039a1fe7c06feull, 0xd054dc2a65dadbe0ull,
+        0xd8346e97220bb321ull, 0xed308b1cb9ad6e3full, 0xb23da5801546091dull, 0x8739400b8ee0d403ull,
+        0x0c27f8b94c90c759ull, 0x39231d32d7361a47ull, 0x662e33ae7bdd7d65ull, 0x532ad625e07ba07bull,
+        0x76ef56d4f47face7ull, 0x43ebb35f6fd971f9ull, 0x1ce69dc3c33216dbull, 0x29e278485894cbc5ull,
+        0xa2fcc0fa9ae4d89full, 0x97f8257101420581ull, 0xc8f50bedada962a3ull, 0xfdf1ee66360fbfbdull,
+        0xf5915cdb71ded77cull, 0xc095b950ea780a62ull, 0x9f9897cc46936d40ull, 0xaa9c7247dd35b05eull,
+        0x2182caf51f45a304ull, 0x14862f7e84e37e1aull, 0x4b8b01e228081938ull, 0x7e8fe469b3aec426ull,
+        0xb694c9314f559174ull, 0x83902cbad4f34c6aull, 0xdc9d022678182b48ull, 0xe999e7ade3bef656ull,
+        0x62875f1f21cee50cull, 0x5783ba94ba683812ull, 0x088e940816835f30ull, 0x3d8a71838d25822eull,
+        0x35eac33ecaf4eaefull, 0x00ee26b5515237f1ull, 0x5fe30829fdb950d3ull, 0x6ae7eda2661f8dcdull,
+        0xe1f95510a46f9e97ull, 0xd4fdb09b3fc94389ull, 0x8bf09e07932224abull, 0xbef47b8c0884f9b5ull,
+        0x9b31fb7d1c80f529ull, 0xae351ef687262837ull, 0xf138306a2bcd4f15ull, 0xc43cd5e1b06b920bull,
+        0x4f226d53721b8151ull, 0x7a2688d8e9bd5c4full, 0x252ba64445563b6dull, 0x102f43cfdef0e673ull,
+        0x184ff17299218eb2ull, 0x2d4b14f9028753acull, 0x72463a65ae6c348eull, 0x4742dfee35cae990ull,
+        0xcc5c675cf7bafacaull, 0xf95882d76c1c27d4ull, 0xa655ac4bc0f740f6ull, 0x935149c05b519de8ull,
+        0xeddeada9e8ff59ceull, 0xd8da4822735984d0ull, 0x87d766bedfb2e3f2ull, 0xb2d3833544143eecull,
+        0x39cd3b8786642db6ull, 0x0cc9de0c1dc2f0a8ull, 0x53c4f090b129978aull, 0x66c0151b2a8f4a94ull,
+        0x6ea0a7a66d5e2255ull, 0x5ba4422df6f8ff4bull, 0x04a96cb15a139869ull, 0x31ad893ac1b54577ull,
+        0xbab3318803c5562dull, 0x8fb7d40398638b33ull, 0xd0bafa9f3488ec11ull, 0xe5be1f14af2e310full,
+        0xc07b9fe5bb2a3d93ull, 0xf57f7a6e208ce08dull, 0xaa7254f28c6787afull, 0x9f76b17917c15ab1ull,
+        0x146809cbd5b149ebull, 0x216cec404e1794f5ull, 0x7e61c2dce2fcf3d7ull, 0x4b652757795a2ec9ull,
+        0x430595ea3e8b4608ull, 0x76017061a52d9b16ull, 0x290c5efd09c6fc34ull, 0x1c08bb769260212aull,
+        0x971603c450103270ull, 0xa212e64fcbb6ef6eull, 0xfd1fc8d3675d884cull, 0xc81b2d58fcfb5552ull,
+        0x4670b431c63cb183ull, 0x737451ba5d9a6c9dull, 0x2c797f26f1710bbfull, 0x197d9aad6ad7d6a1ull,
+        0x9263221fa8a7c5fbull, 0xa767c794330118e5ull, 0xf86ae9089fea7fc7ull, 0xcd6e0c83044ca2d9ull,
+        0xc50ebe3e439dca18ull, 0xf00a5bb5d83b1706ull, 0xaf07752974d07024ull, 0x9a0390a2ef76ad3aull,
+        0x111d28102d06be60ull, 0x2419cd9bb6a0637eull, 0x7b14e3071a4b045cull, 0x4e10068c81edd942ull,
+        0x6bd5867d95e9d5deull, 0x5ed163f60e4f08c0ull, 0x01dc4d6aa2a46fe2ull, 0x34d8a8e13902b2fcull,
+        0xbfc61053fb72a1a6ull, 0x8ac2f5d860d47cb8ull, 0xd5cfdb44cc3f1b9aull, 0xe0cb3ecf5799c684ull,
+        0xe8ab8c721048ae45ull, 0xddaf69f98bee735bull, 0x82a2476527051479ull, 0xb7a6a2eebca3c967ull,
+        0x3cb81a5c7ed3da3dull, 0x09bcffd7e5750723ull, 0x56b1d14b499e6001ull, 0x63b534c0d238bd1full,
+        0x1d3ad0a961967939ull, 0x283e3522fa30a427ull, 0x77331bbe56dbc305ull, 0x4237fe35cd7d1e1bull,
+        0xc92946870f0d0d41ull, 0xfc2da30c94abd05full, 0xa3208d903840b77dull, 0x9624681ba3e66a63ull,
+        0x9e44daa6e43702a2ull, 0xab403f2d7f91dfbcull, 0xf44d11b1d37ab89eull, 0xc149f43a48dc6580ull,
+        0x4a574c888aac76daull, 0x7f53a903110aabc4ull, 0x205e879fbde1cce6ull, 0x155a6214264711f8ull,
+        0x309fe2e532431d64ull, 0x059b076ea9e5c07aull, 0x5a9629f2050ea758ull, 0x6f92cc799ea87a46ull,
+        0xe48c74cb5cd8691cull, 0xd1889140c77eb402ull, 0x8e85bfdc6b95d320ull, 0xbb815a57f0330e3eull,
+        0xb3e1e8eab7e266ffull, 0x86e50d612c44bbe1ull, 0xd9e823fd80afdcc3ull, 0xececc6761b0901ddull,
+        0x67f27ec4d9791287ull, 0x52f69b4f42dfcf99ull, 0x0dfbb5d3ee34a8bbull, 0x38ff5058759275a5ull,
+        0xf0e47d00896920f7ull, 0xc5e0988b12cffde9ull, 0x9aedb617be249acbull, 0xafe9539c258247d5ull,
+        0x24f7eb2ee7f2548full, 0x11f30ea57c548991ull, 0x4efe2039d0bfeeb3ull, 0x7bfac5b24b1933adull,
+        0x739a770f0cc85b6cull, 0x469e9284976e8672ull, 0x1993bc183b85e150ull, 0x2c975993a0233c4eull,
+        0xa789e12162532f14ull, 0x928d04aaf9f5f20aull, 0xcd802a36551e9528ull, 0xf884cfbdceb84836ull,
+        0xdd414f4cdabc44aaull, 0xe845aac7411a99b4ull, 0xb748845bedf1fe96ull, 0x824c61d076572388ull,
+        0x0952d962b42730d2ull, 0x3c563ce92f81edccull, 0x635b1275836a8aeeull, 0x565ff7fe18cc57f0ull,
+        0x5e3f45435f1d3f31ull, 0x6b3ba0c8c4bbe22full, 0x34368e546850850dull, 0x01326bdff3f65813ull,
+        0x8a2cd36d31864b49ull, 0xbf2836e6aa209657ull, 0xe025187a06cbf175ull, 0xd521fdf19d6d2c6bull,
+        0xabae19982ec3e84dull, 0x9eaafc13b5653553ull, 0xc1a7d28f198e5271ull, 0xf4a3370482288f6full,
+        0x7fbd8fb640589c35ull, 0x4ab96a3ddbfe412bull, 0x15b444a177152609ull, 0x20b0a12aecb3fb17ull,
+        0x28d01397ab6293d6ull, 0x1dd4f61c30c44ec8ull, 0x42d9d8809c2f29eaull, 0x77dd3d0b0789f4f4ull,
+        0xfcc385b9c5f9e7aeull, 0xc9c760325e5f3ab0ull, 0x96ca4eaef2b45d92ull, 0xa3ceab256912808cull,
+        0x860b2bd47d168c10ull, 0xb30fce5fe6b0510eull, 0xec02e0c34a5b362cull, 0xd9060548d1fdeb32ull,
+        0x5218bdfa138df868ull, 0x671c5871882b2576ull, 0x381176ed24c04254ull, 0x0d159366bf669f4aull,
+        0x057521dbf8b7f78bull, 0x3071c45063112a95ull, 0x6f7ceacccffa4db7ull, 0x5a780f47545c90a9ull,
+        0xd166b7f5962c83f3ull, 0xe462527e0d8a5eedull, 0xbb6f7ce2a16139cfull, 0x8e6b99693ac7e4d1ull,
+    },
+    {
+        0x0000000000000000ull, 0xe39d1389931b9354ull, 0xec6301407ea0b5c3ull, 0x0ffe12c9edbb2697ull,
+        0xf39f24d3a5d6f8edull, 0x1002375a36cd6bb9ull, 0x1ffc2593db764d2eull, 0xfc61361a486dde7aull,
+        0xcc676ff4133a62b1ull, 0x2ffa7c7d8021f1e5ull, 0x20046eb46d9ad772ull, 0xc3997d3dfe814426ull,
+        0x3ff84b27b6ec9a5cull, 0xdc6558ae25f70908ull, 0xd39b4a67c84c2f9full, 0x300659ee5b57bccbull,
+        0xb397f9bb7ee35609ull, 0x500aea32edf8c55dull, 0x5ff4f8fb0043e3caull, 0xbc69eb729358709eull,
+        0x4008dd68db35aee4ull, 0xa395cee1482e3db0ull, 0xac6bdc28a5951b27ull, 0x4ff6cfa1368e8873ull,
+        0x7ff0964f6dd934b8ull, 0x9c6d85c6fec2a7ecull, 0x9393970f1379817bull, 0x700e84868062122full,
+        0x8c6fb29cc80fcc55ull, 0x6ff2a1155b145f01ull, 0x600cb3dcb6af7996ull, 0x8391a05525b4eac2ull,
+        0x4c76d525a5513f79ull, 0xafebc6ac364aac2dull, 0xa015d465dbf18abaull, 0x4388c7ec48ea19eeull,
+        0xbfe9f1f60087c794ull, 0x5c74e27f939c54c0ull, 0x538af0b67e277257ull, 0xb017e33fed3ce103ull,
+        0x8011bad1b66b5dc8ull, 0x638ca9582570ce9cull, 0x6c72bb91c8cbe80bull, 0x8fefa8185bd07b5full,
+        0x738e9e0213bda525ull, 0x90138d8b80a63671ull, 0x9fed9f426d1d10e6ull, 0x7c708ccbfe0683b2ull,
+        0xffe12c9edbb26970ull, 0x1c7c3f1748a9fa24ull, 0x13822ddea512dcb3ull, 0xf01f3e5736094fe7ull,
+        0x0c7e084d7e64919dull, 0xefe31bc4ed7f02c9ull, 0xe01d090d00c4245eull, 0x03801a8493dfb70aull,
+        0x3386436ac8880bc1ull, 0xd01b50e35b939895ull, 0xdfe5422ab628be02ull, 0x3c7851a325332d56ull,
+        0xc01967b96d5ef32cull, 0x23847430fe456078ull, 0x2c7a66f913fe46efull, 0xcfe7757080e5d5bbull,
+        0x98edaa4b4aa27ef2ull, 0x7b70b9c2d9b9eda6ull, 0x748eab0b3402cb31ull, 0x9713b882a7195865ull,
+        0x6b728e98ef74861full, 0x88ef9d117c6f154bull, 0x87118fd891d433dcull, 0x648c9c5102cfa088ull,
+        0x548ac5bf59981c43ull, 0xb717d636ca838f17ull, 0xb8e9c4ff2738a980ull, 0x5b74d776b4233ad4ull,
+        0xa715e16cfc4ee4aeull, 0x4488f2e56f5577faull, 0x4b76e02c82ee516dull, 0xa8ebf3a511f5c239ull,
+        0x2b7a53f0344128fbull, 0xc8e74079a75abbafull, 0xc71952b04ae19d38ull, 0x24844139d9fa0e6cull,
+        0xd8e577239197d016ull, 0x3b7864aa028c4342ull, 0x34867663ef3765d5ull, 0xd71b65ea7c2cf681ull,
+        0xe71d3c04277b4a4aull, 0x04802f8db460d91eull, 0x0b7e3d4459dbff89ull, 0xe8e32ecdcac06cddull,
+        0x148218d782adb2a7ull, 0xf71f0b5e11b621f3ull, 0xf8e11997fc0d0764ull, 0x1b7c0a1e6f169430ull,
+        0xd49b7f6eeff3418bull, 0x37066ce77ce8d2dfull, 0x38f87e2e9153f448ull, 0xdb656da70248671cull,
+        0x27045bbd4a25b966ull, 0xc4994834d93e2a32ull, 0xcb675afd34850ca5ull, 0x28fa4974a79e9ff1ull,
+        0x18fc109afcc9233aull, 0xfb6103136fd2b06eull, 0xf49f11da826996f9ull, 0x17020253117205adull,
+        0xeb633449591fdbd7ull, 0x08fe27c0ca044883ull, 0x0700350927bf6e14ull, 0xe49d2680b4a4fd40ull,
+        0x670c86d591101782ull, 0x8491955c020b84d6ull, 0x8b6f8795efb0a241ull, 0x68f2941c7cab3115ull,
+        0x9493a20634c6ef6full, 0x770eb18fa7dd7c3bull, 0x78f0a3464a665aacull, 0x9b6db0cfd97dc9f8ull,
+        0xab6be921822a7533ull, 0x48f6faa81131e667ull, 0x4708e861fc8ac0f0ull, 0xa495fbe86f9153a4ull,
+        0x58f4cdf227fc8ddeull, 0xbb69de7bb4e71e8aull, 0xb497ccb2595c381dull, 0x570adf3bca47ab49ull,
+        0x1a8272c5cdd36e8full, 0xf91f614c5ec8fddbull, 0xf6e17385b373db4cull, 0x157c600c20684818ull,
+        0xe91d561668059662ull, 0x0a80459ffb1e0536ull, 0x057e575616a523a1ull, 0xe6e344df85beb0f5ull,
+        0xd6e51d31dee90c3eull, 0x35780eb84df29f6aull, 0x3a861c71a049b9fdull, 0xd91b0ff833522aa9ull,
+        0x257a39e27b3ff4d3ull, 0xc6e72a6be8246787ull, 0xc91938a2059f4110ull, 0x2a842b2b9684d244ull,
+        0xa9158b7eb3303886ull, 0x4a8898f7202babd2ull, 0x45768a3ecd908d45ull, 0xa6eb99b75e8b1e11ull,
+        0x5a8aafad16e6c06bull, 0xb917bc2485fd533full, 0xb6e9aeed684675a8ull, 0x5574bd64fb5de6fcull,
+        0x6572e48aa00a5a37ull, 0x86eff7033311c963ull, 0x8911e5cadeaaeff4ull, 0x6a8cf6434db17ca0ull,
+        0x96edc05905dca2daull, 0x7570d3d096c7318eull, 0x7a8ec1197b7c1719ull, 0x9913d290e867844dull,
+        0x56f4a7e0688251f6ull, 0xb569b469fb99c2a2ull, 0xba97a6a01622e435ull, 0x590ab52985397761ull,
+        0xa56b8333cd54a91bull, 0x46f690ba5e4f3a4full, 0x49088273b3f41cd8ull, 0xaa9591fa20ef8f8cull,
+        0x9a93c8147bb83347ull, 0x790edb9de8a3a013ull, 0x76f0c95405188684ull, 0x956ddadd960315d0ull,
+        0x690cecc7de6ecbaaull, 0x8a91ff4e4d7558feull, 0x856fed87a0ce7e69ull, 0x66f2fe0e33d5ed3dull,
+        0xe5635e5b166107ffull, 0x06fe4dd2857a94abull, 0x09005f1b68c1b23cull, 0xea9d4c92fbda2168ull,
+        0x16fc7a88b3b7ff12ull, 0xf561690120ac6c46ull, 0xfa9f7bc8cd174ad1ull, 0x190268415e0cd985ull,
+        0x290431af055b654eull, 0xca9922269640f61aull, 0xc56730ef7bfbd08dull, 0x26fa2366e8e043d9ull,
+        0xda9b157ca08d9da3ull, 0x390606f533960ef7ull, 0x36f8143cde2d2860ull, 0xd56507b54d36bb34ull,
+        0x826fd88e8771107dull, 0x61f2cb07146a8329ull, 0x6e0cd9cef9d1a5beull, 0x8d91ca476aca36eaull,
+        0x71f0fc5d22a7e890ull, 0x926defd4b1bc7bc4ull, 0x9d93fd1d5c075d53ull, 0x7e0eee94cf1cce07ull,
+        0x4e08b77a944b72ccull, 0xad95a4f30750e198ull, 0xa26bb63aeaebc70full, 0x41f6a5b379f0545bull,
+        0xbd9793a9319d8a21ull, 0x5e0a8020a2861975ull, 0x51f492e94f3d3fe2ull, 0xb2698160dc26acb6ull,
+        0x31f82135f9924674ull, 0xd26532bc6a89d520ull, 0xdd9b20758732f3b7ull, 0x3e0633fc142960e3ull,
+        0xc26705e65c44be99ull, 0x21fa166fcf5f2dcdull, 0x2e0404a622e40b5aull, 0xcd99172fb1ff980eull,
+        0xfd9f4ec1eaa824c5ull, 0x1e025d4879b3b791ull, 0x11fc4f8194089106ull, 0xf2615c0807130252ull,
+        0x0e006a124f7edc28ull, 0xed9d799bdc654f7cull, 0xe2636b5231de69ebull, 0x01fe78dba2c5fabfull,
+        0xce190dab22202f04ull, 0x2d841e22b13bbc50ull, 0x227a0ceb5c809ac7ull, 0xc1e71f62cf9b0993ull,
+        0x3d86297887f6d7e9ull, 0xde1b3af114ed44bdull, 0xd1e52838f956622aull, 0x32783bb16a4df17eull,
+        0x027e625f311a4db5ull, 0xe1e371d6a201dee1ull, 0xee1d631f4fbaf876ull, 0x0d807096dca16b22ull,
+        0xf1e1468c94ccb558ull, 0x127c550507d7260cull, 0x1d8247ccea6c009bull, 0xfe1f5445797793cfull,
+        0x7d8ef4105cc3790dull, 0x9e13e799cfd8ea59ull, 0x91edf5502263ccceull, 0x7270e6d9b1785f9aull,
+        0x8e11d0c3f91581e0ull, 0x6d8cc34a6a0e12b4ull, 0x6272d18387b53423ull, 0x81efc20a14aea777ull,
+        0xb1e99be44ff91bbcull, 0x5274886ddce288e8ull, 0x5d8a9aa43159ae7full, 0xbe17892da2423d2bull,
+        0x4276bf37ea2fe351ull, 0xa1ebacbe79347005ull, 0xae15be77948f5692ull, 0x4d88adfe0794c5c6ull,
+    },
+    {
+        0x0000000000000000ull, 0x62a95de6e302eff2ull, 0xc552bbcdc605dfe4ull, 0xa7fbe62b25073016ull,
+        0xa1fc51c8d49c2ca3ull, 0xc3550c2e379ec351ull, 0x64aeea051299f347ull, 0x0607b7e3f19b1cb5ull,
+        0x68a185c2f1afca2dull, 0x0a08d82412ad25dfull, 0xadf33e0f37aa15c9ull, 0xcf5a63e9d4a8fa3bull,
+        0xc95dd40a2533e68eull, 0xabf489ecc631097cull, 0x0c0f6fc7e336396aull, 0x6ea632210034d698ull,
+        0xd1430b85e35f945aull, 0xb3ea5663005d7ba8ull, 0x1411b048255a4bbeull, 0x76b8edaec658a44cull,
+        0x70bf5a4d37c3b8f9ull, 0x121607abd4c1570bull, 0xb5ede180f1c6671dull, 0xd744bc6612c488efull,
+        0xb9e28e4712f05e77ull, 0xdb4bd3a1f1f2b185ull, 0x7cb0358ad4f58193ull, 0x1e19686c37f76e61ull,
+        0x181edf8fc66c72d4ull, 0x7ab78269256e9d26ull, 0xdd4c64420069ad30ull, 0xbfe539a4e36b42c2ull,
+        0x89df31589e28bbdfull, 0xeb766cbe7d2a542dull, 0x4c8d8a95582d643bull, 0x2e24d773bb2f8bc9ull,
+        0x282360904ab4977cull, 0x4a8a3d76a9b6788eull, 0xed71db5d8cb14898ull, 0x8fd886bb6fb3a76aull,
+        0xe17eb49a6f8771f2ull, 0x83d7e97c8c859e00ull, 0x242c0f57a982ae16ull, 0x468552b14a8041e4ull,
+        0x4082e552bb1b5d51ull, 0x222bb8b45819b2a3ull, 0x85d05e9f7d1e82b5ull, 0xe77903799e1c6d47ull,
+        0x589c3add7d772f85ull, 0x3a35673b9e75c077ull, 0x9dce8110bb72f061ull, 0xff67dcf658701f93ull,
+        0xf9606b15a9eb0326ull, 0x9bc936f34ae9ecd4ull, 0x3c32d0d86feedcc2ull, 0x5e9b8d3e8cec3330ull,
+        0x303dbf1f8cd8e5a8ull, 0x5294e2f96fda0a5aull, 0xf56f04d24add3a4cull, 0x97c65934a9dfd5beull,
+        0x91c1eed75844c90bull, 0xf368b331bb4626f9ull, 0x5493551a9e4116efull, 0x363a08fc7d43f91dull,
+        0x38e744e264c6e4d5ull, 0x5a4e190487c40b27ull, 0xfdb5ff2fa2c33b31ull, 0x9f1ca2c941c1d4c3ull,
+        0x991b152ab05ac876ull, 0xfbb248cc53582784ull, 0x5c49aee7765f1792ull, 0x3ee0f301955df860ull,
+        0x5046c12095692ef8ull, 0x32ef9cc6766bc10aull, 0x95147aed536cf11cull, 0xf7bd270bb06e1eeeull,
+        0xf1ba90e841f5025bull, 0x9313cd0ea2f7eda9ull, 0x34e82b2587f0ddbfull, 0x564176c364f2324dull,
+        0xe9a44f678799708full, 0x8b0d1281649b9f7dull, 0x2cf6f4aa419caf6bull, 0x4e5fa94ca29e4099ull,
+        0x48581eaf53055c2cull, 0x2af14349b007b3deull, 0x8d0aa562950083c8ull, 0xefa3f88476026c3aull,
+        0x8105caa57636baa2ull, 0xe3ac974395345550ull, 0x44577168b0336546ull, 0x26fe2c8e53318ab4ull,
+        0x20f99b6da2aa9601ull, 0x4250c68b41a879f3ull, 0xe5ab20a064af49e5ull, 0x87027d4687ada617ull,
+        0xb13875bafaee5f0aull, 0xd391285c19ecb0f8ull, 0x746ace773ceb80eeull, 0x16c39391dfe96f1cull,
+        0x10c424722e7273a9ull, 0x726d7994cd709c5bull, 0xd5969fbfe877ac4dull, 0xb73fc2590b7543bfull,
+        0xd999f0780b419527ull, 0xbb30ad9ee8437ad5ull, 0x1ccb4bb5cd444ac3ull, 0x7e6216532e46a531ull,
+        0x7865a1b0dfddb984ull, 0x1accfc563cdf5676ull, 0xbd371a7d19d86660ull, 0xdf9e479bfada8992ull,
+        0x607b7e3f19b1cb50ull, 0x02d223d9fab324a2ull, 0xa529c5f2dfb414b4ull, 0xc78098143cb6fb46ull,
+        0xc1872ff7cd2de7f3ull, 0xa32e72112e2f0801ull, 0x04d5943a0b283817ull, 0x667cc9dce82ad7e5ull,
+        0x08dafbfde81e017dull, 0x6a73a61b0b1cee8full, 0xcd8840302e1bde99ull, 0xaf211dd6cd19316bull,
+        0xa926aa353c822ddeull, 0xcb8ff7d3df80c22cull, 0x6c7411f8fa87f23aull, 0x0edd4c1e19851dc8ull,
+        0x71ce89c4c98dc9aaull, 0x1367d4222a8f2658ull, 0xb49c32090f88164eull, 0xd6356fefec8af9bcull,
+        0xd032d80c1d11e509ull, 0xb29b85eafe130afbull, 0x156063c1db143aedull, 0x77c93e273816d51full,
+        0x196f0c0638220387ull, 0x7bc651e0db20ec75ull, 0xdc3db7cbfe27dc63ull, 0xbe94ea2d1d253391ull,
+        0xb8935dceecbe2f24ull, 0xda3a00280fbcc0d6ull, 0x7dc1e6032abbf0c0ull, 0x1f68bbe5c9b91f32ull,
+        0xa08d82412ad25df0ull, 0xc224dfa7c9d0b202ull, 0x65df398cecd78214ull, 0x0776646a0fd56de6ull,
+        0x0171d389fe4e7153ull, 0x63d88e6f1d4c9ea1ull, 0xc4236844384baeb7ull, 0xa68a35a2db494145ull,
+        0xc82c0783db7d97ddull, 0xaa855a65387f782full, 0x0d7ebc4e1d784839ull, 0x6fd7e1a8fe7aa7cbull,
+        0x69d0564b0fe1bb7eull, 0x0b790badece3548cull, 0xac82ed86c9e4649aull, 0xce2bb0602ae68b68ull,
+        0xf811b89c57a57275ull, 0x9ab8e57ab4a79d87ull, 0x3d43035191a0ad91ull, 0x5fea5eb772a24263ull,
+        0x59ede95483395ed6ull, 0x3b44b4b2603bb124ull, 0x9cbf5299453c8132ull, 0xfe160f7fa63e6ec0ull,
+        0x90b03d5ea60ab858ull, 0xf21960b8450857aaull, 0x55e28693600f67bcull, 0x374bdb75830d884eull,
+        0x314c6c96729694fbull, 0x53e5317091947b09ull, 0xf41ed75bb4934b1full, 0x96b78abd5791a4edull,
+        0x2952b319b4fae62full, 0x4bfbeeff57f809ddull, 0xec0008d472ff39cbull, 0x8ea9553291fdd639ull,
+        0x88aee2d16066ca8cull, 0xea07bf378364257eull, 0x4dfc591ca6631568ull, 0x2f5504fa4561fa9aull,
+        0x41f336db45552c02ull, 0x235a6b3da657c3f0ull, 0x84a18d168350f3e6ull, 0xe608d0f060521c14ull,
+        0xe00f671391c900a1ull, 0x82a63af572cbef53ull, 0x255ddcde57ccdf45ull, 0x47f48138b4ce30b7ull,
+        0x4929cd26ad4b2d7full, 0x2b8090c04e49c28dull, 0x8c7b76eb6b4ef29bull, 0xeed22b0d884c1d69ull,
+        0xe8d59cee79d701dcull, 0x8a7cc1089ad5ee2eull, 0x2d872723bfd2de38ull, 0x4f2e7ac55cd031caull,
+        0x218848e45ce4e752ull, 0x43211502bfe608a0ull, 0xe4daf3299ae138b6ull, 0x8673aecf79e3d744ull,
+        0x8074192c8878cbf1ull, 0xe2dd44ca6b7a2403ull, 0x4526a2e14e7d1415ull, 0x278fff07ad7ffbe7ull,
+        0x986ac6a34e14b925ull, 0xfac39b45ad1656d7ull, 0x5d387d6e881166c1ull, 0x3f9120886b138933ull,
+        0x3996976b9a889586ull, 0x5b3fca8d798a7a74ull, 0xfcc42ca65c8d4a62ull, 0x9e6d7140bf8fa590ull,
+        0xf0cb4361bfbb7308ull, 0x92621e875cb99cfaull, 0x3599f8ac79beacecull, 0x5730a54a9abc431eull,
+        0x513712a96b275fabull, 0x339e4f4f8825b059ull, 0x9465a964ad22804full, 0xf6ccf4824e206fbdull,
+        0xc0f6fc7e336396a0ull, 0xa25fa198d0617952ull, 0x05a447b3f5664944ull, 0x670d1a551664a6b6ull,
+        0x610aadb6e7ffba03ull, 0x03a3f05004fd55f1ull, 0xa458167b21fa65e7ull, 0xc6f14b9dc2f88a15ull,
+        0xa85779bcc2cc5c8dull, 0xcafe245a21ceb37full, 0x6d05c27104c98369ull, 0x0fac9f97e7cb6c9bull,
+        0x09ab28741650702eull, 0x6b027592f5529fdcull, 0xccf993b9d055afcaull, 0xae50ce5f33574038ull,
+        0x11b5f7fbd03c02faull, 0x731caa1d333eed08ull, 0xd4e74c361639dd1eull, 0xb64e11d0f53b32ecull,
+        0xb049a63304a02e59ull, 0xd2e0fbd5e7a2c1abull, 0x751b1dfec2a5f1bdull, 0x17b2401821a71e4full,
+        0x791472392193c8d7ull, 0x1bbd2fdfc2912725ull, 0xbc46c9f4e7961733ull, 0xdeef94120494f8c1ull,
+        0xd8e823f1f50fe474ull, 0xba417e17160d0b86ull, 0x1dba983c330a3b90ull, 0x7f13c5dad008d462ull,
+    },
+    {
+        0x0000000000000000ull, 0x381d0015c96f4444ull, 0x703a002b92de8888ull, 0x4827003e5bb1ccccull,
+        0xe074005725bd1110ull, 0xd8690042ecd25554ull, 0x904e007cb7639998ull, 0xa85300697e0cdddcull,
+        0xebb126fd13edb14bull, 0xd3ac26e8da82f50full, 0x9b8b26d6813339c3ull, 0xa39626c3485c7d87ull,
+        0x0bc526aa3650a05bull, 0x33d826bfff3fe41full, 0x7bff2681a48e28d3ull, 0x43e226946de16c97ull,
+        0xfc3b6ba97f4cf1fdull, 0xc4266bbcb623b5b9ull, 0x8c016b82ed927975ull, 0xb41c6b9724fd3d31ull,
+        0x1c4f6bfe5af1e0edull, 0x24526beb939ea4a9ull, 0x6c756bd5c82f6865ull, 0x54686bc001402c21ull,
+        0x178a4d546ca140b6ull, 0x2f974d41a5ce04f2ull, 0x67b04d7ffe7fc83eull, 0x5fad4d6a37108c7aull,
+        0xf7fe4d03491c51a6ull, 0xcfe34d16807315e2ull, 0x87c44d28dbc2d92eull, 0xbfd94d3d12ad9d6aull,
+        0xd32ff101a60e7091ull, 0xeb32f1146f6134d5ull, 0xa315f12a34d0f819ull, 0x9b08f13ffdbfbc5dull,
+        0x335bf15683b36181ull, 0x0b46f1434adc25c5ull, 0x4361f17d116de909ull, 0x7b7cf168d802ad4dull,
+        0x389ed7fcb5e3c1daull, 0x0083d7e97c8c859eull, 0x48a4d7d7273d4952ull, 0x70b9d7c2ee520d16ull,
+        0xd8ead7ab905ed0caull, 0xe0f7d7be5931948eull, 0xa8d0d78002805842ull, 0x90cdd795cbef1c06ull,
+        0x2f149aa8d942816cull, 0x17099abd102dc528ull, 0x5f2e9a834b9c09e4ull, 0x67339a9682f34da0ull,
+        0xcf609afffcff907cull, 0xf77d9aea3590d438ull, 0xbf5a9ad46e2118f4ull, 0x87479ac1a74e5cb0ull,
+        0xc4a5bc55caaf3027ull, 0xfcb8bc4003c07463ull, 0xb49fbc7e5871b8afull, 0x8c82bc6b911efcebull,
+        0x24d1bc02ef122137ull, 0x1cccbc17267d6573ull, 0x54ebbc297dcca9bfull, 0x6cf6bc3cb4a3edfbull,
+        0x8d06c450148b7249ull, 0xb51bc445dde4360dull, 0xfd3cc47b8655fac1ull, 0xc521c46e4f3abe85ull,
+        0x6d72c40731366359ull, 0x556fc412f859271dull, 0x1d48c42ca3e8ebd1ull, 0x2555c4396a87af95ull,
+        0x66b7e2ad0766c302ull, 0x5eaae2b8ce098746ull, 0x168de28695b84b8aull, 0x2e90e2935cd70fceull,
+        0x86c3e2fa22dbd212ull, 0xbedee2efebb49656ull, 0xf6f9e2d1b0055a9aull, 0xcee4e2c4796a1edeull,
+        0x713daff96bc783b4ull, 0x4920afeca2a8c7f0ull, 0x0107afd2f9190b3cull, 0x391aafc730764f78ull,
+        0x9149afae4e7a92a4ull, 0xa954afbb8715d6e0ull, 0xe173af85dca41a2cull, 0xd96eaf9015cb5e68ull,
+        0x9a8c8904782a32ffull, 0xa2918911b14576bbull, 0xeab6892feaf4ba77ull, 0xd2ab893a239bfe33ull,
+        0x7af889535d9723efull, 0x42e5894694f867abull, 0x0ac28978cf49ab67ull, 0x32df896d0626ef23ull,
+        0x5e293551b28502d8ull, 0x663435447bea469cull, 0x2e13357a205b8a50ull, 0x160e356fe934ce14ull,
+        0xbe5d3506973813c8ull, 0x864035135e57578cull, 0xce67352d05e69b40ull, 0xf67a3538cc89df04ull,
+        0xb59813aca168b393ull, 0x8d8513b96807f7d7ull, 0xc5a2138733b63b1bull, 0xfdbf1392fad97f5full,
+        0x55ec13fb84d5a283ull, 0x6df113ee4dbae6c7ull, 0x25d613d0160b2a0bull, 0x1dcb13c5df646e4full,
+        0xa2125ef8cdc9f325ull, 0x9a0f5eed04a6b761ull, 0xd2285ed35f177badull, 0xea355ec696783fe9ull,
+        0x42665eafe874e235ull, 0x7a7b5eba211ba671ull, 0x325c5e847aaa6abdull, 0x0a415e91b3c52ef9ull,
+        0x49a37805de24426eull, 0x71be7810174b062aull, 0x3999782e4cfacae6ull, 0x0184783b85958ea2ull,
+        0xa9d77852fb99537eull, 0x91ca784732f6173aull, 0xd9ed78796947dbf6ull, 0xe1f0786ca0289fb2ull,
+        0x3154aef3718177f9ull, 0x0949aee6b8ee33bdull, 0x416eaed8e35fff71ull, 0x7973aecd2a30bb35ull,
+        0xd120aea4543c66e9ull, 0xe93daeb19d5322adull, 0xa11aae8fc6e2ee61ull, 0x9907ae9a0f8daa25ull,
+        0xdae5880e626cc6b2ull, 0xe2f8881bab0382f6ull, 0xaadf8825f0b24e3aull, 0x92c2883039dd0a7eull,
+        0x3a91885947d1d7a2ull, 0x028c884c8ebe93e6ull, 0x4aab8872d50f5f2aull, 0x72b688671c601b6eull,
+        0xcd6fc55a0ecd8604ull, 0xf572c54fc7a2c240ull, 0xbd55c5719c130e8cull, 0x8548c564557c4ac8ull,
+        0x2d1bc50d2b709714ull, 0x1506c518e21fd350ull, 0x5d21c526b9ae1f9cull, 0x653cc53370c15bd8ull,
+        0x26dee3a71d20374full, 0x1ec3e3b2d44f730bull, 0x56e4e38c8ffebfc7ull, 0x6ef9e3994691fb83ull,
+        0xc6aae3f0389d265full, 0xfeb7e3e5f1f2621bull, 0xb690e3dbaa43aed7ull, 0x8e8de3ce632cea93ull,
+        0xe27b5ff2d78f0768ull, 0xda665fe71ee0432cull, 0x92415fd945518fe0ull, 0xaa5c5fcc8c3ecba4ull,
+        0x020f5fa5f2321678ull, 0x3a125fb03b5d523cull, 0x72355f8e60ec9ef0ull, 0x4a285f9ba983dab4ull,
+        0x09ca790fc462b623ull, 0x31d7791a0d0df267ull, 0x79f0792456bc3eabull, 0x41ed79319fd37aefull,
+        0xe9be7958e1dfa733ull, 0xd1a3794d28b0e377ull, 0x9984797373012fbbull, 0xa1997966ba6e6bffull,
+        0x1e40345ba8c3f695ull, 0x265d344e61acb2d1ull, 0x6e7a34703a1d7e1dull, 0x56673465f3723a59ull,
+        0xfe34340c8d7ee785ull, 0xc62934194411a3c1ull, 0x8e0e34271fa06f0dull, 0xb6133432d6cf2b49ull,
+        0xf5f112a6bb2e47deull, 0xcdec12b37241039aull, 0x85cb128d29f0cf56ull, 0xbdd61298e09f8b12ull,
+        0x158512f19e9356ceull, 0x2d9812e457fc128aull, 0x65bf12da0c4dde46ull, 0x5da212cfc5229a02ull,
+        0xbc526aa3650a05b0ull, 0x844f6ab6ac6541f4ull, 0xcc686a88f7d48d38ull, 0xf4756a9d3ebbc97cull,
+        0x5c266af440b714a0ull, 0x643b6ae189d850e4ull, 0x2c1c6adfd2699c28ull, 0x14016aca1b06d86cull,
+        0x57e34c5e76e7b4fbull, 0x6ffe4c4bbf88f0bfull, 0x27d94c75e4393c73ull, 0x1fc44c602d567837ull,
+        0xb7974c09535aa5ebull, 0x8f8a4c1c9a35e1afull, 0xc7ad4c22c1842d63ull, 0xffb04c3708eb6927ull,
+        0x4069010a1a46f44dull, 0x7874011fd329b009ull, 0x3053012188987cc5ull, 0x084e013441f73881ull,
+        0xa01d015d3ffbe55dull, 0x98000148f694a119ull, 0xd0270176ad256dd5ull, 0xe83a0163644a2991ull,
+        0xabd827f709ab4506ull, 0x93c527e2c0c40142ull, 0xdbe227dc9b75cd8eull, 0xe3ff27c9521a89caull,
+        0x4bac27a02c165416ull, 0x73b127b5e5791052ull, 0x3b96278bbec8dc9eull, 0x038b279e77a798daull,
+        0x6f7d9ba2c3047521ull, 0x57609bb70a6b3165ull, 0x1f479b8951dafda9ull, 0x275a9b9c98b5b9edull,
+        0x8f099bf5e6b96431ull, 0xb7149be02fd62075ull, 0xff339bde7467ecb9ull, 0xc72e9bcbbd08a8fdull,
+        0x84ccbd5fd0e9c46aull, 0xbcd1bd4a1986802eull, 0xf4f6bd7442374ce2ull, 0xccebbd618b5808a6ull,
+        0x64b8bd08f554d57aull, 0x5ca5bd1d3c3b913eull, 0x1482bd23678a5df2ull, 0x2c9fbd36aee519b6ull,
+        0x9346f00bbc4884dcull, 0xab5bf01e7527c098ull, 0xe37cf0202e960c54ull, 0xdb61f035e7f94810ull,
+        0x7332f05c99f595ccull, 0x4b2ff049509ad188ull, 0x0308f0770b2b1d44ull, 0x3b15f062c2445900ull,
+        0x78f7d6f6afa53597ull, 0x40ead6e366ca71d3ull, 0x08cdd6dd3d7bbd1full, 0x30d0d6c8f414f95bull,
+        0x9883d6a18a182487ull, 0xa09ed6b4437760c3ull, 0xe8b9d68a18c6ac0full, 0xd0a4d69fd1a9e84bull,
+    },
+};
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u32 zpl__hash_load32(zpl_u8 const *s) {
+    return cast(zpl_u32)s[0] | cast(zpl_u32)s[1] << 8 | cast(zpl_u32)s[2] << 16 | cast(zpl_u32)s[3] << 24;
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__hash_load64(zpl_u8 const *s) {
+    return cast(zpl_u64)zpl__hash_load32(s) | cast(zpl_u64)zpl__hash_load32(s + 4) << 32;
+}
+
+/* both CRC32 variants are reflected, crc is the raw register without the initial and final inversion */
+zpl_internal zpl_u32 zpl__crc32_slice8(zpl_u32 const (*t)[256], zpl_u32 crc, zpl_u8 const *s, zpl_isize len) {
+    for (; len >= 8; s += 8, len -= 8) {
+        zpl_u32 lo = crc ^ zpl__hash_load32(s), hi = zpl__hash_load32(s + 4);
+        crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+    }
+    for (; len > 0; s++, len--) crc = (crc >> 8) ^ t[0][(crc ^ *s) & 0xff];
+    return crc;
+}
+
+zpl_internal zpl_u64 zpl__crc64_slice8(zpl_u64 crc, zpl_u8 const *s, zpl_isize len) {
+    zpl_u64 const (*t)[256] = zpl__crc64_table;
+    for (; len >= 8; s += 8, len -= 8) {
+        zpl_u64 v = crc ^ zpl__hash_load64(s);
+        crc = t[7][v & 0xff] ^ t[6][(v >> 8) & 0xff] ^ t[5][(v >> 16) & 0xff] ^ t[4][(v >> 24) & 0xff] ^
+              t[3][(v >> 32) & 0xff] ^ t[2][(v >> 40) & 0xff] ^ t[1][(v >> 48) & 0xff] ^ t[0][v >> 56];
+    }
+    for (; len > 0; s++, len--) crc = (crc >> 8) ^ t[0][(crc ^ *s) & 0xff];
+    return crc;
+}
+
+#if defined(ZPL__SIMD_AVX2)
+#    if defined(ZPL_COMPILER_MSVC)
+#        define ZPL__SIMD_TARGET_CRC
+#    else
+#        define ZPL__SIMD_TARGET_CRC __attribute__((target("sse4.2,pclmul")))
+#    endif
+
+/* fold constants x^(D+63) mod P and x^(D-1) mod P, bit-reflected, for D = 512 and D = 128 */
+zpl_global zpl_u64 const zpl__crc32_fold[4]  = { 0x653d982200000000ull, 0xcad38e8f00000000ull, 0x65673b4600000000ull, 0x9ba54c6f00000000ull };
+zpl_global zpl_u64 const zpl__crc32c_fold[4] = { 0x1c19243b00000000ull, 0x75bba45b00000000ull, 0x3743f7bd00000000ull, 0x3171d43000000000ull };
+zpl_global zpl_u64 const zpl__crc64_fold[4]  = { 0xaf86efb16d9ab4fbull, 0xf49784a634f014e4ull, 0xd9d7be7d505da32cull, 0x381d0015c96f4444ull };
+
+zpl_global zpl_i32 zpl__crc_hw = -1;
+
+/* SSE4.2 and PCLMULQDQ, only used while the SIMD level is not forced to scalar */
+zpl_internal zpl_b32 zpl__crc_hw_available(void) {
+    if (zpl_simd_level_get() == ZPL_SIMD_SCALAR) return false;
+    if (zpl__crc_hw < 0) {
+        zpl_u32 r[4] = {0};
+#    if defined(ZPL_COMPILER_MSVC)
+        __cpuid(cast(int *)r, 1);
+#    else
+        __get_cpuid(1, &r[0], &r[1], &r[2], &r[3]);
+#    endif
+        /* NOTE: racing callers store the same value */
+        zpl__crc_hw = (r[2] & ZPL_BIT(20)) && (r[2] & ZPL_BIT(1));
+    }
+    return zpl__crc_hw;
+}
+
+ZPL__SIMD_TARGET_CRC zpl_internal ZPL_ALWAYS_INLINE __m128i zpl__crc_fold(__m128i x, __m128i k, __m128i next) {
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), next);
+}
+
+/*
+ * Folds the input into a 16-byte remainder with the same CRC, four 128-bit lanes at a time and then one,
+ * see "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" by Gopal et al.
+ * The CRC of rem computed from a zero register continues over the unconsumed input. Needs len >= 64.
+ */
+ZPL__SIMD_TARGET_CRC zpl_internal zpl_isize zpl__crc_fold_pclmul(zpl_u8 *rem, zpl_u64 crc, zpl_u8 const *s, zpl_isize len, zpl_u64 const *k) {
+    __m128i k512 = _mm_set_epi64x(cast(long long)k[1], cast(long long)k[0]);
+    __m128i k128 = _mm_set_epi64x(cast(long long)k[3], cast(long long)k[2]);
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(cast(__m128i const *)s), _mm_cvtsi64_si128(cast(long long)crc));
+    __m128i x1 = _mm_loadu_si128(cast(__m128i const *)(s + 16));
+    __m128i x2 = _mm_loadu_si128(cast(__m128i const *)(s + 32));
+    __m128i x3 = _mm_loadu_si128(cast(__m128i const *)(s + 48));
+    zpl_isize i = 64;
+
+    for (; i + 64 <= len; i += 64) {
+        x0 = zpl__crc_fold(x0, k512, _mm_loadu_si128(cast(__m128i const *)(s + i)));
+        x1 = zpl__crc_fold(x1, k512, _mm_loadu_si128(cast(__m128i const *)(s + i + 16)));
+        x2 = zpl__crc_fold(x2, k512, _mm_loadu_si128(cast(__m128i const *)(s + i + 32)));
+        x3 = zpl__crc_fold(x3, k512, _mm_loadu_si128(cast(__m128i const *)(s + i + 48)));
+    }
+    x0 = zpl__crc_fold(x0, k128, x1);
+    x0 = zpl__crc_fold(x0, k128, x2);
+    x0 = zpl__crc_fold(x0, k128, x3);
+    for (; i + 16 <= len; i += 16) {
+        x0 = zpl__crc_fold(x0, k128, _mm_loadu_si128(cast(__m128i const *)(s + i)));
+    }
+    _mm_storeu_si128(cast(__m128i *)rem, x0);
+    return i;
+}
+
+ZPL__SIMD_TARGET_CRC zpl_internal zpl_u32 zpl__crc32c_sse42(zpl_u32 crc, zpl_u8 const *s, zpl_isize len) {
+    zpl_u64 c;
+    zpl_u8 rem[16];
+    if (len >= 512) {
+        zpl_isize n = zpl__crc_fold_pclmul(rem, crc, s, len, zpl__crc32c_fold);
+        crc = cast(zpl_u32)_mm_crc32_u64(_mm_crc32_u64(0, zpl__hash_load64(rem)), zpl__hash_load64(rem + 8));
+        s += n, len -= n;
+    }
+    for (c = crc; len >= 8; s += 8, len -= 8) c = _mm_crc32_u64(c, zpl__hash_load64(s));
+    for (crc = cast(zpl_u32)c; len > 0; s++, len--) crc = _mm_crc32_u8(crc, *s);
+    return crc;
+}
+#elif defined(__ARM_FEATURE_CRC32) && !defined(ZPL_DISABLE_SIMD)
+#    define ZPL__CRC_ARM
+#    include <arm_acle.h>
+#endif
+
+zpl_internal zpl_u32 zpl__crc32_raw(zpl_u32 crc, zpl_u8 const *s, zpl_isize len) {
+#if defined(ZPL__SIMD_AVX2)
+    if (len >= 128 && zpl__crc_hw_available()) {
+        zpl_u8 rem[16];
+        zpl_isize n = zpl__crc_fold_pclmul(rem, crc, s, len, zpl__crc32_fold);
+        crc = zpl__crc32_slice8(zpl__crc32_table, 0, rem, 16);
+        s += n, len -= n;
+    }
+#elif defined(ZPL__CRC_ARM)
+    if (zpl_simd_level_get() != ZPL_SIMD_SCALAR) {
+        for (; len >= 8; s += 8, len -= 8) crc = __crc32d(crc, zpl__hash_load64(s));
+        for (; len > 0; s++, len--) crc = __crc32b(crc, *s);
+    }
+#endif
+    return zpl__crc32_slice8(zpl__crc32_table, crc, s, len);
+}
+
+zpl_internal zpl_u32 zpl__crc32c_raw(zpl_u32 crc, zpl_u8 const *s, zpl_isize len) {
+#if defined(ZPL__SIMD_AVX2)
+    if (zpl__crc_hw_available()) return zpl__crc32c_sse42(crc, s, len);
+#elif defined(ZPL__CRC_ARM)
+    if (zpl_simd_level_get() != ZPL_SIMD_SCALAR) {
+        for (; len >= 8; s += 8, len -= 8) crc = __crc32cd(crc, zpl__hash_load64(s));
+        for (; len > 0; s++, len--) crc = __crc32cb(crc, *s);
+    }
+#endif
+    return zpl__crc32_slice8(zpl__crc32c_table, crc, s, len);
+}
+
+zpl_internal zpl_u64 zpl__crc64_raw(zpl_u64 crc, zpl_u8 const *s, zpl_isize len) {
+#if defined(ZPL__SIMD_AVX2)
+    if (len >= 128 && zpl__crc_hw_available()) {
+        zpl_u8 rem[16];
+        zpl_isize n = zpl__crc_fold_pclmul(rem, crc, s, len, zpl__crc64_fold);
+        crc = zpl__crc64_slice8(0, rem, 16);
+        s += n, len -= n;
+    }
+#endif
+    return zpl__crc64_slice8(crc, s, len);
+}
+
 zpl_u32 zpl_crc32(void const *data, zpl_isize len) {
-    zpl_isize remaining;
-    zpl_u32 result = ~(cast(zpl_u32) 0);
-    zpl_u8 const *c = cast(zpl_u8 const *) data;
-    for (remaining = len; remaining--; c++) result = (result >> 8) ^ (zpl__crc32_table[(result ^ *c) & 0xff]);
-    return ~result;
+    return zpl_crc32_update(0, data, len);
+}
+
+zpl_u32 zpl_crc32_update(zpl_u32 crc, void const *data, zpl_isize len) {
+    return ~zpl__crc32_raw(~crc, cast(zpl_u8 const *) data, len);
+}
+
+zpl_u32 zpl_crc32c(void const *data, zpl_isize len) {
+    return zpl_crc32c_update(0, data, len);
+}
+
+zpl_u32 zpl_crc32c_update(zpl_u32 crc, void const *data, zpl_isize len) {
+    return ~zpl__crc32c_raw(~crc, cast(zpl_u8 const *) data, len);
 }
 
 zpl_u64 zpl_crc64(void const *data, zpl_isize len) {
-    zpl_isize remaining;
-    zpl_u64 result = (cast(zpl_u64)0);
-    zpl_u8 const *c = cast(zpl_u8 const *) data;
-    for (remaining = len; remaining--; c++) result = (result >> 8) ^ (zpl__crc64_table[(result ^ *c) & 0xff]);
-    return result;
+    return zpl_crc64_update(0, data, len);
+}
+
+zpl_u64 zpl_crc64_update(zpl_u64 crc, void const *data, zpl_isize len) {
+    return zpl__crc64_raw(crc, cast(zpl_u8 const *) data, len);
 }
 
 zpl_u32 zpl_fnv32(void const *data, zpl_isize len) {
@@ -173,154 +1337,341 @@ zpl_u64 zpl_fnv64a(void const *data, zpl_isize len) {
     return h;
 }
 
-// base64 implementation based on https://nachtimwald.com/2017/11/18/base64-encode-and-decode-in-c/
-//
-zpl_global zpl_u8 zpl__base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
-
-/* generated table based on: */
-#if 0
-void zpl__base64_decode_table() {
-    zpl_i32 inv[80];
-    zpl_isize i;
+/*
+ * base64 (RFC 4648). Both alphabets carry the tables of the scalar codec and of the vector ones, the
+ * AVX2 codec follows "Faster Base64 Encoding and Decoding Using AVX2 Instructions" by Muła and Lemire,
+ * NEON uses its 64-entry table lookups directly. SSE2 lacks a byte shuffle, so that level stays scalar.
+ */
+typedef struct zpl__base64_alphabet {
+    zpl_u8 chars[64];
+    zpl_u8 values[128]; // 6-bit value of each ASCII character, 0xff outside the alphabet
+
+    /* AVX2 */
+    zpl_i8 enc_shift[16];   // 6-bit value to character offset, indexed by the value range
+    zpl_u8 dec_lo[16];      // error classes by the low nibble of a character
+    zpl_u8 dec_hi[16];      // error class of each high nibble, a character is invalid if both share a bit
+    zpl_i8 dec_shift[16];   // character to 6-bit value offset, indexed by the high nibble
+    zpl_u8 dec_odd;         // character whose offset differs from the rest of its high nibble
+    zpl_u8 dec_odd_index;   // added to the high nibble of dec_odd to reach its own offset
+} zpl__base64_alphabet;
+
+zpl_global zpl__base64_alphabet const zpl__base64_alphabets[2] = {
+    {
+        { 'A','B','C','D','E','F','G','H','I','J','K','L','M','N','O','P','Q','R','S','T','U','V','W','X','Y','Z',
+          'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v','w','x','y','z',
+          '0','1','2','3','4','5','6','7','8','9','+','/' },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255, 255,  63,
+           52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 255, 255, 255,
+          255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+           15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255, 255,
+          255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+           41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255 },
+        { 'a'-26, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '+'-62, '/'-63, 'A', 0, 0 },
+        { 0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x15, 0x17, 0x17, 0x17, 0x15 },
+        { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+        { 0, 62-'+', 63-'/', 52-'0', -'A', -'A', 26-'a', 26-'a', 0, 0, 0, 0, 0, 0, 0, 0 },
+        '+', 0xff,
+    },
+    {
+        { 'A','B','C','D','E','F','G','H','I','J','K','L','M','N','O','P','Q','R','S','T','U','V','W','X','Y','Z',
+          'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v','w','x','y','z',
+          '0','1','2','3','4','5','6','7','8','9','-','_' },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255,
+           52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 255, 255, 255,
+          255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+           15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255,  63,
+          255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+           41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255 },
+        { 'a'-26, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '0'-52, '-'-62, '_'-63, 'A', 0, 0 },
+        { 0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x37, 0x37, 0x35, 0x37, 0x27 },
+        { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+        { 63-'_', 0, 62-'-', 52-'0', -'A', -'A', 26-'a', 26-'a', 0, 0, 0, 0, 0, 0, 0, 0 },
+        '_', 0xfb,
+    },
+};
 
-    zpl_memset(inv, -1, zpl_size_of(inv));
+#if defined(ZPL__SIMD_AVX2)
+/* 24 bytes into 32 characters per round, reads 4 bytes past each block */
+ZPL__SIMD_TARGET_AVX2 zpl_internal zpl_isize zpl__base64_encode_avx2(zpl_u8 *out, zpl_u8 const *s, zpl_isize len, zpl__base64_alphabet const *abc) {
+    __m256i const spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    __m256i const shift = _mm256_broadcastsi128_si256(_mm_loadu_si128(cast(__m128i const *)abc->enc_shift));
+    zpl_isize i = 0;
+    for (; i + 28 <= len; i += 24, out += 32) {
+        __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(cast(__m128i const *)(s + i))),
+                                            _mm_loadu_si128(cast(__m128i const *)(s + i + 12)), 1);
+        v = _mm256_shuffle_epi8(v, spread);
+
+        /* every 32-bit lane holds one group, the multiplies move its four 6-bit fields into separate bytes */
+        __m256i ac = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i bd = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i idx = _mm256_or_si256(ac, bd);
+
+        /* 0..25 select slot 13, 26..51 slot 0, 52..63 slots 1..12 */
+        __m256i slot = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+        slot = _mm256_or_si256(slot, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx), _mm256_set1_epi8(13)));
+        v = _mm256_add_epi8(idx, _mm256_shuffle_epi8(shift, slot));
+        _mm256_storeu_si256(cast(__m256i *)out, v);
+    }
+    return i;
+}
 
-    for (i=0; i < zpl_size_of(zpl__base64_chars)-1; i++) {
-        inv[zpl__base64_chars[i]-43] = i;
+/* 32 characters into 24 bytes per round, stops before the first block holding anything outside the alphabet */
+ZPL__SIMD_TARGET_AVX2 zpl_internal zpl_isize zpl__base64_decode_avx2(zpl_u8 *out, zpl_u8 const *s, zpl_isize len, zpl__base64_alphabet const *abc) {
+    __m256i const lut_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128(cast(__m128i const *)abc->dec_lo));
+    __m256i const lut_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128(cast(__m128i const *)abc->dec_hi));
+    __m256i const lut_shift = _mm256_broadcastsi128_si256(_mm_loadu_si128(cast(__m128i const *)abc->dec_shift));
+    __m256i const odd = _mm256_set1_epi8(cast(char)abc->dec_odd);
+    __m256i const odd_index = _mm256_set1_epi8(cast(char)abc->dec_odd_index);
+    __m256i const nibble = _mm256_set1_epi8(0x0f);
+    __m256i const pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    zpl_isize i = 0;
+    for (; i + 32 <= len; i += 32, out += 24) {
+        __m256i v = _mm256_loadu_si256(cast(__m256i const *)(s + i));
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi32(v, 4), nibble);
+        __m256i lo = _mm256_and_si256(v, nibble);
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo), _mm256_shuffle_epi8(lut_hi, hi))) break;
+
+        hi = _mm256_add_epi8(hi, _mm256_and_si256(_mm256_cmpeq_epi8(v, odd), odd_index));
+        v = _mm256_add_epi8(v, _mm256_shuffle_epi8(lut_shift, hi));
+
+        /* merge the 6-bit values pairwise, then the pairs, and drop the empty byte of every group and lane */
+        v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+        v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+        v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, pack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm_storeu_si128(cast(__m128i *)out, _mm256_castsi256_si128(v));
+        _mm_storel_epi64(cast(__m128i *)(out + 16), _mm256_extracti128_si256(v, 1));
     }
+    return i;
 }
 #endif
-/* === */
-zpl_global zpl_i32 zpl__base64_dec_table[] = {
-    62, -1, -1, -1, 63, 52, 53, 54, 55, 56, 57, 58,
-    59, 60, 61, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 4, 5,
-    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
-    21, 22, 23, 24, 25, -1, -1, -1, -1, -1, -1, 26, 27, 28,
-    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
-    43, 44, 45, 46, 47, 48, 49, 50, 51 };
-
-zpl_isize zpl__base64_encoded_size(zpl_isize len) {
-    zpl_isize ret = len;
 
-    if (len % 3 != 0) {
-        ret += 3 - (len % 3);
+#if defined(ZPL__SIMD_NEON)
+/* 48 bytes into 64 characters per round */
+zpl_internal zpl_isize zpl__base64_encode_neon(zpl_u8 *out, zpl_u8 const *s, zpl_isize len, zpl__base64_alphabet const *abc) {
+    uint8x16x4_t chars;
+    uint8x16_t const mask = vdupq_n_u8(0x3f);
+    zpl_isize i = 0;
+    chars.val[0] = vld1q_u8(abc->chars);
+    chars.val[1] = vld1q_u8(abc->chars + 16);
+    chars.val[2] = vld1q_u8(abc->chars + 32);
+    chars.val[3] = vld1q_u8(abc->chars + 48);
+    for (; i + 48 <= len; i += 48, out += 64) {
+        uint8x16x3_t in = vld3q_u8(s + i);
+        uint8x16x4_t r;
+        r.val[0] = vshrq_n_u8(in.val[0], 2);
+        r.val[1] = vandq_u8(vorrq_u8(vshrq_n_u8(in.val[1], 4), vshlq_n_u8(in.val[0], 4)), mask);
+        r.val[2] = vandq_u8(vorrq_u8(vshrq_n_u8(in.val[2], 6), vshlq_n_u8(in.val[1], 2)), mask);
+        r.val[3] = vandq_u8(in.val[2], mask);
+        r.val[0] = vqtbl4q_u8(chars, r.val[0]);
+        r.val[1] = vqtbl4q_u8(chars, r.val[1]);
+        r.val[2] = vqtbl4q_u8(chars, r.val[2]);
+        r.val[3] = vqtbl4q_u8(chars, r.val[3]);
+        vst4q_u8(out, r);
     }
+    return i;
+}
 
-    ret /= 3;
-    ret *= 4;
-
-    return ret;
+/* 64 characters into 48 bytes per round, stops before the first block holding anything outside the alphabet */
+zpl_internal zpl_isize zpl__base64_decode_neon(zpl_u8 *out, zpl_u8 const *s, zpl_isize len, zpl__base64_alphabet const *abc) {
+    uint8x16x4_t lo, hi;
+    uint8x16_t const upper = vdupq_n_u8(0x40);
+    zpl_isize i = 0, k;
+    for (k = 0; k < 4; k++) {
+        lo.val[k] = vld1q_u8(abc->values + k * 16);
+        hi.val[k] = vld1q_u8(abc->values + 64 + k * 16);
+    }
+    for (; i + 64 <= len; i += 64, out += 48) {
+        uint8x16x4_t in = vld4q_u8(s + i);
+        uint8x16x3_t r;
+        uint8x16_t v[4], err = vdupq_n_u8(0);
+        for (k = 0; k < 4; k++) {
+            /* 0..63 come from the first table, 64..127 from the second, anything above keeps its top bit in err */
+            v[k] = vqtbx4q_u8(vqtbl4q_u8(lo, in.val[k]), hi, veorq_u8(in.val[k], upper));
+            err = vorrq_u8(err, vorrq_u8(v[k], in.val[k]));
+        }
+        if (vmaxvq_u8(err) & 0x80) break;
+        r.val[0] = vorrq_u8(vshlq_n_u8(v[0], 2), vshrq_n_u8(v[1], 4));
+        r.val[1] = vorrq_u8(vshlq_n_u8(v[1], 4), vshrq_n_u8(v[2], 2));
+        r.val[2] = vorrq_u8(vshlq_n_u8(v[2], 6), v[3]);
+        vst3q_u8(out, r);
+    }
+    return i;
 }
+#endif
 
-zpl_isize zpl__base64_decoded_size(void const *data) {
-    zpl_isize len, ret, i;
-    const zpl_u8 *s = cast(const zpl_u8 *)data;
+/* bytes consumed by the vector codec of the active SIMD level, a multiple of 3 */
+zpl_internal zpl_isize zpl__base64_encode_bulk(zpl_u8 *out, zpl_u8 const *s, zpl_isize len, zpl__base64_alphabet const *abc) {
+    if (len < 64) return 0;
+    switch (zpl_simd_level_get()) {
+#if defined(ZPL__SIMD_AVX2)
+        case ZPL_SIMD_AVX2: return zpl__base64_encode_avx2(out, s, len, abc);
+#endif
+#if defined(ZPL__SIMD_NEON)
+        case ZPL_SIMD_NEON: return zpl__base64_encode_neon(out, s, len, abc);
+#endif
+        default: return 0;
+    }
+}
 
-    if (s == NULL) {
-        return 0;
+/* characters consumed by the vector codec of the active SIMD level, a multiple of 4 */
+zpl_internal zpl_isize zpl__base64_decode_bulk(zpl_u8 *out, zpl_u8 const *s, zpl_isize len, zpl__base64_alphabet const *abc) {
+    if (len < 64) return 0;
+    switch (zpl_simd_level_get()) {
+#if defined(ZPL__SIMD_AVX2)
+        case ZPL_SIMD_AVX2: return zpl__base64_decode_avx2(out, s, len, abc);
+#endif
+#if defined(ZPL__SIMD_NEON)
+        case ZPL_SIMD_NEON: return zpl__base64_decode_neon(out, s, len, abc);
+#endif
+        default: return 0;
     }
+}
 
-    len = zpl_strlen(cast(const char*)s);
-    ret = len / 4 * 3;
+zpl_isize zpl_base64_encode_to(void *out, void const *data, zpl_isize len, zpl_u32 flags) {
+    zpl__base64_alphabet const *abc = &zpl__base64_alphabets[(flags & ZPL_BASE64_URL) ? 1 : 0];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u8 *o = cast(zpl_u8 *) out;
+    zpl_isize i = zpl__base64_encode_bulk(o, s, len, abc);
+    zpl_u32 v;
+
+    o += i / 3 * 4;
+    for (; i + 3 <= len; i += 3, o += 4) {
+        v = cast(zpl_u32)s[i] << 16 | cast(zpl_u32)s[i+1] << 8 | s[i+2];
+        o[0] = abc->chars[v >> 18];
+        o[1] = abc->chars[(v >> 12) & 0x3f];
+        o[2] = abc->chars[(v >> 6) & 0x3f];
+        o[3] = abc->chars[v & 0x3f];
+    }
 
-    for (i=len; i-- > 0;) {
-        if (s[i] == '=') {
-            ret--;
-        } else {
-            break;
+    if (i < len) {
+        v = cast(zpl_u32)s[i] << 16 | (i + 1 < len ? cast(zpl_u32)s[i+1] << 8 : 0);
+        *o++ = abc->chars[v >> 18];
+        *o++ = abc->chars[(v >> 12) & 0x3f];
+        if (i + 1 < len) *o++ = abc->chars[(v >> 6) & 0x3f];
+        if (!(flags & ZPL_BASE64_NO_PAD)) {
+            if (i + 1 >= len) *o++ = '=';
+            *o++ = '=';
         }
     }
 
-    return ret;
+    return o - cast(zpl_u8 *) out;
 }
 
-zpl_b32 zpl__base64_valid_char(zpl_u8 c) {
-    if (c >= '0' && c <= '9')
-        return true;
-    if (c >= 'A' && c <= 'Z')
-        return true;
-    if (c >= 'a' && c <= 'z')
-        return true;
-    if (c == '+' || c == '/' || c == '=')
-        return true;
+zpl_isize zpl_base64_decode_to(void *out, void const *data, zpl_isize len, zpl_u32 flags) {
+    zpl__base64_alphabet const *abc = &zpl__base64_alphabets[(flags & ZPL_BASE64_URL) ? 1 : 0];
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u8 *o = cast(zpl_u8 *) out;
+    zpl_isize i, pad = 0, rem;
+    zpl_u32 a, b, c, d;
+
+    while (pad < 2 && len > pad && s[len - pad - 1] == '=') pad++;
+    len -= pad;
+    rem = len % 4;
+    if (rem == 1 || (pad && (len + pad) % 4 != 0)) return -1;
+
+#define zpl__base64_value(ch) (abc->values[(ch) & 0x7f] | ((ch) & 0x80))
+
+    i = zpl__base64_decode_bulk(o, s, len - rem, abc);
+    o += i / 4 * 3;
+    for (; i + 4 <= len; i += 4, o += 3) {
+        a = zpl__base64_value(s[i]), b = zpl__base64_value(s[i+1]);
+        c = zpl__base64_value(s[i+2]), d = zpl__base64_value(s[i+3]);
+        if ((a | b | c | d) & 0x80) return -1;
+        a = a << 18 | b << 12 | c << 6 | d;
+        o[0] = cast(zpl_u8)(a >> 16);
+        o[1] = cast(zpl_u8)(a >> 8);
+        o[2] = cast(zpl_u8)a;
+    }
 
-    return false;
+    if (rem) {
+        a = zpl__base64_value(s[i]), b = zpl__base64_value(s[i+1]);
+        c = rem == 3 ? zpl__base64_value(s[i+2]) : 0;
+        if ((a | b | c) & 0x80) return -1;
+        a = a << 18 | b << 12 | c << 6;
+        *o++ = cast(zpl_u8)(a >> 16);
+        if (rem == 3) *o++ = cast(zpl_u8)(a >> 8);
+    }
+
+#undef zpl__base64_value
+
+    return o - cast(zpl_u8 *) out;
 }
 
 zpl_u8 *zpl_base64_encode(zpl_allocator a, void const *data, zpl_isize len) {
-    const zpl_u8 *s = cast(const zpl_u8*)data;
-    zpl_u8 *ret = NULL;
-    zpl_isize enc_len, i, j, v;
+    zpl_u8 *ret;
+    zpl_isize enc_len;
 
     if (data == NULL || len == 0) {
         return NULL;
     }
 
-    enc_len = zpl__base64_encoded_size(len);
+    enc_len = zpl_base64_encoded_len(len, 0);
     ret = cast(zpl_u8 *)zpl_alloc(a, enc_len+1);
-    ret[enc_len] = 0;
-
-    for (i=0, j=0; i < len; i+=3, j+=4) {
-        v = s[i];
-        v = (i+1 < len) ? (v << 8 | s[i+1]) : (v << 8);
-        v = (i+2 < len) ? (v << 8 | s[i+2]) : (v << 8);
-
-        ret[j] = zpl__base64_chars[(v >> 18) & 0x3F];
-        ret[j+1] = zpl__base64_chars[(v >> 12) & 0x3F];
-
-        if (i+1 < len)
-            ret[j+2] = zpl__base64_chars[(v >> 6) & 0x3F];
-
-        else ret[j+2] = '=';
-
-        if (i+2 < len)
-            ret[j+3] = zpl__base64_chars[v & 0x3F];
-
-        else ret[j+3] = '=';
-
-    }
+    ZPL_ASSERT_NOT_NULL(ret);
 
+    zpl_base64_encode_to(ret, data, len, 0);
+    ret[enc_len] = 0;
     return ret;
 }
 
 zpl_u8 *zpl_base64_decode(zpl_allocator a, void const *data, zpl_isize len) {
-    const zpl_u8 *s = cast(const zpl_u8*)data;
-    zpl_u8 *ret = NULL;
-    zpl_isize alen, i, j, v;
+    zpl_u8 *ret;
+    zpl_isize dec_len;
 
     if (data == NULL) {
         return NULL;
     }
 
-    alen = zpl__base64_decoded_size(s);
-    ret = cast(zpl_u8 *)zpl_alloc(a, alen+1);
-
+    ret = cast(zpl_u8 *)zpl_alloc(a, zpl_base64_decoded_len(len)+1);
     ZPL_ASSERT_NOT_NULL(ret);
 
-    ret[alen] = 0;
-
-    for (i=0; i<len; i++) {
-        if (!zpl__base64_valid_char(s[i]))
-            return NULL;
+    dec_len = zpl_base64_decode_to(ret, data, len, 0);
+    if (dec_len < 0) {
+        zpl_free(a, ret);
+        return NULL;
     }
 
-    for (i=0, j=0; i<len; i+=4, j+=3) {
-        v = zpl__base64_dec_table[s[i]-43];
-        v = (v << 6) | zpl__base64_dec_table[s[i+1]-43];
-        v = (s[i+2] == '=') ? (v << 6) : ((v << 6) | zpl__base64_dec_table[s[i+2]-43]);
-        v = (s[i+3] == '=') ? (v << 6) : ((v << 6) | zpl__base64_dec_table[s[i+3]-43]);
+    ret[dec_len] = 0;
+    return ret;
+}
 
-        ret[j] = (v >> 16) & 0xFF;
+void zpl_base64_stream_init(zpl_base64_stream *stream, zpl_u32 flags) {
+    zpl_zero_item(stream);
+    stream->flags = flags;
+}
 
-        if (s[i+2] != '=')
-            ret[j+1] = (v >> 8) & 0xFF;
+zpl_isize zpl_base64_stream_encode(zpl_base64_stream *stream, void *out, void const *data, zpl_isize len) {
+    zpl_u8 const *s = cast(zpl_u8 const *) data;
+    zpl_u8 *o = cast(zpl_u8 *) out;
+    zpl_isize full;
 
-        if (s[i+3] != '=')
-            ret[j+2] = v & 0xFF;
+    if (stream->tail_len) {
+        while (stream->tail_len < 3 && len > 0) {
+            stream->tail[stream->tail_len++] = *s++;
+            len--;
+        }
+        if (stream->tail_len < 3) return 0;
+        o += zpl_base64_encode_to(o, stream->tail, 3, stream->flags);
+        stream->tail_len = 0;
     }
 
-    return ret;
+    full = len - len % 3;
+    o += zpl_base64_encode_to(o, s, full, stream->flags);
+    for (; full < len; full++) stream->tail[stream->tail_len++] = s[full];
+
+    return o - cast(zpl_u8 *) out;
+}
+
+zpl_isize zpl_base64_stream_finish(zpl_base64_stream *stream, void *out) {
+    zpl_isize written = zpl_base64_encode_to(out, stream->tail, stream->tail_len, stream->flags);
+    stream->tail_len = 0;
+    return written;
 }
 
 zpl_u32 zpl_murmur32_seed(void const *data, zpl_isize len, zpl_u32 seed) {
@@ -407,4 +1758,205 @@ zpl_u64 zpl_murmur64_seed(void const *data_, zpl_isize len, zpl_u64 seed) {
     return h;
 }
 
+/* 64x64->128-bit product, a receives the low and b the high half */
+zpl_internal ZPL_ALWAYS_INLINE void zpl__hash_mum(zpl_u64 *a, zpl_u64 *b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = cast(unsigned __int128) *a * *b;
+    *a = cast(zpl_u64) r;
+    *b = cast(zpl_u64)(r >> 64);
+#elif defined(ZPL_COMPILER_MSVC) && defined(_M_X64)
+    *a = _umul128(*a, *b, b);
+#else
+    zpl_u64 a_lo = *a & 0xffffffff, a_hi = *a >> 32;
+    zpl_u64 b_lo = *b & 0xffffffff, b_hi = *b >> 32;
+    zpl_u64 ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    zpl_u64 mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+    *b = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    *a = (mid << 32) | (ll & 0xffffffff);
+#endif
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__hash_mix(zpl_u64 a, zpl_u64 b) {
+    zpl__hash_mum(&a, &b);
+    return a ^ b;
+}
+
+/* wyhash's secrets followed by the first half of zpl_hash_key_init(0x7a706c2068617368) */
+zpl_global zpl_u64 const zpl__hash_secret[8] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull,
+    0x472796f074964ee1ull, 0x5c4b56c32e1b958dull, 0x6556ac69874d1db1ull, 0x724d2b33179ce299ull,
+};
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__hash_init(zpl_u64 seed, zpl_u64 const *secret) {
+    return seed ^ zpl__hash_mix(seed ^ secret[0], secret[1]);
+}
+
+zpl_internal ZPL_ALWAYS_INLINE void zpl__hash_block(zpl_u64 *lane, zpl_u8 const *p, zpl_u64 const *secret) {
+    lane[0] = zpl__hash_mix(zpl__hash_load64(p) ^ secret[1], zpl__hash_load64(p + 8) ^ lane[0]);
+    lane[1] = zpl__hash_mix(zpl__hash_load64(p + 16) ^ secret[2], zpl__hash_load64(p + 24) ^ lane[1]);
+    lane[2] = zpl__hash_mix(zpl__hash_load64(p + 32) ^ secret[3], zpl__hash_load64(p + 40) ^ lane[2]);
+}
+
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__hash_finish(zpl_u64 a, zpl_u64 b, zpl_u64 seed, zpl_u64 len, zpl_u64 const *secret) {
+    a ^= secret[1];
+    b ^= seed;
+    zpl__hash_mum(&a, &b);
+    return zpl__hash_mix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
+/* up to 16 bytes, read as two overlapping halves */
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__hash_short(zpl_u8 const *p, zpl_isize len, zpl_u64 seed, zpl_u64 const *secret) {
+    zpl_u64 a = 0, b = 0;
+    if (len >= 4) {
+        zpl_isize half = (len >> 3) << 2;
+        a = cast(zpl_u64)zpl__hash_load32(p) << 32 | zpl__hash_load32(p + half);
+        b = cast(zpl_u64)zpl__hash_load32(p + len - 4) << 32 | zpl__hash_load32(p + len - 4 - half);
+    } else if (len > 0) {
+        a = cast(zpl_u64)p[0] << 16 | cast(zpl_u64)p[len >> 1] << 8 | p[len - 1];
+    }
+    return zpl__hash_finish(a, b, seed, len, secret);
+}
+
+/* after the 48-byte blocks, the last 16 bytes end at p + i and may overlap the last block */
+zpl_internal ZPL_ALWAYS_INLINE zpl_u64 zpl__hash_tail(zpl_u8 const *p, zpl_isize i, zpl_u64 seed, zpl_u64 len, zpl_u64 const *secret) {
+    for (; i > 16; p += 16, i -= 16) seed = zpl__hash_mix(zpl__hash_load64(p) ^ secret[1], zpl__hash_load64(p + 8) ^ seed);
+    return zpl__hash_finish(zpl__hash_load64(p + i - 16), zpl__hash_load64(p + i - 8), seed, len, secret);
+}
+
+zpl_internal zpl_u64 zpl__hash64(zpl_u8 const *p, zpl_isize len, zpl_u64 seed, zpl_u64 const *secret) {
+    zpl_isize i = len;
+    seed = zpl__hash_init(seed, secret);
+    if (len <= 16) return zpl__hash_short(p, len, seed, secret);
+
+    if (i >= 48) {
+        zpl_u64 lane[3];
+        lane[0] = lane[1] = lane[2] = seed;
+        do {
+            zpl__hash_block(lane, p, secret);
+            p += 48, i -= 48;
+        } while (i >= 48);
+        seed = lane[0] ^ lane[1] ^ lane[2];
+    }
+    return zpl__hash_tail(p, i, seed, len, secret);
+}
+
+zpl_u64 zpl_hash64_seed(void const *data, zpl_isize len, zpl_u64 seed) {
+    return zpl__hash64(cast(zpl_u8 const *) data, len, seed, zpl__hash_secret);
+}
+
+zpl_u64 zpl_hash64_keyed(void const *data, zpl_isize len, zpl_hash_key const *key) {
+    return zpl__hash64(cast(zpl_u8 const *) data, len, key->seed, key->secret);
+}
+
+zpl_hash128 zpl_hash128_seed(void const *data, zpl_isize len, zpl_u64 seed) {
+    zpl_hash128 h;
+    h.lo = zpl__hash64(cast(zpl_u8 const *) data, len, seed, zpl__hash_secret);
+    h.hi = zpl__hash64(cast(zpl_u8 const *) data, len, seed, zpl__hash_secret + 4);
+    return h;
+}
+
+zpl_hash128 zpl_hash128_keyed(void const *data, zpl_isize len, zpl_hash_key const *key) {
+    zpl_hash128 h;
+    h.lo = zpl__hash64(cast(zpl_u8 const *) data, len, key->seed, key->secret);
+    h.hi = zpl__hash64(cast(zpl_u8 const *) data, len, key->seed, key->secret + 4);
+    return h;
+}
+
+/* wyrand */
+zpl_internal zpl_u64 zpl__hash_rand(zpl_u64 *state) {
+    *state += 0xa0761d6478bd642full;
+    return zpl__hash_mix(*state, *state ^ 0xe7037ed1a0b428dbull);
+}
+
+zpl_internal zpl_i32 zpl__hash_popcount(zpl_u64 x) {
+    x -= (x >> 1) & 0x5555555555555555ull;
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return cast(zpl_i32)((x * 0x0101010101010101ull) >> 56);
+}
+
+/* the 70 bytes with four bits set */
+zpl_global zpl_u8 const zpl__hash_balanced[70] = {
+    15,  23,  27,  29,  30,  39,  43,  45,  46,  51,  53,  54,  57,  58,  60,  71,  75,  77,  78,  83,  85,  86,  89,  90,
+    92,  99,  101, 102, 105, 106, 108, 113, 114, 116, 120, 135, 139, 141, 142, 147, 149, 150, 153, 154, 156, 163, 165, 166,
+    169, 170, 172, 177, 178, 180, 184, 195, 197, 198, 201, 202, 204, 209, 210, 212, 216, 225, 226, 228, 232, 240,
+};
+
+void zpl_hash_key_init(zpl_hash_key *key, zpl_u64 random) {
+    zpl_isize i, j, k;
+    ZPL_ASSERT_NOT_NULL(key);
+
+    /* odd secrets with balanced bytes, each one differs from the others of its half in exactly 32 bits */
+    for (i = 0; i < 8; i++) {
+        zpl_b32 ok;
+        do {
+            zpl_u64 s = 0;
+            for (j = 0; j < 64; j += 8) s |= cast(zpl_u64)zpl__hash_balanced[zpl__hash_rand(&random) % 70] << j;
+            ok = cast(zpl_b32)(s & 1);
+            for (k = i & ~3; ok && k < i; k++) ok = zpl__hash_popcount(key->secret[k] ^ s) == 32;
+            key->secret[i] = s;
+        } while (!ok);
+    }
+    key->seed = zpl__hash_rand(&random);
+}
+
+zpl_internal void zpl__hash_state_init(zpl_hash_state *state, zpl_u64 seed, zpl_u64 const *secret) {
+    ZPL_ASSERT_NOT_NULL(state);
+    zpl_memcopy(state->secret, secret, zpl_size_of(state->secret));
+    state->lane[0] = state->lane[1] = state->lane[2] = zpl__hash_init(seed, secret);
+    state->len = 0;
+}
+
+void zpl_hash_state_init(zpl_hash_state *state, zpl_u64 seed) {
+    zpl__hash_state_init(state, seed, zpl__hash_secret);
+}
+
+void zpl_hash_state_init_keyed(zpl_hash_state *state, zpl_hash_key const *key) {
+    zpl__hash_state_init(state, key->seed, key->secret);
+}
+
+void zpl_hash_state_update(zpl_hash_state *state, void const *data, zpl_isize len) {
+    zpl_u8 const *p = cast(zpl_u8 const *) data;
+    zpl_isize used = cast(zpl_isize)(state->len % 48);
+    zpl_u64 lane[3];
+
+    state->len += len;
+    if (used) {
+        zpl_isize take = zpl_min(48 - used, len);
+        zpl_memcopy(state->buf + used, p, take);
+        if (used + take < 48) return;
+        p += take, len -= take;
+        zpl__hash_block(state->lane, state->buf, state->secret);
+        zpl_memcopy(state->last, state->buf + 32, 16);
+    }
+
+    if (len >= 48) {
+        zpl_memcopy(lane, state->lane, zpl_size_of(lane));
+        do {
+            zpl__hash_block(lane, p, state->secret);
+            p += 48, len -= 48;
+        } while (len >= 48);
+        zpl_memcopy(state->lane, lane, zpl_size_of(lane));
+        zpl_memcopy(state->last, p - 16, 16);
+    }
+    zpl_memcopy(state->buf, p, len);
+}
+
+zpl_u64 zpl_hash_state_digest(zpl_hash_state const *state) {
+    zpl_isize i = cast(zpl_isize)(state->len % 48);
+    zpl_u8 const *p = state->buf;
+    zpl_u8 window[32];
+
+    if (state->len <= 16) return zpl__hash_short(p, i, state->lane[0], state->secret);
+    if (state->len < 48) return zpl__hash_tail(p, i, state->lane[0], state->len, state->secret);
+
+    if (i < 16) {
+        /* the final 16 bytes reach back into the last consumed block */
+        zpl_memcopy(window, state->last, 16);
+        zpl_memcopy(window + 16, p, i);
+        p = window + i, i = 16;
+    }
+    return zpl__hash_tail(p, i, state->lane[0] ^ state->lane[1] ^ state->lane[2], state->len, state->secret);
+}
+
 ZPL_END_C_DECLS
@@ -0,0 +1,497 @@
+// file: source/log.c
+
+///////////////////////////////////////////////////////////////
+//
+// Asynchronous logger
+//
+
+ZPL_BEGIN_C_DECLS
+
+ZPL_STATIC_ASSERT((ZPL_LOG_RING_SIZE & (ZPL_LOG_RING_SIZE - 1)) == 0, "ZPL_LOG_RING_SIZE must be a power of two");
+
+/* single producer, single consumer byte ring, both positions only ever grow */
+typedef struct zpl__log_ring {
+    zpl_atomic64 head; // written by the owning thread
+    zpl_u8       pad0[64 - zpl_size_of(zpl_atomic64)];
+    zpl_atomic64 tail; // written by the flusher
+    zpl_u8       pad1[64 - zpl_size_of(zpl_atomic64)];
+    void        *owner;
+    zpl_u8      *data;
+} zpl__log_ring;
+
+enum {
+    ZPL__LOG_RECORD,
+    ZPL__LOG_PADDING, // skips to the start of the ring, only size and kind are valid
+};
+
+/* followed by the captured arguments in spec order, each 8-byte aligned:
+   the resolved format info for specs with '*' widths or precisions, then the value,
+   %s strings are stored as their length and the copied text */
+typedef struct {
+    zpl_u32       size;
+    zpl_u32       kind;
+    zpl_log_site *site;
+    zpl_u64       time;
+} zpl__log_record;
+
+typedef struct {
+    zpl_logger *logger;
+    char       *text;
+    zpl_isize   len;
+    zpl_u64     second;
+    char        stamp[32]; // "YYYY-MM-DD hh:mm:ss.mmm "
+} zpl__log_writer;
+
+typedef struct {
+    zpl_logger    *logger;
+    zpl_u32        id;
+    zpl__log_ring *ring;
+} zpl__log_cache;
+
+zpl_global zpl_thread_local zpl__log_cache zpl__log_tls;
+zpl_global zpl_atomic32 zpl__log_next_id;
+zpl_global zpl_atomic32 zpl__log_compile_lock;
+
+zpl_global char const zpl__log_level_names[ZPL_LOG_LEVEL_OFF + 1][7] = {
+    "TRACE ", "DEBUG ", "INFO  ", "WARN  ", "ERROR ", "FATAL ", "OFF   ",
+};
+
+#define ZPL__LOG_ALIGN(x) (((x) + 7) & ~cast(zpl_isize)7)
+#define ZPL__LOG_STAR_ARGS (ZPL_FMT_WIDTH_ARG | ZPL_FMT_PRECISION_ARG)
+
+char const *zpl_log_level_name(zpl_log_level level) {
+    switch (level) {
+        case ZPL_LOG_LEVEL_TRACE: return "TRACE";
+        case ZPL_LOG_LEVEL_DEBUG: return "DEBUG";
+        case ZPL_LOG_LEVEL_INFO:  return "INFO";
+        case ZPL_LOG_LEVEL_WARN:  return "WARN";
+        case ZPL_LOG_LEVEL_ERROR: return "ERROR";
+        case ZPL_LOG_LEVEL_FATAL: return "FATAL";
+        default: return "OFF";
+    }
+}
+
+zpl_internal void zpl__log_write_out(zpl__log_writer *w) {
+    if (w->len == 0) return;
+    zpl_file_write(w->logger->file, w->text, w->len);
+    zpl_atomic64_fetch_add(&w->logger->bytes, w->len);
+    zpl_atomic64_fetch_add(&w->logger->writes, 1);
+    w->len = 0;
+}
+
+zpl_internal char const *zpl__log_stamp(zpl__log_writer *w, zpl_u64 time) {
+    zpl_u64 ms = zpl_time_win32_to_unix(time);
+    zpl_u64 second = ms / 1000;
+
+    if (second != w->second) {
+        // NOTE: Civil date from the days since the epoch, http://howardhinnant.github.io/date_algorithms.html
+        zpl_u64 z = second / 86400 + 719468, rem = second % 86400;
+        zpl_u64 era = z / 146097, doe = z - era * 146097;
+        zpl_u64 yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        zpl_u64 doy = doe - (365 * yoe + yoe / 4 - yoe / 100), mp = (5 * doy + 2) / 153;
+        zpl_u64 day = doy - (153 * mp + 2) / 5 + 1, month = mp < 10 ? mp + 3 : mp - 9;
+        zpl_u64 year = yoe + era * 400 + (month <= 2);
+
+        zpl_snprintf(w->stamp, zpl_size_of(w->stamp), "%04d-%02d-%02d %02d:%02d:%02d.000 ", cast(int)year, cast(int)month,
+                     cast(int)day, cast(int)(rem / 3600), cast(int)(rem / 60 % 60), cast(int)(rem % 60));
+        w->second = second;
+    }
+
+    ms %= 1000;
+    w->stamp[20] = cast(char)('0' + ms / 100);
+    w->stamp[21] = cast(char)('0' + ms / 10 % 10);
+    w->stamp[22] = cast(char)('0' + ms % 10);
+    return w->stamp;
+}
+
+/* formats one record followed by a line break, -1 if it doesn't fit */
+zpl_internal zpl_isize zpl__log_format(zpl__log_writer *w, zpl__log_record const *rec, char *text, zpl_isize max_len) {
+    zpl_log_site const *site = rec->site;
+    zpl_fmt const *plan = &site->plan;
+    zpl_u8 const *payload = cast(zpl_u8 const *)(rec + 1);
+    zpl_u32 flags = w->logger->flags;
+    char const *begin = text;
+    zpl_isize remaining = max_len, i;
+
+    if (max_len <= 0) return -1;
+
+    if (flags & ZPL_LOG_TIMESTAMP) {
+        if (!zpl__fmt_literal(&text, &remaining, zpl__log_stamp(w, rec->time), 24)) return -1;
+    }
+    if (flags & ZPL_LOG_LEVEL_NAME) {
+        if (!zpl__fmt_literal(&text, &remaining, zpl__log_level_names[site->level], 6)) return -1;
+    }
+    if (flags & ZPL_LOG_LOCATION) {
+        char line[24];
+        zpl_isize len = zpl__u64_to_dec(line + 1, cast(zpl_u64)site->line);
+        line[0] = ':';
+        line[len + 1] = ':';
+        line[len + 2] = ' ';
+        if (!zpl__fmt_literal(&text, &remaining, site->file, zpl_strlen(site->file))) return -1;
+        if (!zpl__fmt_literal(&text, &remaining, line, len + 3)) return -1;
+    }
+
+    for (i = 0; i < plan->count; i++) {
+        zpl_fmt_spec const *spec = plan->specs + i;
+        zpl__format_info info;
+        zpl__fmt_value value;
+        zpl_isize len;
+
+        if (!zpl__fmt_literal(&text, &remaining, plan->text + spec->literal_offset, spec->literal_len)) return -1;
+
+        if (spec->flags & ZPL__LOG_STAR_ARGS) {
+            zpl_memcopy(&info, payload, zpl_size_of(info));
+            payload += ZPL__LOG_ALIGN(zpl_size_of(info));
+        } else {
+            info.base = spec->base;
+            info.flags = spec->flags;
+            info.width = spec->width;
+            info.precision = spec->precision;
+        }
+
+        value.u = 0;
+        switch (spec->conv) {
+            case 0: case '%': break;
+
+            case 's': {
+                zpl_u32 slen;
+                zpl_memcopy(&slen, payload, zpl_size_of(slen));
+                payload += 8;
+                if (slen != ZPL_U32_MAX) {
+                    value.s = cast(char const *)payload;
+                    payload += ZPL__LOG_ALIGN(cast(zpl_isize)slen + 1);
+                } else {
+                    value.s = NULL;
+                }
+            } break;
+
+            default: {
+                zpl_memcopy(&value, payload, zpl_size_of(value));
+                payload += 8;
+            } break;
+        }
+
+        len = zpl__fmt_print(text, remaining, &info, spec->conv, value);
+        if (len >= remaining) return -1;
+        text += len;
+        remaining -= len;
+    }
+
+    if (!zpl__fmt_literal(&text, &remaining, plan->text + plan->tail_offset, plan->tail_len)) return -1;
+    *text++ = '\n';
+    return text - begin;
+}
+
+zpl_internal void zpl__log_emit(zpl__log_writer *w, zpl__log_record const *rec) {
+    zpl_isize len = zpl__log_format(w, rec, w->text + w->len, ZPL_LOG_BATCH_SIZE - w->len);
+
+    if (len < 0 && w->len > 0) {
+        zpl__log_write_out(w);
+        len = zpl__log_format(w, rec, w->text, ZPL_LOG_BATCH_SIZE);
+    }
+    if (len < 0) {
+        // NOTE: Longer than the whole batch, the line is cut short
+        len = ZPL_LOG_BATCH_SIZE;
+        w->text[len - 1] = '\n';
+    }
+
+    w->len += len;
+    zpl_atomic64_fetch_add(&w->logger->records, 1);
+}
+
+zpl_internal zpl_isize zpl__log_drain(zpl__log_writer *w) {
+    zpl_logger *logger = w->logger;
+    zpl_i32 count = zpl_atomic32_load(&logger->ring_count), i;
+    zpl_isize records = 0;
+
+    for (i = 0; i < count; i++) {
+        zpl__log_ring *ring = logger->rings[i];
+        zpl_i64 tail = zpl_atomic64_load(&ring->tail);
+        zpl_i64 head = zpl_atomic64_load(&ring->head);
+
+        while (tail < head) {
+            zpl__log_record const *rec = cast(zpl__log_record const *)(ring->data + (tail & (ZPL_LOG_RING_SIZE - 1)));
+            if (rec->kind == ZPL__LOG_RECORD) {
+                zpl__log_emit(w, rec);
+                records++;
+            }
+            tail += rec->size;
+            zpl_atomic64_store(&ring->tail, tail);
+        }
+    }
+
+    return records;
+}
+
+zpl_internal zpl_isize zpl__log_flusher(struct zpl_thread *thread) {
+    zpl_logger *logger = cast(zpl_logger *)thread->user_data;
+    zpl__log_writer w = { 0 };
+    w.logger = logger;
+    w.text = logger->batch;
+    w.second = ZPL_U64_MAX;
+
+    for (;;) {
+        // NOTE: Read before draining, so whatever was logged ahead of a flush request or shutdown is picked up
+        zpl_i64 requested = zpl_atomic64_load(&logger->flush_requested);
+        zpl_b32 running = zpl_atomic32_load(&logger->running);
+        zpl_isize records = zpl__log_drain(&w);
+
+        zpl__log_write_out(&w);
+        zpl_atomic64_store(&logger->flush_done, requested);
+
+        if (!running) break;
+        if (records == 0) zpl_sleep_ms(ZPL_LOG_IDLE_MS);
+    }
+
+    return 0;
+}
+
+zpl_internal zpl__log_ring *zpl__log_ring_get(zpl_logger *logger) {
+    zpl__log_ring *ring = NULL;
+    void *owner = &zpl__log_tls;
+    zpl_i32 count, i;
+
+    if (zpl__log_tls.logger == logger && zpl__log_tls.id == logger->id) return zpl__log_tls.ring;
+
+    zpl_mutex_lock(&logger->lock);
+    count = zpl_atomic32_load(&logger->ring_count);
+    for (i = 0; i < count; i++) {
+        if (logger->rings[i]->owner == owner) {
+            ring = logger->rings[i];
+            break;
+        }
+    }
+    if (!ring && count < ZPL_LOG_MAX_THREADS) {
+        ring = cast(zpl__log_ring *)zpl_alloc_align(logger->alloc, zpl_size_of(zpl__log_ring), 64);
+        zpl_zero_item(ring);
+        ring->owner = owner;
+        ring->data = cast(zpl_u8 *)zpl_alloc_align(logger->alloc, ZPL_LOG_RING_SIZE, 64);
+        logger->rings[count] = ring;
+        zpl_atomic32_store(&logger->ring_count, count + 1);
+    }
+    zpl_mutex_unlock(&logger->lock);
+
+    if (ring) {
+        zpl__log_tls.logger = logger;
+        zpl__log_tls.id = logger->id;
+        zpl__log_tls.ring = ring;
+    }
+    return ring;
+}
+
+zpl_internal zpl_b32 zpl__log_site_ready(zpl_log_site *site, char const *fmt) {
+    zpl_i32 state = zpl_atomic32_load(&site->state);
+    if (state == 0) {
+        zpl_atomic32_spin_lock(&zpl__log_compile_lock, -1);
+        state = zpl_atomic32_load(&site->state);
+        if (state == 0) {
+            state = zpl_fmt_compile(&site->plan, fmt) ? 1 : 2;
+            zpl_atomic32_store(&site->state, state);
+        }
+        zpl_atomic32_spin_unlock(&zpl__log_compile_lock);
+    }
+    // NOTE: the plan was compiled from the first format seen on this site and still points into it
+    return state == 1 && site->plan.text == fmt;
+}
+
+/* returns space for size bytes in the ring, waits for the flusher with ZPL_LOG_BLOCK */
+zpl_internal zpl_u8 *zpl__log_reserve(zpl_logger *logger, zpl__log_ring *ring, zpl_i64 size, zpl_i64 *next) {
+    zpl_i64 head = zpl_atomic64_load(&ring->head);
+    zpl_i64 offset = head & (ZPL_LOG_RING_SIZE - 1);
+    zpl_i64 pad = (offset + size > ZPL_LOG_RING_SIZE) ? ZPL_LOG_RING_SIZE - offset : 0;
+    zpl_b32 waited = false;
+
+    while (head + pad + size - zpl_atomic64_load(&ring->tail) > ZPL_LOG_RING_SIZE) {
+        if (!(logger->flags & ZPL_LOG_BLOCK) || !zpl_atomic32_load(&logger->running)) return NULL;
+        if (!waited) {
+            zpl_atomic64_fetch_add(&logger->blocked, 1);
+            waited = true;
+        }
+        zpl_yield();
+    }
+
+    if (pad) {
+        zpl__log_record *marker = cast(zpl__log_record *)(ring->data + offset);
+        marker->size = cast(zpl_u32)pad;
+        marker->kind = ZPL__LOG_PADDING;
+        head += pad;
+        offset = 0;
+    }
+
+    *next = head + size;
+    return ring->data + offset;
+}
+
+zpl_b32 zpl_log_write_va(zpl_logger *logger, zpl_log_site *site, char const *fmt, va_list va) {
+    zpl__format_info infos[ZPL_FMT_MAX_SPECS];
+    zpl__fmt_value values[ZPL_FMT_MAX_SPECS];
+    zpl_isize lens[ZPL_FMT_MAX_SPECS];
+    zpl_isize size = zpl_size_of(zpl__log_record), i;
+    zpl__log_record *rec;
+    zpl__log_ring *ring;
+    zpl_u8 *payload;
+    zpl_i64 next;
+    va_list args;
+
+    ZPL_ASSERT_NOT_NULL(logger);
+    ZPL_ASSERT_NOT_NULL(site);
+    if (site->level < zpl_atomic32_load(&logger->level)) return false;
+
+    ring = zpl__log_ring_get(logger);
+    if (!ring || !zpl__log_site_ready(site, fmt)) {
+        zpl_atomic64_fetch_add(&logger->dropped, 1);
+        return false;
+    }
+
+    va_copy(args, va);
+    for (i = 0; i < site->plan.count; i++) {
+        zpl_fmt_spec const *spec = site->plan.specs + i;
+        zpl__format_info info;
+        info.base = spec->base;
+        info.flags = spec->flags;
+        info.width = spec->width;
+        info.precision = spec->precision;
+
+        values[i] = zpl__fmt_fetch(&info, spec->conv, &args);
+        if (spec->flags & ZPL__LOG_STAR_ARGS) {
+            infos[i] = info;
+            size += ZPL__LOG_ALIGN(zpl_size_of(info));
+        }
+
+        switch (spec->conv) {
+            case 0: case '%': break;
+
+            case 's': {
+                size += 8;
+                if (values[i].s) {
+                    lens[i] = (info.precision >= 0) ? zpl_strnlen(values[i].s, info.precision) : zpl_strlen(values[i].s);
+                    size += ZPL__LOG_ALIGN(lens[i] + 1);
+                } else {
+                    lens[i] = -1;
+                }
+            } break;
+
+            default: size += 8; break;
+        }
+    }
+    va_end(args);
+
+    // NOTE: Records taking up more than a quarter of the ring would stall it for everything else
+    payload = (size <= ZPL_LOG_RING_SIZE / 4) ? zpl__log_reserve(logger, ring, size, &next) : NULL;
+    if (!payload) {
+        zpl_atomic64_fetch_add(&logger->dropped, 1);
+        return false;
+    }
+
+    rec = cast(zpl__log_record *)payload;
+    rec->size = cast(zpl_u32)size;
+    rec->kind = ZPL__LOG_RECORD;
+    rec->site = site;
+    rec->time = (logger->flags & ZPL_LOG_TIMESTAMP) ? zpl_time_utc_ms() : 0;
+    payload += zpl_size_of(zpl__log_record);
+
+    for (i = 0; i < site->plan.count; i++) {
+        zpl_fmt_spec const *spec = site->plan.specs + i;
+
+        if (spec->flags & ZPL__LOG_STAR_ARGS) {
+            zpl_memcopy(payload, infos + i, zpl_size_of(infos[i]));
+            payload += ZPL__LOG_ALIGN(zpl_size_of(infos[i]));
+        }
+
+        switch (spec->conv) {
+            case 0: case '%': break;
+
+            case 's': {
+                zpl_u32 slen = (lens[i] < 0) ? ZPL_U32_MAX : cast(zpl_u32)lens[i];
+                zpl_memcopy(payload, &slen, zpl_size_of(slen));
+                payload += 8;
+                if (lens[i] >= 0) {
+                    zpl_memcopy(payload, values[i].s, lens[i]);
+                    payload[lens[i]] = '\0';
+                    payload += ZPL__LOG_ALIGN(lens[i] + 1);
+                }
+            } break;
+
+            default: {
+                zpl_memcopy(payload, values + i, zpl_size_of(values[i]));
+                payload += 8;
+            } break;
+        }
+    }
+
+    zpl_atomic64_store(&ring->head, next);
+    return true;
+}
+
+zpl_b32 zpl_log_write(zpl_logger *logger, zpl_log_site *site, char const *fmt, ...) {
+    zpl_b32 res;
+    va_list va;
+    va_start(va, fmt);
+    res = zpl_log_write_va(logger, site, fmt, va);
+    va_end(va);
+    return res;
+}
+
+void zpl_logger_init(zpl_logger *logger, zpl_allocator a, zpl_file *file, zpl_u32 flags) {
+    ZPL_ASSERT_NOT_NULL(logger);
+    ZPL_ASSERT_NOT_NULL(file);
+    zpl_zero_item(logger);
+
+    logger->alloc = a;
+    logger->file = file;
+    logger->flags = flags;
+    logger->id = cast(zpl_u32)zpl_atomic32_fetch_add(&zpl__log_next_id, 1) + 1;
+    logger->batch = cast(char *)zpl_alloc(a, ZPL_LOG_BATCH_SIZE);
+    zpl_atomic32_store(&logger->level, ZPL_LOG_LEVEL_TRACE);
+    zpl_atomic32_store(&logger->running, 1);
+    zpl_mutex_init(&logger->lock);
+
+    zpl_thread_init(&logger->flusher);
+    zpl_thread_start(&logger->flusher, zpl__log_flusher, logger);
+}
+
+void zpl_logger_free(zpl_logger *logger) {
+    zpl_i32 count, i;
+    ZPL_ASSERT_NOT_NULL(logger);
+
+    zpl_atomic32_store(&logger->running, 0);
+    zpl_thread_destroy(&logger->flusher);
+
+    count = zpl_atomic32_load(&logger->ring_count);
+    for (i = 0; i < count; i++) {
+        zpl_free(logger->alloc, logger->rings[i]->data);
+        zpl_free(logger->alloc, logger->rings[i]);
+    }
+    zpl_free(logger->alloc, logger->batch);
+    zpl_mutex_destroy(&logger->lock);
+}
+
+void zpl_logger_flush(zpl_logger *logger) {
+    zpl_i64 target;
+    ZPL_ASSERT_NOT_NULL(logger);
+
+    target = zpl_atomic64_fetch_add(&logger->flush_requested, 1) + 1;
+    while (zpl_atomic64_load(&logger->flush_done) < target) {
+        zpl_yield();
+    }
+}
+
+void zpl_logger_set_level(zpl_logger *logger, zpl_log_level level) {
+    ZPL_ASSERT_NOT_NULL(logger);
+    zpl_atomic32_store(&logger->level, level);
+}
+
+void zpl_logger_stats(zpl_logger *logger, zpl_log_stats *stats) {
+    ZPL_ASSERT_NOT_NULL(logger);
+    ZPL_ASSERT_NOT_NULL(stats);
+    stats->records = zpl_atomic64_load(&logger->records);
+    stats->dropped = zpl_atomic64_load(&logger->dropped);
+    stats->blocked = zpl_atomic64_load(&logger->blocked);
+    stats->bytes = zpl_atomic64_load(&logger->bytes);
+    stats->writes = zpl_atomic64_load(&logger->writes);
+}
+
+#undef ZPL__LOG_ALIGN
+#undef ZPL__LOG_STAR_ARGS
+
+ZPL_END_C_DECLS
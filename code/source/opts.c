@@ -23,7 +23,7 @@ void zpl_opts_free(zpl_opts *opts) {
     for (zpl_i32 i = 0; i < zpl_array_count(opts->entries); ++i) {
         zpl_opts_entry *e = opts->entries + i;
         if (e->type == ZPL_OPTS_STRING) {
-            zpl_string_free(e->text);
+            zpl_string_sso_free(&e->text);
         }
     }
 
@@ -45,7 +45,7 @@ void zpl_opts_add(zpl_opts *opts, char const *name, char const *lname, const cha
     zpl_array_append(opts->entries, e);
 }
 
-zpl_opts_entry *zpl__opts_find(zpl_opts *opts, char const *name, zpl_usize len, zpl_b32 longname) {
+zpl_opts_entry *zpl__opts_find(zpl_opts *opts, zpl_strview name, zpl_b32 longname) {
     zpl_opts_entry *e = 0;
 
     for (int i = 0; i < zpl_array_count(opts->entries); ++i) {
@@ -53,14 +53,14 @@ zpl_opts_entry *zpl__opts_find(zpl_opts *opts, char const *name, zpl_usize len,
         char const *n = (longname ? e->lname : e->name);
         if(!n) continue;
 
-        if (zpl_strnlen(name, len) == zpl_strlen(n) && !zpl_strncmp(n, name, len)) { return e; }
+        if (zpl_strview_equals_cstr(name, n)) { return e; }
     }
 
     return NULL;
 }
 
 void zpl_opts_positional_add(zpl_opts *opts, char const *name) {
-    zpl_opts_entry *e = zpl__opts_find(opts, name, zpl_strlen(name), true);
+    zpl_opts_entry *e = zpl__opts_find(opts, zpl_strview_from_cstr(name), true);
 
     if (e) {
         e->pos = true;
@@ -71,19 +71,19 @@ void zpl_opts_positional_add(zpl_opts *opts, char const *name) {
 zpl_b32 zpl_opts_positionals_filled(zpl_opts *opts) { return zpl_array_count(opts->positioned) == 0; }
 
 zpl_string zpl_opts_string(zpl_opts *opts, char const *name, char const *fallback) {
-    zpl_opts_entry *e = zpl__opts_find(opts, name, zpl_strlen(name), true);
+    zpl_opts_entry *e = zpl__opts_find(opts, zpl_strview_from_cstr(name), true);
 
-    return (char *)((e && e->met) ? e->text : fallback);
+    return (char *)((e && e->met) ? zpl_string_sso_cstr(&e->text) : fallback);
 }
 
 zpl_f64 zpl_opts_real(zpl_opts *opts, char const *name, zpl_f64 fallback) {
-    zpl_opts_entry *e = zpl__opts_find(opts, name, zpl_strlen(name), true);
+    zpl_opts_entry *e = zpl__opts_find(opts, zpl_strview_from_cstr(name), true);
 
     return (e && e->met) ? e->real : fallback;
 }
 
 zpl_i64 zpl_opts_integer(zpl_opts *opts, char const *name, zpl_i64 fallback) {
-    zpl_opts_entry *e = zpl__opts_find(opts, name, zpl_strlen(name), true);
+    zpl_opts_entry *e = zpl__opts_find(opts, zpl_strview_from_cstr(name), true);
 
     return (e && e->met) ? e->integer : fallback;
 }
@@ -93,7 +93,7 @@ void zpl__opts_set_value(zpl_opts *opts, zpl_opts_entry *t, char *b) {
 
     switch (t->type) {
         case ZPL_OPTS_STRING: {
-            t->text = zpl_string_make(opts->alloc, b);
+            zpl_string_sso_set(&t->text, opts->alloc, zpl_strview_from_cstr(b));
         } break;
 
         case ZPL_OPTS_FLOAT: {
@@ -114,7 +114,7 @@ void zpl__opts_set_value(zpl_opts *opts, zpl_opts_entry *t, char *b) {
 }
 
 zpl_b32 zpl_opts_has_arg(zpl_opts *opts, char const *name) {
-    zpl_opts_entry *e = zpl__opts_find(opts, name, zpl_strlen(name), true);
+    zpl_opts_entry *e = zpl__opts_find(opts, zpl_strview_from_cstr(name), true);
 
     if (e) { return e->met; }
 
@@ -188,7 +188,7 @@ zpl_b32 zpl_opts_compile(zpl_opts *opts, int argc, char **argv) {
 
                 while (zpl_char_is_alphanumeric(*e) || *e == '-' || *e == '_') { ++e; }
 
-                t = zpl__opts_find(opts, b, (e - b), checkln);
+                t = zpl__opts_find(opts, zpl_strview_make(b, e - b), checkln);
 
                 if (t) {
                     char *ob = b;
@@ -54,13 +54,13 @@ zpl_u8 zpl_csv_parse_delimiter(zpl_csv_object *root, char *text, zpl_allocator a
             
             /* unescape escaped quotes (so that unescaped text escapes :) */
             {
-                char *ep = b;
-                do {
-                    if (*ep == '"' && *(ep+1) == '"') {
-                        zpl_memmove(ep, ep+1, zpl_strlen(ep));
-                    }
-                    ep++;
-                } while (*ep);
+                /* every quote left in the literal is doubled, so drop one of each pair in a single pass */
+                char *rp = b, *wp = b;
+                while (rp < e) {
+                    if (*rp == '"') rp++;
+                    *wp++ = *rp++;
+                }
+                *wp = 0;
             }
         }
         else if (*p == delim) {
@@ -83,6 +83,8 @@ zpl_u8 zpl_csv_parse_delimiter(zpl_csv_object *root, char *text, zpl_allocator a
             else {
                 d = 0;
                 p = e;
+                while (zpl_char_is_space(*(e-1))) { e--; }
+                *e = 0;
             }
             
             /* check if number and process if so */
@@ -141,24 +143,412 @@ zpl_u8 zpl_csv_parse_delimiter(zpl_csv_object *root, char *text, zpl_allocator a
     
     return err;
 }
+#if defined(ZPL_MODULE_JOBS)
+typedef struct {
+    zpl_csv_object root;
+    char *text;
+    zpl_allocator allocator;
+    zpl_b32 has_header;
+    zpl_b32 empty;
+    char delim;
+    zpl_u8 err;
+} zpl__csv_chunk;
+
+zpl_internal void zpl__csv_parse_chunk(void *data) {
+    zpl__csv_chunk *chunk = cast(zpl__csv_chunk *)data;
+    if (*zpl_str_trim(chunk->text, false) == 0) {
+        chunk->empty = true;
+        return;
+    }
+    chunk->err = zpl_csv_parse_delimiter(&chunk->root, chunk->text, chunk->allocator, chunk->has_header, chunk->delim);
+}
+#endif
+
+zpl_u8 zpl_csv_parse_parallel(zpl_csv_object *root, char *text, zpl_allocator allocator, zpl_b32 has_header, char delim, zpl_u32 thread_count) {
+#if defined(ZPL_MODULE_JOBS)
+    ZPL_ASSERT_NOT_NULL(root);
+    ZPL_ASSERT_NOT_NULL(text);
+    text = cast(char *)zpl_str_trim(text, false);
+
+    if (thread_count == 0) {
+        zpl_affinity af;
+        zpl_affinity_init(&af);
+        thread_count = cast(zpl_u32)zpl_max(af.thread_count, 1);
+        zpl_affinity_destroy(&af);
+    }
+
+    zpl_isize len = zpl_strlen(text);
+    zpl_isize chunk_count = zpl_min(cast(zpl_isize)thread_count, len / ZPL_CSV_PARALLEL_MIN_CHUNK);
+    if (chunk_count < 2) {
+        return zpl_csv_parse_delimiter(root, text, allocator, has_header, delim);
+    }
+
+    zpl__csv_chunk *chunks = cast(zpl__csv_chunk *)zpl_alloc(zpl_heap(), chunk_count * zpl_size_of(zpl__csv_chunk));
+    zpl_zero_size(chunks, chunk_count * zpl_size_of(zpl__csv_chunk));
+
+    /* cut at the first newline past each target offset that lies outside of a quoted string */
+    {
+        zpl_isize n = 1, step = len / chunk_count;
+        zpl_b32 quoted = false;
+        char *target = text + step;
+        chunks[0].text = text;
+        for (char *p = text; *p && n < chunk_count; p++) {
+            if (*p == '"') {
+                quoted = !quoted;
+            }
+            else if (*p == '\n' && !quoted && p >= target) {
+                *p = 0;
+                chunks[n++].text = p + 1;
+                target = text + n * step;
+            }
+        }
+        chunk_count = n;
+    }
+
+    for (zpl_isize i = 0; i < chunk_count; i++) {
+        chunks[i].allocator = allocator;
+        chunks[i].has_header = (i == 0) ? has_header : false;
+        chunks[i].delim = delim;
+    }
+
+    /* the calling thread takes the first chunk while the pool handles the rest */
+    if (chunk_count > 1) {
+        zpl_jobs_system pool;
+        zpl_jobs_init_with_limit(&pool, zpl_heap(), cast(zpl_u32)(chunk_count - 1), cast(zpl_u32)chunk_count);
+        for (zpl_isize i = 1; i < chunk_count; i++) {
+            zpl_jobs_enqueue(&pool, zpl__csv_parse_chunk, chunks + i);
+        }
+        zpl_jobs_process(&pool);
+        zpl__csv_parse_chunk(chunks);
+        while (!zpl_jobs_done(&pool)) {
+            zpl_jobs_process(&pool);
+            zpl_yield();
+        }
+        zpl_jobs_free(&pool);
+    }
+    else {
+        zpl__csv_parse_chunk(chunks);
+    }
+
+    /* stitch the per-chunk columns onto the first chunk */
+    zpl_u8 err = chunks[0].err;
+    zpl_isize colc = err ? 0 : zpl_array_count(chunks[0].root.nodes);
+    for (zpl_isize i = 1; i < chunk_count && !err; i++) {
+        if (chunks[i].err) {
+            err = chunks[i].err;
+        }
+        else if (!chunks[i].empty && zpl_array_count(chunks[i].root.nodes) != colc) {
+            ZPL_CSV_ASSERT("mismatched rows");
+            err = ZPL_CSV_ERROR_MISMATCHED_ROWS;
+        }
+    }
+
+    if (!err) {
+        for (zpl_isize c = 0; c < colc; c++) {
+            zpl_csv_object *col = chunks[0].root.nodes + c;
+            zpl_isize total = zpl_array_count(col->nodes);
+            for (zpl_isize i = 1; i < chunk_count; i++) {
+                if (!chunks[i].empty) total += zpl_array_count(chunks[i].root.nodes[c].nodes);
+            }
+            zpl_array_reserve(col->nodes, total);
+            for (zpl_isize i = 1; i < chunk_count; i++) {
+                if (chunks[i].empty) continue;
+                zpl_csv_object *other = chunks[i].root.nodes + c;
+                zpl_array_appendv(col->nodes, other->nodes, zpl_array_count(other->nodes));
+            }
+        }
+    }
+
+    *root = chunks[0].root;
+    if (root->nodes) {
+        for (zpl_isize c = 0; c < zpl_array_count(root->nodes); c++) {
+            root->nodes[c].parent = root;
+        }
+    }
+
+    for (zpl_isize i = 1; i < chunk_count; i++) {
+        if (!chunks[i].empty) zpl_adt_destroy_branch(&chunks[i].root);
+    }
+    zpl_free(zpl_heap(), chunks);
+    return err;
+#else
+    zpl_unused(thread_count);
+    return zpl_csv_parse_delimiter(root, text, allocator, has_header, delim);
+#endif
+}
+
+typedef struct {
+    char const *begin, *end;
+    zpl_b32 quoted;
+} zpl__csv_field;
+
+typedef struct {
+    zpl_u8 type;
+    zpl_b32 has_empty;
+    zpl_isize header_size; // bytes of the column name
+    zpl_isize string_size; // bytes of the cells, only kept if the column ends up as strings
+} zpl__csv_column_info;
+
+/* scans one field without modifying the text, returns NULL on an unterminated quoted string */
+zpl_internal char const *zpl__csv_scan_field(char const *p, char delim, zpl__csv_field *f, char *term) {
+    while (*p != delim && *p != '\n' && zpl_char_is_space(*p)) p++;
+
+    if (*p == '"') {
+        f->quoted = true;
+        f->begin = ++p;
+        for (;;) {
+            while (*p && *p != '"') p++;
+            if (*p == 0) return NULL;
+            if (p[1] != '"') break;
+            p += 2;
+        }
+        f->end = p++;
+        while (*p && *p != delim && *p != '\n') p++;
+    }
+    else {
+        f->quoted = false;
+        f->begin = p;
+        while (*p && *p != delim && *p != '\n') p++;
+        f->end = p;
+        while (f->end > f->begin && zpl_char_is_space(f->end[-1])) f->end--;
+    }
+
+    *term = *p;
+    if (*p) p++;
+    return p;
+}
+
+zpl_internal zpl_u8 zpl__csv_classify(zpl__csv_field *f) {
+    if (f->quoted) return ZPL_CSV_COLUMN_STRING;
+    if (f->begin == f->end) return ZPL_CSV_COLUMN_EMPTY;
+
+    char const *p = f->begin, *digits;
+    if (*p == '+' || *p == '-') p++;
+    digits = p;
+    while (p < f->end && zpl_char_is_digit(*p)) p++;
+
+    /* 18 digits always fit, longer integers are kept as reals */
+    if (p == f->end && p > digits && (p - digits) <= 18) return ZPL_CSV_COLUMN_INTEGER;
+    if (p == digits && !(*p == '.' && p + 1 < f->end && zpl_char_is_digit(p[1]))) return ZPL_CSV_COLUMN_STRING;
+
+    char *end;
+    zpl_str_to_f64(f->begin, &end);
+    return (end == f->end) ? ZPL_CSV_COLUMN_REAL : ZPL_CSV_COLUMN_STRING;
+}
+
+zpl_internal zpl_i64 zpl__csv_field_to_i64(zpl__csv_field *f) {
+    char const *p = f->begin;
+    zpl_b32 neg = (*p == '-');
+    zpl_i64 value = 0;
+    if (*p == '+' || *p == '-') p++;
+    for (; p < f->end; p++) value = value * 10 + (*p - '0');
+    return neg ? -value : value;
+}
+
+zpl_internal zpl_isize zpl__csv_copy_field(char *dest, zpl__csv_field *f) {
+    char const *p = f->begin;
+    char *w = dest;
+    if (f->quoted) {
+        while (p < f->end) {
+            if (*p == '"') p++;
+            *w++ = *p++;
+        }
+    }
+    else {
+        zpl_memcopy(w, p, f->end - p);
+        w += f->end - p;
+    }
+    *w++ = 0;
+    return w - dest;
+}
+
+/* first pass (fill = false) infers column types and sizes, second pass stores the cells */
+zpl_internal zpl_u8 zpl__csv_table_pass(zpl_csv_table *table, zpl__csv_column_info *info, char const *text, zpl_b32 has_header, char delim, zpl_b32 fill) {
+    char const *p = text;
+    zpl_isize row = has_header ? -1 : 0, heap_offset = 1;
+
+    for (;;) {
+        zpl_isize col = 0;
+        char term;
+        while (*p && *p != delim && zpl_char_is_space(*p)) p++;
+        if (*p == 0) break;
+
+        do {
+            zpl__csv_field f;
+            p = zpl__csv_scan_field(p, delim, &f, &term);
+            if (!p) {
+                ZPL_CSV_ASSERT("unmatched quoted string");
+                return ZPL_CSV_ERROR_UNEXPECTED_END_OF_INPUT;
+            }
+            if (col >= table->column_count) {
+                ZPL_CSV_ASSERT("mismatched rows");
+                return ZPL_CSV_ERROR_MISMATCHED_ROWS;
+            }
+
+            if (row < 0) {
+                if (fill) {
+                    table->columns[col].name = table->strings + heap_offset;
+                    heap_offset += zpl__csv_copy_field(table->strings + heap_offset, &f);
+                }
+                else {
+                    info[col].header_size += (f.end - f.begin) + 1;
+                }
+            }
+            else if (!fill) {
+                zpl_u8 type = zpl__csv_classify(&f);
+                if (type == ZPL_CSV_COLUMN_EMPTY) {
+                    info[col].has_empty = true;
+                }
+                else {
+                    if (type > info[col].type) info[col].type = type;
+                    info[col].string_size += (f.end - f.begin) + 1;
+                }
+            }
+            else {
+                zpl_csv_column *c = table->columns + col;
+                if (!f.quoted && f.begin == f.end) {
+                    if (c->empty) c->empty[row >> 3] |= cast(zpl_u8)(1 << (row & 7));
+                }
+                else switch (c->type) {
+                    case ZPL_CSV_COLUMN_INTEGER: {
+                        c->integers[row] = zpl__csv_field_to_i64(&f);
+                    } break;
+                    case ZPL_CSV_COLUMN_REAL: {
+                        c->reals[row] = zpl_str_to_f64(f.begin, NULL);
+                    } break;
+                    case ZPL_CSV_COLUMN_STRING: {
+                        c->strings[row] = heap_offset;
+                        heap_offset += zpl__csv_copy_field(table->strings + heap_offset, &f);
+                    } break;
+                }
+            }
+            col++;
+        } while (term == delim);
+
+        if (col != table->column_count) {
+            ZPL_CSV_ASSERT("mismatched rows");
+            return ZPL_CSV_ERROR_MISMATCHED_ROWS;
+        }
+        row++;
+    }
+
+    if (!fill) table->row_count = zpl_max(row, 0);
+    return ZPL_CSV_ERROR_NONE;
+}
+
+zpl_u8 zpl_csv_parse_table(zpl_csv_table *table, char const *text, zpl_allocator allocator, zpl_b32 has_header, char delim) {
+    ZPL_ASSERT_NOT_NULL(table);
+    ZPL_ASSERT_NOT_NULL(text);
+    zpl_zero_item(table);
+    table->allocator = allocator;
+
+    /* the first row defines the number of columns */
+    {
+        char const *p = text;
+        char term;
+        while (*p && *p != delim && zpl_char_is_space(*p)) p++;
+        if (*p == 0) {
+            ZPL_CSV_ASSERT("unexpected end of input. stream is empty.");
+            return ZPL_CSV_ERROR_UNEXPECTED_END_OF_INPUT;
+        }
+        do {
+            zpl__csv_field f;
+            p = zpl__csv_scan_field(p, delim, &f, &term);
+            if (!p) {
+                ZPL_CSV_ASSERT("unmatched quoted string");
+                return ZPL_CSV_ERROR_UNEXPECTED_END_OF_INPUT;
+            }
+            table->column_count++;
+        } while (term == delim);
+    }
+
+    zpl__csv_column_info *info = cast(zpl__csv_column_info *)zpl_alloc(allocator, table->column_count * zpl_size_of(zpl__csv_column_info));
+    if (!info) return ZPL_CSV_ERROR_OUT_OF_MEMORY;
+    zpl_zero_size(info, table->column_count * zpl_size_of(zpl__csv_column_info));
+
+    zpl_u8 err = zpl__csv_table_pass(table, info, text, has_header, delim, false);
+    if (err) {
+        zpl_free(allocator, info);
+        table->column_count = 0;
+        return err;
+    }
+
+    /* header names always live in the heap, cells only for string columns */
+    zpl_isize column_count = table->column_count;
+    table->column_count = 0;
+    table->strings_size = 1;
+    for (zpl_isize i = 0; i < column_count; i++) {
+        table->strings_size += info[i].header_size;
+        if (info[i].type == ZPL_CSV_COLUMN_STRING) table->strings_size += info[i].string_size;
+    }
+
+    table->columns = cast(zpl_csv_column *)zpl_alloc(allocator, column_count * zpl_size_of(zpl_csv_column));
+    table->strings = cast(char *)zpl_alloc(allocator, table->strings_size);
+    zpl_b32 ok = (table->columns && table->strings);
+
+    if (ok) {
+        zpl_zero_size(table->columns, column_count * zpl_size_of(zpl_csv_column));
+        table->strings[0] = 0;
+        table->column_count = column_count;
+    }
+
+    for (zpl_isize i = 0; ok && i < column_count; i++) {
+        zpl_csv_column *c = table->columns + i;
+        zpl_isize rows = table->row_count;
+        c->name = "";
+        c->type = info[i].type;
+        if (c->type != ZPL_CSV_COLUMN_EMPTY && rows > 0) {
+            /* zero-filled so empty cells read back as 0 or "" */
+            c->integers = cast(zpl_i64 *)zpl_alloc(allocator, rows * zpl_size_of(zpl_i64));
+            ok = (c->integers != NULL);
+            if (ok) zpl_zero_size(c->integers, rows * zpl_size_of(zpl_i64));
+        }
+        if (ok && c->type != ZPL_CSV_COLUMN_EMPTY && info[i].has_empty) {
+            c->empty = cast(zpl_u8 *)zpl_alloc(allocator, (rows + 7) / 8);
+            ok = (c->empty != NULL);
+            if (ok) zpl_zero_size(c->empty, (rows + 7) / 8);
+        }
+    }
+
+    zpl_free(allocator, info);
+    if (!ok) {
+        zpl_csv_table_free(table);
+        return ZPL_CSV_ERROR_OUT_OF_MEMORY;
+    }
+    return zpl__csv_table_pass(table, NULL, text, has_header, delim, true);
+}
+
+void zpl_csv_table_free(zpl_csv_table *table) {
+    for (zpl_isize i = 0; i < table->column_count; i++) {
+        zpl_csv_column *c = table->columns + i;
+        if (c->integers) zpl_free(table->allocator, c->integers);
+        if (c->empty) zpl_free(table->allocator, c->empty);
+    }
+    if (table->columns) zpl_free(table->allocator, table->columns);
+    if (table->strings) zpl_free(table->allocator, table->strings);
+    table->columns = NULL;
+    table->strings = NULL;
+    table->column_count = table->row_count = 0;
+}
+
 void zpl_csv_free(zpl_csv_object *obj) {
     zpl_adt_destroy_branch(obj);
 }
 
-void zpl__csv_write_record(zpl_file *file, zpl_csv_object *node) {
+void zpl__csv_write_record(zpl__adt_writer *w, zpl_csv_object *node) {
     switch (node->type) {
         case ZPL_ADT_TYPE_STRING: {
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
             switch (node->name_style) {
                 case ZPL_ADT_NAME_STYLE_DOUBLE_QUOTE: {
-                    zpl_fprintf(file, "\"");
-                    zpl_adt_print_string(file, node, "\"", "\"");
-                    zpl_fprintf(file, "\"");
+                    zpl__adt_write_char(w, '"');
+                    zpl__adt_write_string(w, node, "\"", "\"");
+                    zpl__adt_write_char(w, '"');
                 } break;
                 
                 case ZPL_ADT_NAME_STYLE_NO_QUOTES: {
 #endif
-                    zpl_fprintf(file, "%s", node->string);
+                    zpl__adt_write(w, node->string, zpl_strlen(node->string));
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
                 } break;
             }
@@ -167,20 +557,19 @@ void zpl__csv_write_record(zpl_file *file, zpl_csv_object *node) {
         
         case ZPL_ADT_TYPE_REAL:
         case ZPL_ADT_TYPE_INTEGER: {
-            zpl_adt_print_number(file, node);
+            zpl__adt_write_number(w, node);
         } break;
     }
 }
 
-void zpl__csv_write_header(zpl_file *file, zpl_csv_object *header) {
+void zpl__csv_write_header(zpl__adt_writer *w, zpl_csv_object *header) {
     zpl_csv_object temp = *header;
     temp.string = temp.name;
     temp.type = ZPL_ADT_TYPE_STRING;
-    zpl__csv_write_record(file, &temp);
+    zpl__csv_write_record(w, &temp);
 }
 
-void zpl_csv_write_delimiter(zpl_file *file, zpl_csv_object *obj, char delimiter) {
-    ZPL_ASSERT_NOT_NULL(file);
+void zpl__csv_write(zpl__adt_writer *w, zpl_csv_object *obj, char delimiter) {
     ZPL_ASSERT_NOT_NULL(obj);
     ZPL_ASSERT(obj->nodes);
     zpl_isize cols = zpl_array_count(obj->nodes);
@@ -193,33 +582,50 @@ void zpl_csv_write_delimiter(zpl_file *file, zpl_csv_object *obj, char delimiter
     
     if (has_headers) {
         for (zpl_isize i = 0; i < cols; i++) {
-            zpl__csv_write_header(file, &obj->nodes[i]);
+            zpl__csv_write_header(w, &obj->nodes[i]);
             if (i+1 != cols) {
-                zpl_fprintf(file, "%c", delimiter);
+                zpl__adt_write_char(w, delimiter);
             }
         }
-        zpl_fprintf(file, "\n");
+        zpl__adt_write_char(w, '\n');
     }
     
-    for (zpl_isize r = 0; r < rows; r++) {
+    for (zpl_isize r = 0; r < rows && !w->failed; r++) {
         for (zpl_isize i = 0; i < cols; i++) {
-            zpl__csv_write_record(file, &obj->nodes[i].nodes[r]);
+            zpl__csv_write_record(w, &obj->nodes[i].nodes[r]);
             if (i+1 != cols) {
-                zpl_fprintf(file, "%c", delimiter);
+                zpl__adt_write_char(w, delimiter);
             }
         }
-        zpl_fprintf(file, "\n");
+        zpl__adt_write_char(w, '\n');
     }
 }
 
+void zpl_csv_write_delimiter(zpl_file *file, zpl_csv_object *obj, char delimiter) {
+    zpl__adt_writer w;
+    char buf[ZPL_ADT_WRITER_BUFFER_SIZE];
+    ZPL_ASSERT_NOT_NULL(file);
+    zpl__adt_writer_init_file(&w, file, buf, zpl_size_of(buf));
+    zpl__csv_write(&w, obj, delimiter);
+    zpl__adt_writer_flush(&w);
+}
+
+zpl_b8 zpl_csv_write_append_delimiter(zpl_string *str, zpl_csv_object *obj, char delimiter) {
+    zpl__adt_writer w;
+    ZPL_ASSERT_NOT_NULL(str);
+    zpl__adt_writer_init_string(&w, str);
+    zpl__csv_write(&w, obj, delimiter);
+    return zpl__adt_writer_flush(&w);
+}
+
 zpl_string zpl_csv_write_string_delimiter(zpl_allocator a, zpl_csv_object *obj, char delimiter) {
-    zpl_file tmp;
-    zpl_file_stream_new(&tmp, a);
-    zpl_csv_write_delimiter(&tmp, obj, delimiter);
-    zpl_isize fsize;
-    zpl_u8* buf = zpl_file_stream_buf(&tmp, &fsize);
-    zpl_string output = zpl_string_make_length(a, (char *)buf, fsize);
-    zpl_file_close(&tmp);
+    zpl_string output = zpl_string_make_reserve(a, 256);
+    if (!output)
+        return NULL;
+    if (!zpl_csv_write_append_delimiter(&output, obj, delimiter)) {
+        zpl_string_free(output);
+        return NULL;
+    }
     return output;
 }
 
@@ -20,20 +20,23 @@ char *zpl__json_parse_array(zpl_adt_node *obj, char *base, zpl_allocator a, zpl_
 char *zpl__json_parse_value(zpl_adt_node *obj, char *base, zpl_allocator a, zpl_u8 *err_code);
 char *zpl__json_parse_name(zpl_adt_node *obj, char *base, zpl_u8 *err_code);
 char *zpl__json_trim(char *base, zpl_b32 catch_newline);
-zpl_b8 zpl__json_write_value(zpl_file *f, zpl_adt_node *o, zpl_adt_node *t, zpl_isize indent, zpl_b32 is_inline, zpl_b32 is_last);
+zpl_b8 zpl__json_write_object(zpl__adt_writer *w, zpl_adt_node *o, zpl_isize indent);
+zpl_b8 zpl__json_write_value(zpl__adt_writer *w, zpl_adt_node *o, zpl_adt_node *t, zpl_isize indent, zpl_b32 is_inline, zpl_b32 is_last);
 
-#define zpl__json_fprintf(s_, fmt_, ...)                                                                               \
-do {                                                                                                               \
-    if (zpl_fprintf(s_, fmt_, ##__VA_ARGS__) < 0) return false;                                                    \
-} while (0)
-
-#define zpl___ind(x) if (x > 0) zpl__json_fprintf(f, "%*r", x, ' ');
+#define zpl___ind(x) if (x > 0) zpl__adt_write_repeat(w, ' ', x);
 
 zpl_u8 zpl_json_parse(zpl_adt_node *root, char *text, zpl_allocator a) {
+    return zpl_json_parse_ex(root, text, a, 0);
+}
+
+zpl_u8 zpl_json_parse_ex(zpl_adt_node *root, char *text, zpl_allocator a, zpl_u32 flags) {
     zpl_u8 err_code = ZPL_JSON_ERROR_NONE;
     ZPL_ASSERT(root);
     ZPL_ASSERT(text);
     zpl_zero_item(root);
+    if (flags & ZPL_JSON_PARSE_VALIDATE_UTF8) {
+        if (!zpl_utf8_is_valid(cast(zpl_u8 const *)text, zpl_strlen(text))) return ZPL_JSON_ERROR_INVALID_UTF8;
+    }
     text = zpl__json_trim(text, true);
 
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
@@ -50,16 +53,31 @@ void zpl_json_free(zpl_adt_node *obj) {
     zpl_adt_destroy_branch(obj);
 }
 
+zpl_b8 zpl_json_write(zpl_file *f, zpl_adt_node *o, zpl_isize indent) {
+    zpl__adt_writer w;
+    char buf[ZPL_ADT_WRITER_BUFFER_SIZE];
+    ZPL_ASSERT_NOT_NULL(f);
+    zpl__adt_writer_init_file(&w, f, buf, zpl_size_of(buf));
+    zpl__json_write_object(&w, o, indent);
+    return zpl__adt_writer_flush(&w);
+}
+
+zpl_b8 zpl_json_write_append(zpl_string *str, zpl_adt_node *o, zpl_isize indent) {
+    zpl__adt_writer w;
+    ZPL_ASSERT_NOT_NULL(str);
+    zpl__adt_writer_init_string(&w, str);
+    zpl__json_write_object(&w, o, indent);
+    return zpl__adt_writer_flush(&w);
+}
+
 zpl_string zpl_json_write_string(zpl_allocator a, zpl_adt_node *obj, zpl_isize indent) {
-    zpl_file tmp;
-    if (!zpl_file_stream_new(&tmp, a))
+    zpl_string output = zpl_string_make_reserve(a, 256);
+    if (!output)
         return NULL;
-    if (!zpl_json_write(&tmp, obj, indent))
+    if (!zpl_json_write_append(&output, obj, indent)) {
+        zpl_string_free(output);
         return NULL;
-    zpl_isize fsize;
-    zpl_u8* buf = zpl_file_stream_buf(&tmp, &fsize);
-    zpl_string output = zpl_string_make_length(a, (char *)buf, fsize);
-    zpl_file_close(&tmp);
+    }
     return output;
 }
 
@@ -363,7 +381,7 @@ char *zpl__json_trim(char *base, zpl_b32 catch_newline) {
     return NULL;
 }
 
-zpl_b8 zpl_json_write(zpl_file *f, zpl_adt_node *o, zpl_isize indent) {
+zpl_b8 zpl__json_write_object(zpl__adt_writer *w, zpl_adt_node *o, zpl_isize indent) {
     if (!o)
         return true;
 
@@ -375,7 +393,10 @@ zpl_b8 zpl_json_write(zpl_file *f, zpl_adt_node *o, zpl_isize indent) {
 #else
     if (1)
 #endif
-    zpl__json_fprintf(f, "%c\n", o->type == ZPL_ADT_TYPE_OBJECT ? '{' : '[');
+    {
+        zpl__adt_write_char(w, o->type == ZPL_ADT_TYPE_OBJECT ? '{' : '[');
+        zpl__adt_write_char(w, '\n');
+    }
     else
     {
         indent -= 4;
@@ -385,25 +406,28 @@ zpl_b8 zpl_json_write(zpl_file *f, zpl_adt_node *o, zpl_isize indent) {
         zpl_isize cnt = zpl_array_count(o->nodes);
 
         for (int i = 0; i < cnt; ++i) {
-            if (!zpl__json_write_value(f, o->nodes + i, o, indent, false, !(i < cnt - 1))) return false;
+            if (!zpl__json_write_value(w, o->nodes + i, o, indent, false, !(i < cnt - 1))) return false;
         }
     }
 
     zpl___ind(indent);
 
     if (indent > 0) {
-        zpl__json_fprintf(f, "%c", o->type == ZPL_ADT_TYPE_OBJECT ? '}' : ']');
+        zpl__adt_write_char(w, o->type == ZPL_ADT_TYPE_OBJECT ? '}' : ']');
     } else {
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
         if (!o->cfg_mode)
 #endif
-        zpl__json_fprintf(f, "%c\n", o->type == ZPL_ADT_TYPE_OBJECT ? '}' : ']');
+        {
+            zpl__adt_write_char(w, o->type == ZPL_ADT_TYPE_OBJECT ? '}' : ']');
+            zpl__adt_write_char(w, '\n');
+        }
     }
 
-    return true;
+    return !w->failed;
 }
 
-zpl_b8 zpl__json_write_value(zpl_file *f, zpl_adt_node *o, zpl_adt_node *t, zpl_isize indent, zpl_b32 is_inline, zpl_b32 is_last) {
+zpl_b8 zpl__json_write_value(zpl__adt_writer *w, zpl_adt_node *o, zpl_adt_node *t, zpl_isize indent, zpl_b32 is_inline, zpl_b32 is_last) {
     zpl_adt_node *node = o;
     indent += 4;
 
@@ -414,67 +438,73 @@ zpl_b8 zpl__json_write_value(zpl_file *f, zpl_adt_node *o, zpl_adt_node *t, zpl_
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
             switch (node->name_style) {
                 case ZPL_ADT_NAME_STYLE_DOUBLE_QUOTE: {
-                    zpl__json_fprintf(f, "\"%s\"", node->name);
+                    zpl__adt_write_char(w, '"');
+                    zpl__adt_write(w, node->name, zpl_strlen(node->name));
+                    zpl__adt_write_char(w, '"');
                 } break;
 
                 case ZPL_ADT_NAME_STYLE_SINGLE_QUOTE: {
-                    zpl__json_fprintf(f, "\'%s\'", node->name);
+                    zpl__adt_write_char(w, '\'');
+                    zpl__adt_write(w, node->name, zpl_strlen(node->name));
+                    zpl__adt_write_char(w, '\'');
                 } break;
 
                 case ZPL_ADT_NAME_STYLE_NO_QUOTES: {
-                    zpl__json_fprintf(f, "%s", node->name);
+                    zpl__adt_write(w, node->name, zpl_strlen(node->name));
                 } break;
             }
 
             if (o->assign_style == ZPL_ADT_ASSIGN_STYLE_COLON)
-                zpl__json_fprintf(f, ": ");
+                zpl__adt_write_lit(w, ": ");
             else {
                 zpl___ind(zpl_max(o->assign_line_width, 1));
 
                 if (o->assign_style == ZPL_ADT_ASSIGN_STYLE_EQUALS)
-                    zpl__json_fprintf(f, "= ");
+                    zpl__adt_write_lit(w, "= ");
                 else if (o->assign_style == ZPL_ADT_ASSIGN_STYLE_LINE) {
-                    zpl__json_fprintf(f, "| ");
+                    zpl__adt_write_lit(w, "| ");
                 }
             }
 #else
-            zpl__json_fprintf(f, "\"%s\": ", node->name);
+            zpl__adt_write_char(w, '"');
+            zpl__adt_write(w, node->name, zpl_strlen(node->name));
+            zpl__adt_write_lit(w, "\": ");
 #endif
         }
     }
 
     switch (node->type) {
         case ZPL_ADT_TYPE_STRING: {
-            zpl__json_fprintf(f, "\"");
-            if (zpl_adt_print_string(f, node, "\"", "\\")) return false;
-            zpl__json_fprintf(f, "\"");
+            zpl__adt_write_char(w, '"');
+            zpl__adt_write_string(w, node, "\"", "\\");
+            zpl__adt_write_char(w, '"');
         } break;
 
         case ZPL_ADT_TYPE_MULTISTRING: {
-            zpl__json_fprintf(f, "`");
-            if (zpl_adt_print_string(f, node, "`", "\\")) return false;
-            zpl__json_fprintf(f, "`");
+            zpl__adt_write_char(w, '`');
+            zpl__adt_write_string(w, node, "`", "\\");
+            zpl__adt_write_char(w, '`');
         } break;
 
         case ZPL_ADT_TYPE_ARRAY: {
-            zpl__json_fprintf(f, "[");
+            zpl__adt_write_char(w, '[');
             zpl_isize elemn = zpl_array_count(node->nodes);
             for (int j = 0; j < elemn; ++j) {
                 zpl_isize ind = ((node->nodes + j)->type == ZPL_ADT_TYPE_OBJECT || (node->nodes + j)->type == ZPL_ADT_TYPE_ARRAY) ? 0 : -4;
-                if (!zpl__json_write_value(f, node->nodes + j, o, ind, true, true)) return false;
+                if (!zpl__json_write_value(w, node->nodes + j, o, ind, true, true)) return false;
 
-                if (j < elemn - 1) { zpl__json_fprintf(f, ", "); }
+                if (j < elemn - 1) { zpl__adt_write_lit(w, ", "); }
             }
-            zpl__json_fprintf(f, "]");
+            zpl__adt_write_char(w, ']');
         } break;
 
         case ZPL_ADT_TYPE_REAL:
         case ZPL_ADT_TYPE_INTEGER: {
-            if (zpl_adt_print_number(f, node)) return false;
+            zpl__adt_write_number(w, node);
         } break;
 
         case ZPL_ADT_TYPE_OBJECT: {
-            if (!zpl_json_write(f, node, indent)) return false;
+            if (!zpl__json_write_object(w, node, indent)) return false;
         } break;
     }
 
@@ -482,32 +512,31 @@ zpl_b8 zpl__json_write_value(zpl_file *f, zpl_adt_node *o, zpl_adt_node *t, zpl_
 #ifndef ZPL_PARSER_DISABLE_ANALYSIS
         if (o->delim_style != ZPL_ADT_DELIM_STYLE_COMMA) {
             if (o->delim_style == ZPL_ADT_DELIM_STYLE_NEWLINE)
-                zpl__json_fprintf(f, "\n");
+                zpl__adt_write_char(w, '\n');
             else if (o->delim_style == ZPL_ADT_DELIM_STYLE_LINE) {
                 zpl___ind(o->delim_line_width);
-                zpl__json_fprintf(f, "|\n");
+                zpl__adt_write_lit(w, "|\n");
             }
         }
         else {
             if (!is_last) {
-                zpl__json_fprintf(f, ",\n");
+                zpl__adt_write_lit(w, ",\n");
             } else {
-                zpl__json_fprintf(f, "\n");
+                zpl__adt_write_char(w, '\n');
             }
         }
 #else
         if (!is_last) {
-            zpl__json_fprintf(f, ",\n");
+            zpl__adt_write_lit(w, ",\n");
         } else {
-            zpl__json_fprintf(f, "\n");
+            zpl__adt_write_char(w, '\n');
         }
 #endif
     }
 
-    return true;
+    return !w->failed;
 }
 
-#undef zpl__json_fprintf
 #undef zpl___ind
 #undef zpl__json_append_node
 
@@ -762,4 +762,257 @@ zpl_b32 zpl_re_match_all(zpl_re *re, char const *str, zpl_isize str_len, zpl_isi
     return true;
 }
 
+/* multi-pattern matcher */
+
+#define ZPL__STRMATCH_MATCH 0x80000000u
+
+zpl_internal zpl_u8 zpl__strmatch_fold(zpl_strmatch const *m, zpl_u8 c) {
+    return (m->flags & ZPL_STRMATCH_IGNORE_CASE) ? cast(zpl_u8)zpl_char_to_lower(cast(char)c) : c;
+}
+
+zpl_b32 zpl_strmatch_compile(zpl_strmatch *m, zpl_allocator backing, zpl_strview const *patterns, zpl_isize count, zpl_u32 flags) {
+    zpl_isize i, j, c, max_states = 1, total_out = 0, head = 0, tail = 0;
+    zpl_u32 *fail = NULL, *queue = NULL, *own = NULL, *next = NULL, *out_count = NULL;
+    zpl_b32 used[256] = {0}, first[256] = {0};
+    zpl_b32 pairs = true;
+    zpl_b32 ok = false;
+
+    ZPL_ASSERT_NOT_NULL(m);
+    zpl_zero_item(m);
+    m->backing = backing;
+    m->flags = flags;
+    m->pattern_count = count;
+    if (count <= 0) return false;
+
+    for (i = 0; i < count; i++) {
+        if (patterns[i].len <= 0) return false;
+        max_states += patterns[i].len;
+        for (j = 0; j < patterns[i].len; j++) used[zpl__strmatch_fold(m, cast(zpl_u8)patterns[i].ptr[j])] = true;
+        first[zpl__strmatch_fold(m, cast(zpl_u8)patterns[i].ptr[0])] = true;
+        if (patterns[i].len < 2) pairs = false;
+    }
+
+    // NOTE: Bytes no pattern contains share class 0, which keeps the transition table narrow
+    m->class_count = 1;
+    for (c = 0; c < 256; c++) {
+        if (used[c]) m->classes[c] = cast(zpl_u8)m->class_count++;
+    }
+    if (flags & ZPL_STRMATCH_IGNORE_CASE) {
+        for (c = 'A'; c <= 'Z'; c++) m->classes[c] = m->classes[c - 'A' + 'a'];
+    }
+    if (max_states * m->class_count >= ZPL__STRMATCH_MATCH) return false;
+
+    m->lengths   = cast(zpl_isize *)zpl_alloc(backing, count * zpl_size_of(zpl_isize));
+    m->delta     = cast(zpl_u32 *)zpl_alloc(backing, max_states * m->class_count * zpl_size_of(zpl_u32));
+    m->out_start = cast(zpl_u32 *)zpl_alloc(backing, (max_states + 1) * zpl_size_of(zpl_u32));
+    fail         = cast(zpl_u32 *)zpl_alloc(backing, max_states * zpl_size_of(zpl_u32));
+    queue        = cast(zpl_u32 *)zpl_alloc(backing, max_states * zpl_size_of(zpl_u32));
+    own          = cast(zpl_u32 *)zpl_alloc(backing, max_states * zpl_size_of(zpl_u32));
+    out_count    = cast(zpl_u32 *)zpl_alloc(backing, max_states * zpl_size_of(zpl_u32));
+    next         = cast(zpl_u32 *)zpl_alloc(backing, count * zpl_size_of(zpl_u32));
+    if (!m->lengths || !m->delta || !m->out_start || !fail || !queue || !own || !out_count || !next) goto cleanup;
+
+    zpl_zero_size(m->delta, max_states * m->class_count * zpl_size_of(zpl_u32));
+    zpl_memset(own, 0xFF, max_states * zpl_size_of(zpl_u32));
+
+    /* trie, 0 marks a missing edge since nothing leads back to the root yet */
+    m->state_count = 1;
+    for (i = count - 1; i >= 0; i--) {
+        zpl_u32 state = 0;
+        for (j = 0; j < patterns[i].len; j++) {
+            zpl_u32 *edge = &m->delta[state * m->class_count + m->classes[cast(zpl_u8)patterns[i].ptr[j]]];
+            if (*edge == 0) *edge = cast(zpl_u32)m->state_count++;
+            state = *edge;
+        }
+        /* patterns sharing a state are chained in index order */
+        m->lengths[i] = patterns[i].len;
+        next[i] = own[state];
+        own[state] = cast(zpl_u32)i;
+    }
+
+    /* breadth-first pass turning the trie into a DFA, missing edges borrow the fail state's transition */
+    fail[0] = 0;
+    queue[tail++] = 0;
+    while (head < tail) {
+        zpl_u32 r = queue[head++];
+        zpl_u32 *row = m->delta + r * m->class_count;
+        zpl_u32 *fail_row = m->delta + fail[r] * m->class_count;
+
+        out_count[r] = (r ? out_count[fail[r]] : 0);
+        for (zpl_u32 p = own[r]; p != 0xFFFFFFFF; p = next[p]) out_count[r]++;
+        total_out += out_count[r];
+
+        for (c = 0; c < m->class_count; c++) {
+            if (row[c] != 0) {
+                fail[row[c]] = r ? fail_row[c] : 0;
+                queue[tail++] = row[c];
+            } else {
+                row[c] = r ? fail_row[c] : 0;
+            }
+        }
+    }
+
+    /* match lists, own patterns first then the ones inherited through the fail link */
+    m->out = cast(zpl_u32 *)zpl_alloc(backing, zpl_max(total_out, 1) * zpl_size_of(zpl_u32));
+    if (!m->out) goto cleanup;
+    for (i = 0, j = 0; i < m->state_count; i++) {
+        m->out_start[i] = cast(zpl_u32)j;
+        j += out_count[i];
+    }
+    m->out_start[m->state_count] = cast(zpl_u32)j;
+    for (i = 0; i < tail; i++) {
+        zpl_u32 r = queue[i], k = m->out_start[r];
+        for (zpl_u32 p = own[r]; p != 0xFFFFFFFF; p = next[p]) m->out[k++] = p;
+        if (r) {
+            for (zpl_u32 f = m->out_start[fail[r]]; f < m->out_start[fail[r] + 1]; f++) m->out[k++] = m->out[f];
+        }
+    }
+
+    /* premultiply the targets and flag the accepting ones, the scan loop then needs a single lookup per byte */
+    for (i = 0; i < m->state_count * m->class_count; i++) {
+        zpl_u32 t = m->delta[i];
+        m->delta[i] = t * cast(zpl_u32)m->class_count | ((m->out_start[t + 1] != m->out_start[t]) ? ZPL__STRMATCH_MATCH : 0);
+    }
+
+    if (pairs) {
+        m->prefilter_pairs = true;
+        for (i = 0; i < count && m->prefilter_len >= 0; i++) {
+            zpl_u8 a = zpl__strmatch_fold(m, cast(zpl_u8)patterns[i].ptr[0]), b = zpl__strmatch_fold(m, cast(zpl_u8)patterns[i].ptr[1]);
+            zpl_isize k, variants = 1;
+            zpl_u8 va[4], vb[4];
+            va[0] = a, vb[0] = b;
+            if (flags & ZPL_STRMATCH_IGNORE_CASE) {
+                zpl_u8 ua = cast(zpl_u8)zpl_char_to_upper(cast(char)a), ub = cast(zpl_u8)zpl_char_to_upper(cast(char)b);
+                if (ua != a) va[variants] = ua, vb[variants] = b, variants++;
+                if (ub != b) va[variants] = a, vb[variants] = ub, variants++;
+                if (ua != a && ub != b) va[variants] = ua, vb[variants] = ub, variants++;
+            }
+            for (j = 0; j < variants; j++) {
+                for (k = 0; k < m->prefilter_len; k++) {
+                    if (m->prefilter[k] == va[j] && m->prefilter_next[k] == vb[j]) break;
+                }
+                if (k < m->prefilter_len) continue;
+                if (m->prefilter_len == ZPL_STRMATCH_PREFILTER_MAX) {
+                    m->prefilter_len = -1;
+                    break;
+                }
+                m->prefilter[m->prefilter_len] = va[j];
+                m->prefilter_next[m->prefilter_len++] = vb[j];
+            }
+        }
+        if (m->prefilter_len < 0) {
+            /* too many pairs, fall back to first bytes */
+            m->prefilter_pairs = false;
+            m->prefilter_len = 0;
+        }
+    }
+
+    for (c = 0; c < 256 && !m->prefilter_pairs; c++) {
+        zpl_b32 both_cases = (flags & ZPL_STRMATCH_IGNORE_CASE) && c >= 'a' && c <= 'z';
+        if (!first[c]) continue;
+        if (m->prefilter_len + (both_cases ? 2 : 1) > ZPL_STRMATCH_PREFILTER_MAX) {
+            m->prefilter_len = 0;
+            break;
+        }
+        m->prefilter[m->prefilter_len++] = cast(zpl_u8)c;
+        if (both_cases) m->prefilter[m->prefilter_len++] = cast(zpl_u8)(c - 'a' + 'A');
+    }
+
+    ok = true;
+
+cleanup:
+    zpl_free(backing, fail);
+    zpl_free(backing, queue);
+    zpl_free(backing, own);
+    zpl_free(backing, out_count);
+    zpl_free(backing, next);
+    if (!ok) zpl_strmatch_destroy(m);
+    return ok;
+}
+
+void zpl_strmatch_destroy(zpl_strmatch *m) {
+    zpl_free(m->backing, m->lengths);
+    zpl_free(m->backing, m->delta);
+    zpl_free(m->backing, m->out_start);
+    zpl_free(m->backing, m->out);
+    m->lengths = NULL;
+    m->delta = m->out_start = m->out = NULL;
+    m->state_count = m->pattern_count = 0;
+}
+
+void zpl_strmatch_reset(zpl_strmatch *m) {
+    m->state = 0;
+    m->consumed = 0;
+}
+
+zpl_internal zpl_b32 zpl__strmatch_scan(zpl_strmatch *m, zpl_u32 *state, zpl_i64 base, zpl_u8 const *data, zpl_isize len, zpl_strmatch_proc proc, void *user_data) {
+    zpl_u8 const *p = data, *end = data + len;
+    zpl_u32 const *delta = m->delta;
+    zpl_u8 const *classes = m->classes;
+    zpl_u32 s = *state;
+    zpl_isize prefilter_len = m->prefilter_len, short_skips = 0;
+
+    if (!m->delta) return true;
+
+    while (p < end) {
+        if (s == 0 && prefilter_len) {
+            zpl_u8 const *q;
+            if (m->prefilter_pairs) {
+                q = cast(zpl_u8 const *)zpl__simd.memchr_pair(p, end - p, m->prefilter, m->prefilter_next, prefilter_len);
+                // NOTE: The last byte has no successor here, it may start a match that continues in the next buffer
+                if (!q) q = end - 1;
+            } else {
+                q = cast(zpl_u8 const *)zpl_memchr_any(p, end - p, m->prefilter, prefilter_len);
+                if (!q) break;
+            }
+            // NOTE: With candidates this dense the automaton alone is faster, drop the prefilter for this buffer
+            if (q - p < 16) {
+                if (++short_skips > 32) prefilter_len = 0;
+            } else {
+                short_skips = 0;
+            }
+            p = q;
+        }
+
+        s = delta[s + classes[*p++]];
+        if (s & ZPL__STRMATCH_MATCH) {
+            zpl_u32 id, k;
+            s &= ~ZPL__STRMATCH_MATCH;
+            id = s / cast(zpl_u32)m->class_count;
+            for (k = m->out_start[id]; k < m->out_start[id + 1]; k++) {
+                zpl_strmatch_hit hit;
+                hit.pattern = m->out[k];
+                hit.len = m->lengths[hit.pattern];
+                hit.offset = base + (p - data) - hit.len;
+                if (!proc(&hit, user_data)) {
+                    *state = s;
+                    return false;
+                }
+            }
+        }
+    }
+
+    *state = s;
+    return true;
+}
+
+zpl_internal zpl_b32 zpl__strmatch_first(zpl_strmatch_hit const *hit, void *user_data) {
+    *cast(zpl_strmatch_hit *)user_data = *hit;
+    return false;
+}
+
+zpl_b32 zpl_strmatch_find(zpl_strmatch *m, char const *str, zpl_isize str_len, zpl_strmatch_hit *hit) {
+    zpl_strmatch_hit tmp;
+    zpl_u32 state = 0;
+    return !zpl__strmatch_scan(m, &state, 0, cast(zpl_u8 const *)str, str_len, zpl__strmatch_first, hit ? hit : &tmp);
+}
+
+zpl_b32 zpl_strmatch_feed(zpl_strmatch *m, void const *data, zpl_isize len, zpl_strmatch_proc proc, void *user_data) {
+    zpl_b32 res = zpl__strmatch_scan(m, &m->state, m->consumed, cast(zpl_u8 const *)data, len, proc, user_data);
+    m->consumed += len;
+    return res;
+}
+
+#undef ZPL__STRMATCH_MATCH
+
 ZPL_END_C_DECLS
@@ -138,4 +138,15 @@ MODULE(adt, {
 
         EQUALS(2, node->integer);
     });
+    IT("can find a node by a name that isn't NUL-terminated", {
+        zpl_adt_node root;
+        zpl_adt_set_obj(&root, "root", mem_alloc);
+        zpl_adt_append_int(&root, "question", 1);
+        zpl_adt_append_int(&root, "quest", 2);
+
+        char const *uri = "quest/ion";
+        EQUALS(zpl_adt_find_view(&root, zpl_strview_make(uri, 5), false)->integer, 2);
+        EQUALS(zpl_adt_find_view(&root, zpl_strview_make(uri, 4), false), NULL);
+        EQUALS(zpl_adt_query(&root, "quest")->integer, 2);
+    });
 });
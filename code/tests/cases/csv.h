@@ -2,6 +2,16 @@
     zpl_csv_object r={0}; \
     zpl_u8 err = zpl_csv_parse(&r, (char *const)t, mem_alloc, has_header);
 
+/* zpl_csv_parse_parallel allocates from its worker threads */
+zpl_global zpl_mutex csv__heap_lock;
+
+ZPL_ALLOCATOR_PROC(csv__locked_heap_proc) {
+    zpl_mutex_lock(&csv__heap_lock);
+    void *ptr = zpl_heap_allocator_proc(allocator_data, type, size, alignment, old_memory, old_size, flags);
+    zpl_mutex_unlock(&csv__heap_lock);
+    return ptr;
+}
+
 MODULE(csv_parser, {
     IT("fails to parse empty data", {
         const char *t = "\n\n\n";
@@ -205,6 +215,112 @@ MODULE(csv_parser, {
         STREQUALS(original, a);
     });
 
+    IT("appends csv output to an existing string", {
+        zpl_string t = zpl_string_make(mem_alloc, "foo,bar\n1,\"a \"\"b\"\"\"\n");
+        __PARSE(true);
+        EQUALS(err, 0);
+
+        zpl_string a = zpl_string_make(mem_alloc, "# header\n");
+        EQUALS(zpl_csv_write_append(&a, &r), true);
+        STREQUALS("# header\n\"foo\",\"bar\"\n1,\"a \"\"b\"\"\"\n", a);
+    });
+
+    IT("parses large csv files in parallel chunks", {
+        zpl_allocator heap = {csv__locked_heap_proc, NULL};
+        zpl_mutex_init(&csv__heap_lock);
+
+        zpl_string t = zpl_string_make(heap, "id,text,value\n");
+        for (zpl_isize i = 0; i < 20000; i++) {
+            t = zpl_string_append_fmt(t, "%d,\"line %d \"\"quoted\"\"\nnext, line\",%d.5\n", (int)i, (int)i, (int)i);
+        }
+        zpl_string u = zpl_string_duplicate(heap, t);
+
+        zpl_csv_object seq = {0}, par = {0};
+        EQUALS(zpl_csv_parse_delimiter(&seq, t, heap, true, ','), 0);
+        EQUALS(zpl_csv_parse_parallel(&par, u, heap, true, ',', 4), 0);
+
+        EQUALS(zpl_array_count(par.nodes), 3);
+        for (zpl_isize c = 0; c < 3; c++) {
+            STREQUALS(seq.nodes[c].name, par.nodes[c].name);
+            EQUALS(par.nodes[c].parent, &par);
+            EQUALS(zpl_array_count(par.nodes[c].nodes), 20000);
+        }
+        zpl_isize mismatches = 0;
+        for (zpl_isize i = 0; i < 20000; i++) {
+            if (seq.nodes[0].nodes[i].integer != par.nodes[0].nodes[i].integer) mismatches++;
+            if (zpl_strcmp(seq.nodes[1].nodes[i].string, par.nodes[1].nodes[i].string)) mismatches++;
+            if (seq.nodes[2].nodes[i].real != par.nodes[2].nodes[i].real) mismatches++;
+        }
+        EQUALS(mismatches, 0);
+        STREQUALS(par.nodes[1].nodes[19999].string, "line 19999 \"quoted\"\nnext, line");
+
+        zpl_csv_free(&seq);
+        zpl_csv_free(&par);
+        zpl_string_free(t);
+        zpl_string_free(u);
+        zpl_mutex_destroy(&csv__heap_lock);
+    });
+
+    IT("parses csv data into typed columns", {
+        const char *t = "id,price,name,note,none\n"
+                        "1,2.5,\"a \"\"b\"\"\",x,\n"
+                        "-2,3,plain,,\n"
+                        "3,,\"multi\nline\",1.2.3,\n";
+        zpl_csv_table tb;
+        EQUALS(zpl_csv_parse_table(&tb, t, mem_alloc, true, ','), 0);
+
+        EQUALS(tb.column_count, 5);
+        EQUALS(tb.row_count, 3);
+        STREQUALS(tb.columns[0].name, "id");
+        STREQUALS(tb.columns[4].name, "none");
+
+        EQUALS(tb.columns[0].type, ZPL_CSV_COLUMN_INTEGER);
+        EQUALS(tb.columns[0].integers[1], -2);
+        EQUALS(tb.columns[0].empty, NULL);
+
+        EQUALS(tb.columns[1].type, ZPL_CSV_COLUMN_REAL);
+        EQUALS(tb.columns[1].reals[0], 2.5);
+        EQUALS(tb.columns[1].reals[1], 3.0);
+        EQUALS(zpl_csv_table_is_empty(&tb, 1, 1), false);
+        EQUALS(zpl_csv_table_is_empty(&tb, 1, 2), true);
+
+        EQUALS(tb.columns[2].type, ZPL_CSV_COLUMN_STRING);
+        STREQUALS(zpl_csv_table_string(&tb, 2, 0), "a \"b\"");
+        STREQUALS(zpl_csv_table_string(&tb, 2, 2), "multi\nline");
+
+        EQUALS(tb.columns[3].type, ZPL_CSV_COLUMN_STRING);
+        STREQUALS(zpl_csv_table_string(&tb, 3, 1), "");
+        EQUALS(zpl_csv_table_is_empty(&tb, 3, 1), true);
+        STREQUALS(zpl_csv_table_string(&tb, 3, 2), "1.2.3");
+
+        EQUALS(tb.columns[4].type, ZPL_CSV_COLUMN_EMPTY);
+        EQUALS(zpl_csv_table_is_empty(&tb, 4, 0), true);
+
+        zpl_csv_table_free(&tb);
+    });
+
+    IT("keeps only names and string cells in the string heap", {
+        zpl_csv_table tb;
+        EQUALS(zpl_csv_parse_table(&tb, "x,y\n1,2.5\n3,4.25\n-7,1e3\n", mem_alloc, true, ','), 0);
+        EQUALS(tb.strings_size, 1 + 2 + 2);
+        STREQUALS(tb.columns[0].name, "x");
+        STREQUALS(tb.columns[1].name, "y");
+        EQUALS(tb.columns[1].reals[2], 1000.0);
+        zpl_csv_table_free(&tb);
+
+        EQUALS(zpl_csv_parse_table(&tb, "name,n\nab,1\ncd,22\n", mem_alloc, true, ','), 0);
+        EQUALS(tb.strings_size, 1 + 5 + 2 + 3 + 3);
+        STREQUALS(zpl_csv_table_string(&tb, 0, 1), "cd");
+        zpl_csv_table_free(&tb);
+    });
+
+    IT("fails to parse mismatched rows into typed columns", {
+        const char *t = "1,2\n3\n";
+        zpl_csv_table tb;
+        EQUALS(zpl_csv_parse_table(&tb, t, mem_alloc, false, ','), ZPL_CSV_ERROR_MISMATCHED_ROWS);
+        EQUALS(zpl_csv_parse_table(&tb, "\"open,1\n", mem_alloc, false, ','), ZPL_CSV_ERROR_UNEXPECTED_END_OF_INPUT);
+    });
+
     IT("parses csv file with unquoted IP addresses", {
         zpl_string t = zpl_string_make(mem_alloc, "\"foo\",123.45.67.89\n");
         __PARSE(true);
@@ -0,0 +1,449 @@
+#define __TEMP_FILE "zpl_test_file.tmp"
+#define __TEMP_DIR "zpl_test_walk"
+
+static zpl_mutex file__heap_lock;
+
+ZPL_ALLOCATOR_PROC(file__locked_heap_proc) {
+    zpl_mutex_lock(&file__heap_lock);
+    void *ptr = zpl_heap_allocator_proc(allocator_data, type, size, alignment, old_memory, old_size, flags);
+    zpl_mutex_unlock(&file__heap_lock);
+    return ptr;
+}
+
+static zpl_b32 file__walk_count(zpl_dir_walk_entry const *entry, void *user_data) {
+    zpl_unused(entry);
+    zpl_atomic32_fetch_add(cast(zpl_atomic32 *)user_data, 1);
+    return true;
+}
+
+/* counts archive entries whose contents equal their own path */
+static ZPL_TAR_UNPACK_PROC(file__tar_check) {
+    char buf[512] = {0};
+    if (file->error != ZPL_TAR_ERROR_NONE || file->length >= zpl_size_of(buf)) return 0;
+    zpl_file_read_at(archive, buf, file->length, file->offset);
+    if (!zpl_strcmp(buf, file->path)) (*cast(zpl_isize *)user_data)++;
+    return 0;
+}
+
+static zpl_b32 file__walk_first(zpl_dir_walk_entry const *entry, void *user_data) {
+    zpl_unused(entry);
+    zpl_atomic32_fetch_add(cast(zpl_atomic32 *)user_data, 1);
+    return false;
+}
+
+static zpl_b32 file__hard_link(char const *existing, char const *path) {
+#if defined(ZPL_SYSTEM_WINDOWS)
+    return CreateHardLinkA(path, existing, NULL) != 0;
+#else
+    return link(existing, path) == 0;
+#endif
+}
+
+MODULE(file, {
+    IT("maps file contents copy-on-write and zero terminated", {
+        zpl_isize page_size = zpl_virtual_memory_page_size(NULL);
+        zpl_isize size = zpl_max(ZPL_FILE_MAP_MIN_SIZE, page_size * 16);
+        zpl_u8 *data = cast(zpl_u8 *)zpl_alloc(zpl_heap(), size);
+        for (zpl_isize i = 0; i < size; i++) data[i] = cast(zpl_u8)('a' + i % 26);
+        EQUALS(zpl_file_write_contents(__TEMP_FILE, data, size, NULL), true);
+
+        /* ends on a page boundary, the terminator has to come from the extra page */
+        zpl_file_contents fc = zpl_file_map_contents(zpl_heap(), true, true, __TEMP_FILE);
+        EQUALS(fc.size, size);
+        NEQUALS(fc.mapped_size, 0);
+        EQUALS(zpl_memcompare(fc.data, data, size), 0);
+        EQUALS((cast(zpl_u8 *)fc.data)[size], 0);
+
+        /* writes stay private to the mapping */
+        (cast(zpl_u8 *)fc.data)[0] = 'Z';
+        zpl_file_unmap(&fc);
+        EQUALS(fc.data, NULL);
+
+        fc = zpl_file_read_contents(zpl_heap(), false, __TEMP_FILE);
+        EQUALS((cast(zpl_u8 *)fc.data)[0], 'a');
+        zpl_file_free_contents(&fc);
+
+        zpl_fs_remove(__TEMP_FILE);
+        zpl_free(zpl_heap(), data);
+    });
+
+    IT("reads small files instead of mapping them", {
+        EQUALS(zpl_file_write_contents(__TEMP_FILE, "small", 5, NULL), true);
+
+        zpl_file_contents fc = zpl_file_map_contents(zpl_heap(), false, true, __TEMP_FILE);
+        EQUALS(fc.mapped_size, 0);
+        STREQUALS(cast(char *)fc.data, "small");
+        zpl_file_unmap(&fc);
+
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("coalesces small writes and reads through a buffered file", {
+        zpl_file f;
+        EQUALS(zpl_file_buffered_open(&f, zpl_heap(), ZPL_FILE_MODE_WRITE, __TEMP_FILE, 256), ZPL_FILE_ERROR_NONE);
+        for (int i = 0; i < 1000; i++) {
+            zpl_fprintf(&f, "line %d\n", i);
+        }
+        zpl_i64 size = zpl_file_tell(&f);
+        EQUALS(zpl_file_size(&f), size);
+
+        /* pending data becomes visible to other readers after a flush */
+        EQUALS(zpl_file_flush(&f), true);
+        zpl_file_contents fc = zpl_file_read_contents(zpl_heap(), true, __TEMP_FILE);
+        EQUALS(fc.size, size);
+        EQUALS(zpl_strncmp(cast(char *)fc.data, "line 0\nline 1\n", 14), 0);
+        zpl_file_close(&f);
+
+        EQUALS(zpl_file_buffered_open(&f, zpl_heap(), ZPL_FILE_MODE_READ, __TEMP_FILE, 256), ZPL_FILE_ERROR_NONE);
+        char buf[16];
+        zpl_isize checked = 0;
+        while (checked + 7 <= size) {
+            zpl_file_read(&f, buf, 7);
+            if (zpl_memcompare(buf, cast(char *)fc.data + checked, 7)) break;
+            checked += 7;
+        }
+        EQUALS(checked, (size / 7) * 7);
+
+        /* a read larger than the buffer goes around it */
+        char *all = cast(char *)zpl_alloc(zpl_heap(), size);
+        zpl_file_seek(&f, 0);
+        EQUALS(zpl_file_read(&f, all, size), true);
+        EQUALS(zpl_memcompare(all, fc.data, size), 0);
+        zpl_free(zpl_heap(), all);
+        zpl_file_close(&f);
+
+        /* writes in the middle are seen by later buffered reads */
+        EQUALS(zpl_file_buffered_open(&f, zpl_heap(), ZPL_FILE_MODE_READ | ZPL_FILE_MODE_RW, __TEMP_FILE, 256), ZPL_FILE_ERROR_NONE);
+        zpl_file_read_at(&f, buf, 6, 0);
+        zpl_file_write_at(&f, "LINE", 4, 0);
+        zpl_file_read_at(&f, buf, 6, 0);
+        EQUALS(zpl_strncmp(buf, "LINE 0", 6), 0);
+        zpl_file_close(&f);
+
+        zpl_file_free_contents(&fc);
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("keeps many reads in flight with the async queue", {
+        zpl_u8 data[64 * 1024];
+        for (zpl_isize i = 0; i < zpl_size_of(data); i++) data[i] = cast(zpl_u8)(i * 7);
+        EQUALS(zpl_file_write_contents(__TEMP_FILE, data, zpl_size_of(data), NULL), true);
+
+        zpl_file f;
+        EQUALS(zpl_file_open(&f, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+
+        /* run once through the native backend and once through the thread pool */
+        for (zpl_u32 mode = 0; mode < 2; mode++) {
+            zpl_file_async q;
+            static zpl_u8 chunks[32][2048];
+            EQUALS(zpl_file_async_init(&q, zpl_heap(), 8, mode ? ZPL_FILE_ASYNC_FORCE_THREADS : 0), true);
+            if (mode) EQUALS(q.uses_io_uring, false);
+
+            zpl_isize queued = 0, finished = 0, mismatches = 0;
+            while (finished < 32) {
+                while (queued < 32 && zpl_file_read_async(&q, &f, chunks[queued], 2048, queued * 2048, cast(void *)queued)) {
+                    queued++;
+                }
+                zpl_file_async_completion c[8];
+                zpl_isize n = zpl_file_async_wait(&q, c, zpl_count_of(c));
+                for (zpl_isize i = 0; i < n; i++) {
+                    zpl_isize index = cast(zpl_isize)c[i].user_data;
+                    if (c[i].result != 2048 || zpl_memcompare(chunks[index], data + index * 2048, 2048)) mismatches++;
+                }
+                finished += n;
+            }
+            EQUALS(mismatches, 0);
+            EQUALS(q.in_flight, 0);
+            zpl_file_async_free(&q);
+        }
+        zpl_file_close(&f);
+
+        /* memory streams are served right away */
+        {
+            zpl_file_async q;
+            zpl_file m;
+            char buf[5] = {0};
+            zpl_file_async_completion c;
+            zpl_file_stream_open(&m, zpl_heap(), cast(zpl_u8 *)"hello", 5, 0);
+            EQUALS(zpl_file_async_init(&q, zpl_heap(), 4, 0), true);
+            EQUALS(zpl_file_read_async(&q, &m, buf, 4, 1, NULL), true);
+            EQUALS(zpl_file_async_poll(&q, &c, 1), 1);
+            EQUALS(c.result, 4);
+            EQUALS(zpl_strncmp(buf, "ello", 4), 0);
+            zpl_file_async_free(&q);
+            zpl_file_close(&m);
+        }
+
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("iterates over lines in a rolling buffer", {
+        zpl_string text = zpl_string_make(zpl_heap(), "first\r\n\nthird line\n");
+        for (int i = 0; i < 100; i++) text = zpl_string_appendc(text, "long");
+        text = zpl_string_appendc(text, "\nlast");
+        EQUALS(zpl_file_write_contents(__TEMP_FILE, text, zpl_string_length(text), NULL), true);
+
+        zpl_file f;
+        zpl_file_line_iter it;
+        char const *line;
+        zpl_isize len, count = 0;
+        EQUALS(zpl_file_open(&f, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_file_line_iter_init(&it, zpl_heap(), &f, 8), true);
+
+        while (zpl_file_line_next(&it, &line, &len)) {
+            switch (count++) {
+                case 0: STRCEQUALS(line, "first", len); EQUALS(len, 5); break;
+                case 1: EQUALS(len, 0); break;
+                case 2: STRCEQUALS(line, "third line", len); EQUALS(len, 10); break;
+                case 3: EQUALS(len, 400); EQUALS(zpl_strncmp(line + 396, "long", 4), 0); break;
+                case 4: STRCEQUALS(line, "last", len); EQUALS(len, 4); break;
+            }
+        }
+        EQUALS(count, 5);
+        EQUALS(zpl_file_line_next(&it, &line, &len), false);
+
+        zpl_file_line_iter_free(&it);
+        zpl_file_close(&f);
+        zpl_string_free(text);
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("iterates over lines of a memory stream", {
+        char data[] = "a\nbb\nccc";
+        zpl_file f;
+        zpl_file_line_iter it;
+        char const *line;
+        zpl_isize len, count = 0;
+        EQUALS(zpl_file_stream_open(&f, zpl_heap(), cast(zpl_u8 *)data, zpl_size_of(data) - 1, 0), true);
+        EQUALS(zpl_file_line_iter_init(&it, zpl_heap(), &f, 4), true);
+
+        while (zpl_file_line_next(&it, &line, &len)) {
+            switch (count++) {
+                case 0: STRCEQUALS(line, "a", len); EQUALS(len, 1); break;
+                case 1: STRCEQUALS(line, "bb", len); EQUALS(len, 2); break;
+                case 2: STRCEQUALS(line, "ccc", len); EQUALS(len, 3); break;
+            }
+        }
+        EQUALS(count, 3);
+
+        zpl_file_line_iter_free(&it);
+        zpl_file_close(&f);
+    });
+
+    IT("walks a directory tree with filters", {
+        char const *dirs[] = { __TEMP_DIR, __TEMP_DIR "/sub", __TEMP_DIR "/sub/deep" };
+        char const *files[] = { __TEMP_DIR "/a.txt", __TEMP_DIR "/b.c", __TEMP_DIR "/.hidden", __TEMP_DIR "/sub/c.txt", __TEMP_DIR "/sub/deep/d.txt" };
+        for (int i = 0; i < 3; i++) zpl_path_mkdir(dirs[i], 0755);
+        for (int i = 0; i < 5; i++) zpl_file_write_contents(files[i], "x", 1, NULL);
+
+        zpl_atomic32 count = {0};
+        EQUALS(zpl_path_walk(__TEMP_DIR, NULL, file__walk_count, &count), true);
+        EQUALS(zpl_atomic32_load(&count), 6);
+
+        zpl_dir_walk_opts opts = {0};
+        opts.max_depth = -1;
+        opts.flags = ZPL_DIR_WALK_FILES;
+        opts.pattern = "*.tx[st]";
+        zpl_atomic32_store(&count, 0);
+        zpl_path_walk(__TEMP_DIR "/", &opts, file__walk_count, &count);
+        EQUALS(zpl_atomic32_load(&count), 3);
+
+        opts.flags = ZPL_DIR_WALK_FOLDERS | ZPL_DIR_WALK_FILES | ZPL_DIR_WALK_HIDDEN;
+        opts.pattern = NULL;
+        opts.max_depth = 0;
+        zpl_atomic32_store(&count, 0);
+        zpl_path_walk(__TEMP_DIR, &opts, file__walk_count, &count);
+        EQUALS(zpl_atomic32_load(&count), 4);
+
+        zpl_atomic32_store(&count, 0);
+        zpl_path_walk(__TEMP_DIR, NULL, file__walk_first, &count);
+        EQUALS(zpl_atomic32_load(&count), 1);
+
+        /* sub-directories are handed to a job pool, allocations have to be thread-safe */
+        zpl_mutex_init(&file__heap_lock);
+        opts.flags = 0;
+        opts.max_depth = -1;
+        opts.thread_count = 4;
+        opts.allocator.proc = file__locked_heap_proc;
+        zpl_atomic32_store(&count, 0);
+        EQUALS(zpl_path_walk(__TEMP_DIR, &opts, file__walk_count, &count), true);
+        EQUALS(zpl_atomic32_load(&count), 6);
+        zpl_mutex_destroy(&file__heap_lock);
+
+        EQUALS(zpl_path_walk(__TEMP_DIR "/missing", NULL, file__walk_count, &count), false);
+
+        for (int i = 4; i >= 0; i--) zpl_fs_remove(files[i]);
+        for (int i = 2; i >= 0; i--) zpl_path_rmdir(dirs[i]);
+    });
+
+    IT("copies files in kernel and keeps holes of sparse files", {
+        zpl_file f;
+        zpl_fs_copy_stats stats = {0};
+        zpl_i64 size = 8 * 1024 * 1024 + 3;
+        EQUALS(zpl_file_create(&f, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        zpl_file_write_at(&f, "head", 4, 0);
+        zpl_file_write_at(&f, "tail", 3, size - 3);
+        zpl_file_close(&f);
+
+        EQUALS(zpl_fs_copy_ex(__TEMP_FILE, __TEMP_FILE ".copy", true, &stats), true);
+        EQUALS(stats.file_size, size);
+        EQUALS((stats.bytes_copied <= size), true);
+        NEQUALS(stats.method, ZPL_FS_COPY_METHOD_NONE);
+
+        zpl_file_contents fc = zpl_file_read_contents(zpl_heap(), false, __TEMP_FILE ".copy");
+        EQUALS(fc.size, size);
+        STRCEQUALS(cast(char *)fc.data, "head", 4);
+        STRCEQUALS(cast(char *)fc.data + size - 3, "tai", 3);
+        EQUALS((cast(zpl_u8 *)fc.data)[size / 2], 0);
+        zpl_file_free_contents(&fc);
+
+        /* refuses to clobber, otherwise truncates the old contents */
+        EQUALS(zpl_fs_copy(__TEMP_FILE, __TEMP_FILE ".copy", true), false);
+        EQUALS(zpl_file_write_contents(__TEMP_FILE, "short", 5, NULL), true);
+        EQUALS(zpl_fs_copy(__TEMP_FILE, __TEMP_FILE ".copy", false), true);
+        fc = zpl_file_read_contents(zpl_heap(), true, __TEMP_FILE ".copy");
+        EQUALS(fc.size, 5);
+        STREQUALS(cast(char *)fc.data, "short");
+        zpl_file_free_contents(&fc);
+
+        zpl_fs_remove(__TEMP_FILE ".copy");
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("refuses to copy a file onto itself or a hard link to it", {
+        EQUALS(zpl_file_write_contents(__TEMP_FILE, "keep me", 7, NULL), true);
+        EQUALS(zpl_fs_copy(__TEMP_FILE, __TEMP_FILE, false), false);
+        EQUALS(file__hard_link(__TEMP_FILE, __TEMP_FILE ".link"), true);
+        EQUALS(zpl_fs_copy(__TEMP_FILE, __TEMP_FILE ".link", false), false);
+
+        zpl_file_contents fc = zpl_file_read_contents(zpl_heap(), true, __TEMP_FILE);
+        EQUALS(fc.size, 7);
+        STREQUALS(cast(char *)fc.data, "keep me");
+        zpl_file_free_contents(&fc);
+
+        zpl_fs_remove(__TEMP_FILE ".link");
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("packs a directory walk with long paths into a ustar/PAX archive", {
+        char const *dirs[] = { __TEMP_DIR, __TEMP_DIR "/dddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddd" };
+        char const *files[] = {
+            __TEMP_DIR "/a.txt",
+            /* longer than 100 bytes, splits into the ustar prefix */
+            __TEMP_DIR "/dddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddd/ffffffffffffffffffff",
+            /* no separator to split at, needs a PAX header */
+            __TEMP_DIR "/pppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppppp",
+        };
+        for (int i = 0; i < 2; i++) zpl_path_mkdir(dirs[i], 0755);
+        for (int i = 0; i < 3; i++) zpl_file_write_contents(files[i], files[i], zpl_strlen(files[i]), NULL);
+
+        zpl_file archive;
+        EQUALS(zpl_file_create(&archive, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_tar_pack_dir(&archive, __TEMP_DIR, zpl_heap()), 0);
+        zpl_file_close(&archive);
+
+        zpl_isize found = 0;
+        EQUALS(zpl_file_open(&archive, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_tar_unpack(&archive, file__tar_check, &found), 0);
+        EQUALS(found, 3);
+        zpl_file_close(&archive);
+
+        for (int i = 2; i >= 0; i--) zpl_fs_remove(files[i]);
+        for (int i = 1; i >= 0; i--) zpl_path_rmdir(dirs[i]);
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("looks up tar entries through an index and reads them as files", {
+        char const *files[] = { __TEMP_FILE ".a", __TEMP_FILE ".b", __TEMP_FILE ".c" };
+        for (int i = 0; i < 3; i++) zpl_file_write_contents(files[i], files[i], zpl_strlen(files[i]), NULL);
+
+        zpl_file archive;
+        EQUALS(zpl_file_create(&archive, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_tar_pack(&archive, files, 3), 0);
+        zpl_file_close(&archive);
+
+        zpl_tar_index index;
+        EQUALS(zpl_file_open(&archive, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_tar_index_init(&index, &archive, zpl_heap()), 0);
+        EQUALS(zpl_array_count(index.entries), 3);
+        EQUALS(zpl_tar_index_find(&index, "missing"), NULL);
+
+        zpl_tar_entry *entry = zpl_tar_index_find(&index, __TEMP_FILE ".b");
+        NEQUALS(entry, NULL);
+        EQUALS(entry->length, zpl_strlen(files[1]));
+
+        /* reads stay within the entry */
+        zpl_file view;
+        char buf[64] = {0};
+        EQUALS(zpl_tar_open_entry(&view, &archive, entry, zpl_heap()), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_file_size(&view), entry->length);
+        zpl_file_seek(&view, 4);
+        EQUALS(zpl_file_read(&view, buf, 5), true);
+        STRCEQUALS(buf, files[1] + 4, 5);
+        zpl_isize bytes_read = 0;
+        zpl_file_read_at_check(&view, buf, zpl_size_of(buf), 0, &bytes_read);
+        EQUALS(bytes_read, entry->length);
+        zpl_file_close(&view);
+
+        zpl_file_contents fc = zpl_file_map_contents(zpl_heap(), false, false, __TEMP_FILE);
+        STRCEQUALS(cast(char *)zpl_tar_entry_data(&fc, entry), files[1], entry->length);
+        zpl_file_unmap(&fc);
+
+        zpl_tar_index_free(&index);
+        zpl_file_close(&archive);
+        for (int i = 0; i < 3; i++) zpl_fs_remove(files[i]);
+        zpl_fs_remove(__TEMP_FILE);
+    });
+
+    IT("extracts an archive with worker threads", {
+        enum { FILE_COUNT = 200 };
+        char path[64];
+        char const *paths[FILE_COUNT + 1];
+        zpl_path_mkdir(__TEMP_DIR, 0755);
+        for (int i = 0; i < FILE_COUNT; i++) {
+            /* names shrink as we go, so reused slots get shorter paths */
+            zpl_snprintf(path, zpl_size_of(path), __TEMP_DIR "/f%d", FILE_COUNT - 1 - i);
+            paths[i] = zpl_alloc_str(zpl_heap(), path);
+            zpl_file_write_contents(paths[i], path, zpl_strlen(path), NULL);
+        }
+
+        /* bigger than a worker's share of the budget, written by the calling thread */
+        zpl_isize big_size = ZPL_TAR_UNPACK_BUDGET / 4;
+        zpl_u8 *big = cast(zpl_u8 *)zpl_alloc(zpl_heap(), big_size);
+        for (zpl_isize i = 0; i < big_size; i++) big[i] = cast(zpl_u8)i;
+        paths[FILE_COUNT] = __TEMP_DIR "/big";
+        zpl_file_write_contents(paths[FILE_COUNT], big, big_size, NULL);
+
+        zpl_file archive;
+        EQUALS(zpl_file_create(&archive, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_tar_pack(&archive, paths, FILE_COUNT + 1), 0);
+        zpl_file_close(&archive);
+
+        EQUALS(zpl_file_open(&archive, __TEMP_FILE), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_tar_unpack_dir_parallel(&archive, __TEMP_DIR "/out", 4), 0);
+        zpl_file_close(&archive);
+
+        zpl_isize matches = 0;
+        for (int i = 0; i <= FILE_COUNT; i++) {
+            zpl_snprintf(path, zpl_size_of(path), __TEMP_DIR "/out/%s", paths[i]);
+            zpl_file_contents a = zpl_file_read_contents(zpl_heap(), false, paths[i]);
+            zpl_file_contents b = zpl_file_read_contents(zpl_heap(), false, path);
+            if (a.size == b.size && !zpl_memcompare(a.data, b.data, a.size)) matches++;
+            zpl_file_free_contents(&a);
+            zpl_file_free_contents(&b);
+            zpl_fs_remove(path);
+            zpl_fs_remove(paths[i]);
+        }
+        EQUALS(matches, FILE_COUNT + 1);
+
+        for (int i = 0; i < FILE_COUNT; i++) zpl_free(zpl_heap(), cast(void *)paths[i]);
+        zpl_free(zpl_heap(), big);
+        zpl_path_rmdir(__TEMP_DIR "/out/" __TEMP_DIR);
+        zpl_path_rmdir(__TEMP_DIR "/out");
+        zpl_path_rmdir(__TEMP_DIR);
+        zpl_fs_remove(__TEMP_FILE);
+    });
+});
+
+#undef __TEMP_FILE
+#undef __TEMP_DIR
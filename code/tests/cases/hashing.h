@@ -1,3 +1,26 @@
+/* bit by bit reference for the reflected CRCs, register in and out without inversion */
+static zpl_u64 crc_reference(zpl_u64 crc, zpl_u64 poly, zpl_u8 const *data, zpl_isize len) {
+    for (zpl_isize i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (poly & (0 - (crc & 1)));
+    }
+    return crc;
+}
+
+/* bit by bit reference, independent of the table driven codecs */
+static zpl_isize base64_reference(char *out, zpl_u8 const *data, zpl_isize len, char const *chars) {
+    zpl_isize n = 0;
+    for (zpl_isize bit = 0; bit < len * 8; bit += 6) {
+        zpl_u32 v = 0;
+        for (zpl_isize k = bit; k < bit + 6; k++) {
+            v = v << 1 | (k < len * 8 ? (data[k / 8] >> (7 - k % 8)) & 1 : 0);
+        }
+        out[n++] = chars[v];
+    }
+    while (n % 4) out[n++] = '=';
+    return n;
+}
+
 MODULE(hashing, {
     const char test[] = "Hello World!";
     zpl_isize len = zpl_strlen(test);
@@ -17,6 +40,59 @@ MODULE(hashing, {
         UEQUALS(sum, 0x5434e638d5449866);
     });
 
+    IT("calculates the CRC check values", {
+        EQUALS(zpl_crc32("123456789", 9), 0xcbf43926);
+        EQUALS(zpl_crc32c("123456789", 9), 0xe3069283);
+        UEQUALS(zpl_crc64("123456789", 9), 0xe9c6d914c4b8d9caull);
+        EQUALS(zpl_crc32c(test, len), 0xfe6cf1dc);
+        EQUALS(zpl_crc32(NULL, 0), 0);
+    });
+
+    IT("calculates CRCs the same way with every instruction set", {
+        zpl_simd_level levels[] = { ZPL_SIMD_SCALAR, ZPL_SIMD_SSE2, ZPL_SIMD_AVX2, ZPL_SIMD_NEON };
+        zpl_simd_level prev = zpl_simd_level_get();
+        zpl_u8 data[2100];
+        zpl_isize mismatches = 0;
+        zpl_u32 seed = 5;
+
+        for (zpl_isize i = 0; i < zpl_size_of(data); i++) {
+            seed = seed * 1103515245 + 12345;
+            data[i] = cast(zpl_u8)(seed >> 16);
+        }
+
+        for (zpl_isize l = 0; l < zpl_count_of(levels); l++) {
+            zpl_simd_level_set(levels[l]);
+            for (zpl_isize len = 0; len < 2048; len += 1 + len / 32) {
+                zpl_u8 const *s = data + len % 13;
+                mismatches += zpl_crc32(s, len) != cast(zpl_u32)~crc_reference(0xffffffff, 0xedb88320, s, len);
+                mismatches += zpl_crc32c(s, len) != cast(zpl_u32)~crc_reference(0xffffffff, 0x82f63b78, s, len);
+                mismatches += zpl_crc64(s, len) != crc_reference(0, 0x95ac9329ac4bc9b5ull, s, len);
+            }
+        }
+
+        zpl_simd_level_set(prev);
+        EQUALS(mismatches, 0);
+    });
+
+    IT("continues CRCs over pieces", {
+        zpl_u8 data[3000];
+        zpl_u32 seed = 9;
+        for (zpl_isize i = 0; i < zpl_size_of(data); i++) data[i] = cast(zpl_u8)(i ^ (i >> 7));
+
+        zpl_u32 c32 = 0, c32c = 0;
+        zpl_u64 c64 = 0;
+        for (zpl_isize off = 0, step; off < zpl_size_of(data); off += step) {
+            seed = seed * 1103515245 + 12345;
+            step = zpl_min((seed >> 16) % 700, zpl_size_of(data) - off);
+            c32 = zpl_crc32_update(c32, data + off, step);
+            c32c = zpl_crc32c_update(c32c, data + off, step);
+            c64 = zpl_crc64_update(c64, data + off, step);
+        }
+        EQUALS(c32, zpl_crc32(data, zpl_size_of(data)));
+        EQUALS(c32c, zpl_crc32c(data, zpl_size_of(data)));
+        UEQUALS(c64, zpl_crc64(data, zpl_size_of(data)));
+    });
+
     IT("calculates valid fnv32", {
         zpl_u32 sum = zpl_fnv32(test, len);
         EQUALS(sum, 0x12a9a41c);
@@ -77,4 +153,181 @@ MODULE(hashing, {
         zpl_mfree(enc);
         zpl_mfree(dec);
     });
+
+    IT("encodes the RFC 4648 test vectors", {
+        char const *plain[] = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+        char const *encoded[] = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+        char const *unpadded[] = { "", "Zg", "Zm8", "Zm9v", "Zm9vYg", "Zm9vYmE", "Zm9vYmFy" };
+        char buf[16];
+
+        for (zpl_isize i = 0; i < zpl_count_of(plain); i++) {
+            zpl_isize n = zpl_strlen(plain[i]);
+            EQUALS(zpl_base64_encode_to(buf, plain[i], n, 0), zpl_base64_encoded_len(n, 0));
+            STRCEQUALS(buf, encoded[i], zpl_base64_encoded_len(n, 0));
+            EQUALS(zpl_base64_encode_to(buf, plain[i], n, ZPL_BASE64_NO_PAD), zpl_strlen(unpadded[i]));
+            STRCEQUALS(buf, unpadded[i], zpl_strlen(unpadded[i]));
+
+            EQUALS(zpl_base64_decode_to(buf, encoded[i], zpl_strlen(encoded[i]), 0), n);
+            STRCEQUALS(buf, plain[i], n);
+            EQUALS(zpl_base64_decode_to(buf, unpadded[i], zpl_strlen(unpadded[i]), 0), n);
+            STRCEQUALS(buf, plain[i], n);
+        }
+    });
+
+    IT("uses the URL-safe alphabet", {
+        zpl_u8 const data[] = { 0xfb, 0xff, 0xfe, 0x3e };
+        char buf[16];
+
+        EQUALS(zpl_base64_encode_to(buf, data, 4, 0), 8);
+        STRCEQUALS(buf, "+//+Pg==", 8);
+        EQUALS(zpl_base64_encode_to(buf, data, 4, ZPL_BASE64_URL | ZPL_BASE64_NO_PAD), 6);
+        STRCEQUALS(buf, "-__-Pg", 6);
+
+        EQUALS(zpl_base64_decode_to(buf, "-__-Pg", 6, ZPL_BASE64_URL), 4);
+        EQUALS(zpl_memcompare(buf, data, 4), 0);
+        EQUALS(zpl_base64_decode_to(buf, "-__-Pg", 6, 0), -1);
+        EQUALS(zpl_base64_decode_to(buf, "+//+Pg==", 8, ZPL_BASE64_URL), -1);
+    });
+
+    IT("rejects malformed base64", {
+        char const *bad[] = { "Z", "Zg=", "Zg===", "Zm9vY", "Zm9v Zg==", "Zg==Zg==", "Zm9v\n", "Z\x80==", "=Zg=" };
+        char buf[16];
+        for (zpl_isize i = 0; i < zpl_count_of(bad); i++) {
+            EQUALS(zpl_base64_decode_to(buf, bad[i], zpl_strlen(bad[i]), 0), -1);
+        }
+        EQUALS(cast(zpl_uintptr)zpl_base64_decode(zpl_heap(), "Zm9v!", 5), cast(zpl_uintptr)NULL);
+    });
+
+    IT("codes base64 the same way with every instruction set", {
+        zpl_simd_level levels[] = { ZPL_SIMD_SCALAR, ZPL_SIMD_SSE2, ZPL_SIMD_AVX2, ZPL_SIMD_NEON };
+        zpl_simd_level prev = zpl_simd_level_get();
+        zpl_u8 data[400], dec[400];
+        char enc[600], ref[600];
+        zpl_isize mismatches = 0;
+        zpl_u32 seed = 11;
+
+        for (zpl_isize i = 0; i < zpl_size_of(data); i++) {
+            seed = seed * 1103515245 + 12345;
+            data[i] = cast(zpl_u8)(seed >> 16);
+        }
+
+        for (zpl_isize l = 0; l < zpl_count_of(levels); l++) {
+            zpl_simd_level_set(levels[l]);
+            for (zpl_isize f = 0; f < 2; f++) {
+                zpl_u32 flags = f ? ZPL_BASE64_URL : 0;
+                char const *chars = f ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+                                      : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+                for (zpl_isize len = 0; len < zpl_size_of(data); len += 1 + len / 16) {
+                    zpl_isize n = zpl_base64_encode_to(enc, data, len, flags);
+                    mismatches += n != base64_reference(ref, data, len, chars);
+                    mismatches += zpl_memcompare(enc, ref, n) != 0;
+                    mismatches += zpl_base64_decode_to(dec, enc, n, flags) != len;
+                    mismatches += zpl_memcompare(dec, data, len) != 0;
+
+                    /* a stray character anywhere, including inside a vector block, fails the whole input */
+                    if (n > 4) {
+                        enc[n / 3] = '.';
+                        mismatches += zpl_base64_decode_to(dec, enc, n, flags) != -1;
+                    }
+                }
+            }
+        }
+
+        zpl_simd_level_set(prev);
+        EQUALS(mismatches, 0);
+    });
+
+    IT("encodes base64 in pieces", {
+        zpl_u8 data[1000];
+        char whole[1400], pieces[1400];
+        zpl_base64_stream stream;
+        zpl_u32 seed = 3;
+        zpl_isize n = 0;
+
+        for (zpl_isize i = 0; i < zpl_size_of(data); i++) data[i] = cast(zpl_u8)(i * 7 + (i >> 3));
+
+        for (zpl_u32 flags = 0; flags < 4; flags++) {
+            zpl_isize expected = zpl_base64_encode_to(whole, data, zpl_size_of(data), flags);
+            zpl_base64_stream_init(&stream, flags);
+            n = 0;
+            for (zpl_isize off = 0, step; off < zpl_size_of(data); off += step) {
+                seed = seed * 1103515245 + 12345;
+                step = zpl_min((seed >> 16) % 90, zpl_size_of(data) - off);
+                zpl_isize w = zpl_base64_stream_encode(&stream, pieces + n, data + off, step);
+                EQUALS((w <= zpl_base64_stream_len(step)), true);
+                n += w;
+            }
+            n += zpl_base64_stream_finish(&stream, pieces + n);
+            EQUALS(n, expected);
+            STRCEQUALS(pieces, whole, expected);
+        }
+    });
+    IT("matches the wyhash reference vectors", {
+        static char const *const vectors[] = {
+            "", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+            "12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+        };
+        static zpl_u64 const expected[] = {
+            0x93228a4de0eec5a2ull, 0xc5bac3db178713c4ull, 0xa97f2f7b1d9b3314ull, 0x786d1f1df3801df4ull,
+            0xdca5a8138ad37c87ull, 0xb9e734f117cfaf70ull, 0x6cc5eab49a92d617ull,
+        };
+        for (zpl_isize i = 0; i < zpl_count_of(vectors); i++) {
+            UEQUALS(zpl_hash64_seed(vectors[i], zpl_strlen(vectors[i]), i), expected[i]);
+        }
+        UEQUALS(zpl_hash64("abc", 3), 0x989b4a209c1011c9ull);
+
+        zpl_hash128 h = zpl_hash128_seed("abc", 3, 0);
+        UEQUALS(h.lo, 0x989b4a209c1011c9ull);
+        UEQUALS(h.hi, 0x78a2299da8334db2ull);
+        h = zpl_hash128_seed(vectors[5], 62, 0);
+        UEQUALS(h.lo, 0x1fdd130ecb5b4709ull);
+        UEQUALS(h.hi, 0x91f84707f0fa5f03ull);
+    });
+
+    IT("hashes in pieces the same way as in one go", {
+        zpl_u8 data[400];
+        zpl_u32 seed = 7;
+        zpl_hash_key key;
+        zpl_hash_state state;
+        for (zpl_isize i = 0; i < zpl_count_of(data); i++) {
+            seed = seed * 1103515245 + 12345;
+            data[i] = cast(zpl_u8)(seed >> 16);
+        }
+        zpl_hash_key_init(&key, 0x1234);
+
+        for (zpl_isize len = 0; len <= zpl_count_of(data); len += (len < 100 ? 1 : 37)) {
+            for (zpl_isize piece = 1; piece <= 97; piece += 16) {
+                zpl_hash_state_init(&state, len);
+                for (zpl_isize at = 0; at < len; at += piece) {
+                    EQUALS((zpl_hash_state_digest(&state) == zpl_hash64_seed(data, at, len)), true);
+                    zpl_hash_state_update(&state, data + at, zpl_min(piece, len - at));
+                }
+                UEQUALS(zpl_hash_state_digest(&state), zpl_hash64_seed(data, len, len));
+            }
+            zpl_hash_state_init_keyed(&state, &key);
+            zpl_hash_state_update(&state, data, len / 3);
+            zpl_hash_state_update(&state, data + len / 3, len - len / 3);
+            UEQUALS(zpl_hash_state_digest(&state), zpl_hash64_keyed(data, len, &key));
+        }
+    });
+
+    IT("derives private secrets from the key", {
+        zpl_hash_key a, b;
+        zpl_hash_key_init(&a, 0x7a706c2068617368ull);
+        zpl_hash_key_init(&b, 0x7a706c2068617369ull);
+
+        /* the defaults for the upper word come from the same procedure */
+        for (int i = 0; i < 4; i++) UEQUALS(a.secret[i], zpl__hash_secret[4 + i]);
+        for (int i = 0; i < 8; i++) {
+            EQUALS((a.secret[i] & 1), 1);
+            EQUALS((a.secret[i] != b.secret[i]), true);
+        }
+
+        zpl_hash128 h = zpl_hash128_keyed(test, len, &a);
+        UEQUALS(h.lo, zpl_hash64_keyed(test, len, &a));
+        EQUALS((h.lo != h.hi), true);
+        EQUALS((h.lo != zpl_hash64_keyed(test, len, &b)), true);
+        EQUALS((h.lo != zpl_hash64_seed(test, len, a.seed)), true);
+    });
 });
@@ -49,6 +49,22 @@ MODULE(json5_parser, {
         EQUALS(err, ZPL_JSON_ERROR_UNKNOWN_KEYWORD);
     });
 
+    IT("validates UTF-8 on request", {
+        zpl_string t = zpl_string_make(mem_alloc, "{ \"name\": \"\xc5\xbelu\xc5\xa5ou\xc4\x8dk\xc3\xbd k\xc5\xaf\xc5\x88\" }");
+        zpl_json_object r = {0};
+        EQUALS(zpl_json_parse_ex(&r, t, mem_alloc, ZPL_JSON_PARSE_VALIDATE_UTF8), ZPL_JSON_ERROR_NONE);
+        STREQUALS(r.nodes[0].string, "\xc5\xbelu\xc5\xa5ou\xc4\x8dk\xc3\xbd k\xc5\xaf\xc5\x88");
+        zpl_json_free(&r);
+        zpl_string_free(t);
+
+        /* a surrogate encoded as UTF-8 */
+        t = zpl_string_make(mem_alloc, "{ \"name\": \"\xed\xa0\x80\" }");
+        EQUALS(zpl_json_parse_ex(&r, t, mem_alloc, ZPL_JSON_PARSE_VALIDATE_UTF8), ZPL_JSON_ERROR_INVALID_UTF8);
+        EQUALS(zpl_json_parse(&r, t, mem_alloc), ZPL_JSON_ERROR_NONE);
+        zpl_json_free(&r);
+        zpl_string_free(t);
+    });
+
     IT("parses commented JSON5 object", {
         zpl_string t = zpl_string_make(mem_alloc, "{/* TEST CODE */ \"a\": 123 }");
         __PARSE();
@@ -188,6 +204,77 @@ MODULE(json5_parser, {
         EQUALS(r.nodes[3].base2_offset, 2);
     });
 
+    IT("parses real numbers with correct rounding", {
+        zpl_string t = zpl_string_make(mem_alloc, ZPL_MULTILINE(\
+                [
+                    0.1,
+                    0.30000000000000004,
+                    2.2250738585072014e-308,
+                    1.7976931348623157e308,
+                    9007199254740993.0,
+                    1.00000000000000011102230246251565404236316680908203126,
+                    123456789012345678901234567890.5,
+                    1e5,
+                    5e-1
+                ]));
+        __PARSE();
+
+        EQUALS(err, ZPL_JSON_ERROR_NONE);
+        EQUALS(r.nodes[0].real, 0.1);
+        EQUALS(r.nodes[1].real, 0.30000000000000004);
+        EQUALS(r.nodes[2].real, 2.2250738585072014e-308);
+        EQUALS(r.nodes[3].real, 1.7976931348623157e308);
+        EQUALS(r.nodes[4].real, 9007199254740992.0);
+        EQUALS(r.nodes[5].real, 1.0000000000000002);
+        EQUALS(r.nodes[6].real, 123456789012345678901234567890.5);
+        EQUALS(r.nodes[7].type, ZPL_ADT_TYPE_INTEGER);
+        EQUALS(r.nodes[7].integer, 100000);
+        EQUALS(r.nodes[8].type, ZPL_ADT_TYPE_REAL);
+        EQUALS(r.nodes[8].real, 0.5);
+    });
+
+    IT("parses integers with large exponents as reals", {
+        zpl_string t = zpl_string_make(mem_alloc, "[1e5, 1e19, 1e300, 1E400, -9e18, -1e19, 92233720368547758e2, 0e999999, 1e0000000000000000002]");
+        __PARSE();
+
+        EQUALS(err, ZPL_JSON_ERROR_NONE);
+        EQUALS(r.nodes[0].type, ZPL_ADT_TYPE_INTEGER);
+        EQUALS(r.nodes[0].integer, 100000);
+        EQUALS(r.nodes[1].type, ZPL_ADT_TYPE_REAL);
+        EQUALS(r.nodes[1].real, 1e19);
+        EQUALS(r.nodes[2].type, ZPL_ADT_TYPE_REAL);
+        EQUALS(r.nodes[2].real, 1e300);
+        EQUALS(r.nodes[3].type, ZPL_ADT_TYPE_REAL);
+        EQUALS((r.nodes[3].real > ZPL_F64_MAX), true);
+        EQUALS(r.nodes[4].type, ZPL_ADT_TYPE_INTEGER);
+        EQUALS((r.nodes[4].integer == -9000000000000000000ll), true);
+        EQUALS(r.nodes[5].type, ZPL_ADT_TYPE_REAL);
+        EQUALS(r.nodes[5].real, -1e19);
+        EQUALS(r.nodes[6].type, ZPL_ADT_TYPE_INTEGER);
+        EQUALS((r.nodes[6].integer == 9223372036854775800ll), true);
+        EQUALS(r.nodes[7].type, ZPL_ADT_TYPE_INTEGER);
+        EQUALS(r.nodes[7].integer, 0);
+        EQUALS(r.nodes[8].type, ZPL_ADT_TYPE_INTEGER);
+        EQUALS(r.nodes[8].integer, 100);
+    });
+
+    IT("writes real numbers that parse back exactly", {
+        zpl_string t = zpl_string_make(mem_alloc, "[0.1, -2.5e-7, 1.5e300, .5, -0.0, 3.0, 0.30000000000000004, 4.9e-324]");
+        __PARSE();
+        EQUALS(err, ZPL_JSON_ERROR_NONE);
+
+        zpl_string a = zpl_json_write_string(mem_alloc, &r, 0);
+        STREQUALS("[\n    0.1,\n    -2.5e-7,\n    1.5e+300,\n    .5,\n    -0.0,\n    3.0,\n    0.30000000000000004,\n    5.0e-324\n]\n", a);
+
+        zpl_json_object r2={0};
+        err = zpl_json_parse(&r2, a, mem_alloc);
+        EQUALS(err, ZPL_JSON_ERROR_NONE);
+        for (zpl_isize i = 0; i < zpl_array_count(r.nodes); i++) {
+            EQUALS(r2.nodes[i].type, ZPL_ADT_TYPE_REAL);
+            EQUALS(r2.nodes[i].real, r.nodes[i].real);
+        }
+    });
+
     IT("parses minified JSON array", {
         zpl_string t = zpl_string_make(mem_alloc, "[{\"Name\":\"ATLAS0.png\",\"Width\":256,\"Height\":128,\"Images\":[{\"Name\":\"4\",\"X\":0,\"Y\":0,\"Width\":40,\"Height\":27,\"FrameX\":0,\"FrameY\":0,\"FrameW\":40,\"FrameH\":27},{\"Name\":\"0\",\"X\":41,\"Y\":0,\"Width\":40,\"Height\":27,\"FrameX\":0,\"FrameY\":0,\"FrameW\":40,\"FrameH\":27},{\"Name\":\"6\",\"X\":82,\"Y\":0,\"Width\":33,\"Height\":35,\"FrameX\":0,\"FrameY\":0,\"FrameW\":33,\"FrameH\":35},{\"Name\":\"2\",\"X\":0,\"Y\":28,\"Width\":33,\"Height\":35,\"FrameX\":0,\"FrameY\":0,\"FrameW\":33,\"FrameH\":35},{\"Name\":\"7\",\"X\":36,\"Y\":28,\"Width\":31,\"Height\":38,\"FrameX\":0,\"FrameY\":0,\"FrameW\":31,\"FrameH\":38},{\"Name\":\"3\",\"X\":118,\"Y\":0,\"Width\":31,\"Height\":38,\"FrameX\":0,\"FrameY\":0,\"FrameW\":31,\"FrameH\":38},{\"Name\":\"5\",\"X\":157,\"Y\":0,\"Width\":37,\"Height\":34,\"FrameX\":0,\"FrameY\":0,\"FrameW\":37,\"FrameH\":34},{\"Name\":\"1\",\"X\":118,\"Y\":32,\"Width\":37,\"Height\":34,\"FrameX\":0,\"FrameY\":0,\"FrameW\":37,\"FrameH\":34}],\"IsRotated\":true,\"IsTrimmed\":false,\"IsPremultiplied\":false}]");
         __PARSE();
@@ -251,6 +338,42 @@ MODULE(json5_parser, {
         STREQUALS(original, a);
     });
 
+    IT("writes into a reusable string buffer", {
+        /* large enough to need several flushes of the staging buffer */
+        zpl_json_object doc;
+        zpl_adt_set_arr(&doc, NULL, zpl_heap());
+        for (zpl_isize i = 0; i < 4000; i++) {
+            zpl_adt_append_int(&doc, NULL, i);
+        }
+
+        zpl_string a = zpl_json_write_string(zpl_heap(), &doc, 0);
+        zpl_string b = zpl_string_make(zpl_heap(), "");
+        EQUALS(zpl_json_write_append(&b, &doc, 0), true);
+        STREQUALS(a, b);
+
+        /* a cleared buffer keeps its capacity */
+        char *before = b;
+        zpl_isize capacity = zpl_string_capacity(b);
+        zpl_string_clear(b);
+        EQUALS(zpl_json_write_append(&b, &doc, 0), true);
+        EQUALS(b, before);
+        EQUALS(zpl_string_capacity(b), capacity);
+        STREQUALS(a, b);
+
+        zpl_file f;
+        zpl_isize size = 0;
+        zpl_file_stream_new(&f, zpl_heap());
+        EQUALS(zpl_json_write(&f, &doc, 0), true);
+        zpl_u8 *buf = zpl_file_stream_buf(&f, &size);
+        EQUALS(size, zpl_string_length(a));
+        EQUALS(zpl_memcompare(buf, a, size), 0);
+
+        zpl_file_close(&f);
+        zpl_string_free(a);
+        zpl_string_free(b);
+        zpl_json_free(&doc);
+    });
+
     IT("handles out of memory during parse", {
         zpl_string t = zpl_string_make(mem_alloc, ZPL_MULTILINE(\
                 {
@@ -334,8 +457,8 @@ MODULE(json5_parser, {
                     "        \"test3.1\": 456\n"
                     "    },\n"
                     "    \"test4\": [789],\n"
-                    "    \"test5\": 1.000000,\n"
-                    "    \"test6\": 0,\n"
+                    "    \"test5\": 1.0,\n"
+                    "    \"test6\": 0.0,\n"
                     "    \"test7\": \"foo\",\n"
                     "    \"test8\": \"bar\",\n"
                     "    \"test9\": \"test\"\n"
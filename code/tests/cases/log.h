@@ -0,0 +1,138 @@
+#define __LOG_THREADS 4
+#define __LOG_RECORDS 5000
+
+static zpl_b32 log_contains(zpl_file *f, char const *needle) {
+    zpl_isize size;
+    char *buf = (char *)zpl_file_stream_buf(f, &size);
+    zpl_string text = zpl_string_make_length(zpl_heap(), buf, size);
+    zpl_b32 found = strstr(text, needle) != NULL;
+    zpl_string_free(text);
+    return found;
+}
+
+static zpl_isize log_producer(struct zpl_thread *thread) {
+    zpl_logger *logger = (zpl_logger *)thread->user_data;
+    for (zpl_isize i = 0; i < __LOG_RECORDS; i++) {
+        ZPL_LOG_INFO(logger, "thread %td record %td", thread->user_index, i);
+    }
+    return 0;
+}
+
+MODULE(log, {
+    zpl_logger logger;
+    zpl_file f;
+
+    IT("formats the captured arguments on the flusher thread", {
+        char name[16] = "first";
+        zpl_file_stream_new(&f, zpl_heap());
+        zpl_logger_init(&logger, zpl_heap(), &f, ZPL_LOG_LEVEL_NAME);
+
+        ZPL_LOG_INFO(&logger, "%s: %d, %5.2f|%-4u|%*d|%.3s %%", name, -42, 3.14159, 7u, 5, 9, "abcdef");
+        ZPL_LOG_WARN(&logger, "null %s, %c%c", (char *)NULL, 'o', 'k');
+        zpl_strcpy(name, "second"); /* strings are copied when logged */
+        ZPL_LOG_ERROR(&logger, "no arguments");
+        zpl_logger_flush(&logger);
+
+        zpl_isize size;
+        zpl_u8 *buf = zpl_file_stream_buf(&f, &size);
+        STRCEQUALS((char *)buf, "INFO  first: -42,  3.14|7   |    9|abc %\n"
+                                "WARN  null (null), ok\n"
+                                "ERROR no arguments\n", size);
+
+        zpl_log_stats stats;
+        zpl_logger_stats(&logger, &stats);
+        EQUALS(stats.records, 3);
+        EQUALS(stats.dropped, 0);
+        EQUALS(stats.bytes, size);
+
+        zpl_logger_free(&logger);
+        zpl_file_close(&f);
+    });
+
+    IT("filters records below the runtime level", {
+        zpl_file_stream_new(&f, zpl_heap());
+        zpl_logger_init(&logger, zpl_heap(), &f, ZPL_LOG_LOCATION);
+        zpl_logger_set_level(&logger, ZPL_LOG_LEVEL_WARN);
+
+        ZPL_LOG_DEBUG(&logger, "hidden");
+        ZPL_LOG_INFO(&logger, "hidden");
+        ZPL_LOG_WARN(&logger, "shown");
+        zpl_logger_free(&logger);
+
+        EQUALS(log_contains(&f, "log.h:"), true);
+        EQUALS(log_contains(&f, ": shown\n"), true);
+        EQUALS(log_contains(&f, "hidden"), false);
+        zpl_file_close(&f);
+    });
+
+    IT("drops records whose format differs from the one the site was compiled from", {
+        zpl_local_persist zpl_log_site site = { ZPL_LOG_LEVEL_INFO, __FILE__, __LINE__ };
+        char const *literal = "first %d";
+        char copy[] = "first %d"; /* same text, but gone once the call returns */
+        zpl_file_stream_new(&f, zpl_heap());
+        zpl_logger_init(&logger, zpl_heap(), &f, 0);
+
+        EQUALS(zpl_log_write(&logger, &site, literal, 1), true);
+        EQUALS(zpl_log_write(&logger, &site, copy, 2), false);
+        zpl_logger_flush(&logger);
+
+        zpl_log_stats stats;
+        zpl_logger_stats(&logger, &stats);
+        EQUALS(stats.records, 1);
+        EQUALS(stats.dropped, 1);
+        zpl_logger_free(&logger);
+
+        EQUALS(log_contains(&f, "first 1\n"), true);
+        EQUALS(log_contains(&f, "first 2"), false);
+        zpl_file_close(&f);
+    });
+
+    IT("prints the timestamp as UTC", {
+        zpl_file_stream_new(&f, zpl_heap());
+        zpl_logger_init(&logger, zpl_heap(), &f, ZPL_LOG_TIMESTAMP);
+
+        zpl__log_writer w = { 0 };
+        w.logger = &logger;
+        w.second = ZPL_U64_MAX;
+        STRCEQUALS(zpl__log_stamp(&w, 13253813593098ull), "2020-12-30 14:53:13.098 ", 24);
+        STRCEQUALS(zpl__log_stamp(&w, 13253813593999ull), "2020-12-30 14:53:13.999 ", 24);
+        STRCEQUALS(zpl__log_stamp(&w, 13253813594000ull), "2020-12-30 14:53:14.000 ", 24);
+
+        zpl_logger_free(&logger);
+        zpl_file_close(&f);
+    });
+
+    IT("collects records from several threads without losing any", {
+        zpl_thread threads[__LOG_THREADS];
+        /* NOTE: written in place, the flusher must not allocate while the heap stats are tracked from other threads */
+        zpl_isize cap = __LOG_THREADS * __LOG_RECORDS * 32;
+        char *buf = (char *)zpl_alloc(zpl_heap(), cap);
+        zpl_file_stream_open(&f, zpl_heap(), (zpl_u8 *)buf, cap, ZPL_FILE_STREAM_WRITABLE);
+        zpl_logger_init(&logger, zpl_heap(), &f, ZPL_LOG_BLOCK);
+
+        for (zpl_isize i = 0; i < __LOG_THREADS; i++) {
+            zpl_thread_init(&threads[i]);
+            threads[i].user_index = i;
+            zpl_thread_start(&threads[i], log_producer, &logger);
+        }
+        for (zpl_isize i = 0; i < __LOG_THREADS; i++) {
+            zpl_thread_destroy(&threads[i]);
+        }
+        zpl_logger_flush(&logger);
+
+        zpl_log_stats stats;
+        zpl_logger_stats(&logger, &stats);
+        EQUALS(stats.records, __LOG_THREADS * __LOG_RECORDS);
+        EQUALS(stats.dropped, 0);
+
+        zpl_isize lines = 0;
+        for (zpl_isize i = 0; i < stats.bytes; i++) lines += (buf[i] == '\n');
+        EQUALS(lines, __LOG_THREADS * __LOG_RECORDS);
+        buf[stats.bytes] = '\0';
+        EQUALS((strstr(buf, "thread 3 record 4999\n") != NULL), true);
+
+        zpl_logger_free(&logger);
+        zpl_file_close(&f);
+        zpl_free(zpl_heap(), buf);
+    });
+});
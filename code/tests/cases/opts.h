@@ -0,0 +1,21 @@
+MODULE(opts, {
+    IT("keeps short string values inline and long ones on the heap", {
+        char app[] = "app", out[] = "--out=a.txt", dir[] = "--dir=/a/rather/long/directory/path", n[] = "-n", count[] = "12";
+        char *argv[] = { app, out, dir, n, count };
+        zpl_opts opts;
+        zpl_opts_init(&opts, zpl_heap(), "app");
+        zpl_opts_add(&opts, "o", "out", "output file", ZPL_OPTS_STRING);
+        zpl_opts_add(&opts, "d", "dir", "output directory", ZPL_OPTS_STRING);
+        zpl_opts_add(&opts, "n", "count", "repetitions", ZPL_OPTS_INT);
+
+        EQUALS(zpl_opts_compile(&opts, zpl_count_of(argv), argv), true);
+        STREQUALS(zpl_opts_string(&opts, "out", ""), "a.txt");
+        STREQUALS(zpl_opts_string(&opts, "dir", ""), "/a/rather/long/directory/path");
+        STREQUALS(zpl_opts_string(&opts, "missing", "none"), "none");
+        EQUALS(zpl_opts_integer(&opts, "count", 0), 12);
+        EQUALS(zpl_string_sso_is_inline(&opts.entries[0].text), true);
+        EQUALS(zpl_string_sso_is_inline(&opts.entries[1].text), false);
+
+        zpl_opts_free(&opts);
+    });
+});
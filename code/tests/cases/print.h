@@ -9,13 +9,18 @@ MODULE(print, {
     RUN("can print fixed-size string", "conven", "%.6s", "convenience");
     RUN("can print variable-sized string", "conven", "%.*s", 6, "convenience");
     RUN("can print float with fixed precision", "5.42", "%.2f", 5.423559);
-    RUN("can print float with variable-width precision", "5.423", "%.*f", 3, 5.423559);
+    RUN("can print float with variable-width precision", "5.424", "%.*f", 3, 5.423559);
     RUN("can print a number with padded zeroes", "2.500", "%.3f", 2.5);
+    RUN("can print float rounded from its exact value", "2.67 0.12 0.2 1", "%.2f %.2f %.1f %.0f", 2.675, 0.125, 0.25, 0.5000001);
+    RUN("can print float in exponent notation", "1.234568e+04 1.0E-300 0e+00", "%e %.1E %.0e", 12345.678, 1e-300, 0.0);
+    RUN("can print float in general notation", "0.0001234 1e+20 1.5E-10 100 100.000", "%g %g %G %g %#g", 0.0001234, 1e20, 1.5e-10, 100.0, 100.0);
+    RUN("can print float with sign and padding", "-003.142|1.50e+00  |+inf", "%08.3f|%-10.2e|%+f", -3.14159, 1.5, ZPL_INFINITY);
     RUN("can print octal numbers", "0666", "0%o", 0666);
     RUN("can print hexadecimal numbers", "0xDEADBEEF", "0x%X", 0xDEADBEEF);
     RUN("can print hexadecimal numbers (lowercase)", "0xdeadbeef", "0x%x", 0xdeadbeef);
     RUN("can print table data", "* worker 1  hits: 1234     idle: 34 cy.", "* worker %-2u hits: %-8d idle: %d cy.", 1, 1234, 34);
     RUN("can pad text out with arbitrary symbol and width", "==== hello", "%4r hello", '=');
+    RUN("prints nothing for an explicit zero width in every base", "[][][][][][]", "[%0d][%+0u][%0c][%#0o][%0x][%0s]", 42, 42u, 'x', 8u, 42u, "str");
 
     IT("can allocate formatted string", {
         char *test;
@@ -26,8 +31,104 @@ MODULE(print, {
         zpl_mfree(test);
     });
 
+    IT("can print shortest round-trip floating-point value", {
+        char buf[32];
+        zpl_f64_to_str(0.1, buf);
+        STREQUALS("0.1", buf);
+        zpl_f64_to_str(0.30000000000000004, buf);
+        STREQUALS("0.30000000000000004", buf);
+        zpl_f64_to_str(-1234.5, buf);
+        STREQUALS("-1234.5", buf);
+        zpl_f64_to_str(1e21, buf);
+        STREQUALS("1e+21", buf);
+        zpl_f64_to_str(1.5e-7, buf);
+        STREQUALS("1.5e-7", buf);
+        zpl_f64_to_str(5e-324, buf);
+        STREQUALS("5e-324", buf);
+        zpl_f64_to_str(1.7976931348623157e308, buf);
+        STREQUALS("1.7976931348623157e+308", buf);
+        EQUALS(zpl_str_to_f64(buf, NULL), 1.7976931348623157e308);
+    });
+
+    IT("stays within the buffer and reports truncation", {
+        char out[16];
+        zpl_memset(out, '#', zpl_size_of(out));
+        EQUALS(zpl_snprintf(out, 4, "hello world"), -1);
+        STREQUALS(out, "hel");
+        EQUALS(out[4], '#');
+
+        zpl_memset(out, '#', zpl_size_of(out));
+        EQUALS(zpl_snprintf(out, 5, "%6s|", "ab"), -1);
+        EQUALS(out[5], '#');
+        EQUALS(zpl_snprintf(out, 5, "%f", 3.5), -1);
+        STREQUALS(out, "3.50");
+        EQUALS(zpl_snprintf(out, 6, "%s", "hello"), 6);
+        STREQUALS(out, "hello");
+        EQUALS(zpl_snprintf(out, 9, "a%db%s", 12, "xy"), 7);
+        STREQUALS(out, "a12bxy");
+
+        /* hexadecimal output that exactly fills the space left is case-converted in place */
+        char *exact = cast(char *)zpl_alloc(zpl_heap(), 4);
+        EQUALS(zpl_snprintf(exact, 4, "%p", cast(void *)0x1234), -1);
+        STRCEQUALS(exact, "123", 3);
+        EQUALS(zpl_snprintf(exact, 4, "%X", 0xabcdu), -1);
+        STRCEQUALS(exact, "ABC", 3);
+        EQUALS(zpl_snprintf(exact, 4, "%x", 0xabcu), 4);
+        STREQUALS(exact, "abc");
+        zpl_free(zpl_heap(), exact);
+    });
+
+    IT("can print integer limits", {
+        char out[96];
+        zpl_snprintf(out, zpl_size_of(out), "%lld %lld %llu %d %u %5d|%-4d|%05d", (long long)ZPL_I64_MIN, (long long)ZPL_I64_MAX,
+                     (unsigned long long)ZPL_U64_MAX, 0, 4294967295u, 42, 7, -12);
+        STREQUALS(out, "-9223372036854775808 9223372036854775807 18446744073709551615 0 4294967295    42|7   |00-12");
+        zpl_i64_to_str(ZPL_I64_MIN, out, 10);
+        STREQUALS(out, "-9223372036854775808");
+    });
+
+    IT("formats with a pre-compiled plan", {
+        char a[128], b[128];
+        zpl_fmt plan;
+        char const *fmts[] = { "plain text", "%s [%5s] %-3d|%05u|%x|%llX %%", "%.*f|%*d|%c%4r|%08.3f|%e", "trailing %", "%y%d%" };
+
+        for (zpl_isize i = 0; i < zpl_count_of(fmts); i++) {
+            EQUALS(zpl_fmt_compile(&plan, fmts[i]), true);
+            EQUALS(zpl_fmt_snprintf(a, zpl_size_of(a), &plan, "log", "warn", 7, 42u, 0xbeefu, 0xabcdefull),
+                   zpl_snprintf(b, zpl_size_of(b), fmts[i], "log", "warn", 7, 42u, 0xbeefu, 0xabcdefull));
+            STREQUALS(a, b);
+        }
+
+        zpl_fmt_compile(&plan, fmts[2]);
+        zpl_fmt_snprintf(a, zpl_size_of(a), &plan, 2, 3.14159, -6, 5, 'x', '-', -2.5, 12345.678);
+        STREQUALS(a, "3.14|5     |x----|-002.500|1.234568e+04");
+
+        /* truncation is reported the same way */
+        zpl_fmt_compile(&plan, "value: %d, done");
+        EQUALS(zpl_fmt_snprintf(a, 10, &plan, 123456), -1);
+        STREQUALS(a, "value: 12");
+        EQUALS(zpl_fmt_snprintf(a, 14, &plan, 1), -1);
+        STREQUALS(a, "value: 1, don");
+        EQUALS(zpl_fmt_snprintf(a, 15, &plan, 1), 15);
+        STREQUALS(a, "value: 1, done");
+
+        zpl_fmt_compile(&plan, "%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d");
+        EQUALS(plan.count, ZPL_FMT_MAX_SPECS);
+        EQUALS(zpl_fmt_compile(&plan, "%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d"), false);
+    });
+
     IT("can print hexadecimal floating-point value", {
-        SKIP();
+        char buf[128];
+        zpl_snprintf(buf, zpl_size_of(buf), "[%a][%a][%a][%.2a][%A][%a][%.1a][%a][%.0a][%#.0a]",
+                     1.0, 0.1, -2.5, 1.0, 255.5, 4.9e-324, 1.96875, 0.0, 1.5, 1.0);
+        STREQUALS(buf, "[0x1p+0][0x1.999999999999ap-4][-0x1.4p+1][0x1.00p+0][0X1.FFP+7][0x0.0000000000001p-1022]"
+                       "[0x2.0p+0][0x0p+0][0x2p+0][0x1.p+0]");
+        zpl_snprintf(buf, zpl_size_of(buf), "[%12a][%-12a|][%012a][%+a][%.3a]", 1.0, 1.0, -1.0, 3.0, 1.99999);
+        STREQUALS(buf, "[      0x1p+0][0x1p+0      |][-0x000001p+0][+0x1.8p+1][0x2.000p+0]");
+        zpl_snprintf(buf, zpl_size_of(buf), "[%a][%A][%.20a]", 1.7976931348623157e308, -0.0, 0.1);
+        STREQUALS(buf, "[0x1.fffffffffffffp+1023][-0X0P+0][0x1.999999999999a0000000p-4]");
+        zpl_snprintf(buf, zpl_size_of(buf), "[%a][%.1a][%5.1a][%a]", 2.2250738585072014e-308, 1.03125, 0.546875, 1.0/0.0);
+        STREQUALS(buf, "[0x1p-1022][0x1.0p+0][0x1.2p-1][inf]");
     });
 });
 
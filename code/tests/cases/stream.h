@@ -39,4 +39,41 @@ MODULE(stream, {
         zpl_file_close(&f);
         zpl_string_free(hello);
     });
+
+    IT("grows a rope stream without moving written data", {
+        char buf[80] = {0};
+        zpl_file_iovec iov[8] = {0};
+        zpl_file_rope_new(&f, zpl_heap(), 8);
+        zpl_file_write(&f, "Hello", 5);
+        zpl_file_rope_iovec(&f, iov, 1);
+        void const *first = iov[0].data;
+        zpl_file_rope_append_ref(&f, test + 5, len - 5);
+        zpl_file_write(&f, " Bye!", 5);
+        EQUALS(zpl_file_size(&f), len + 5);
+        EQUALS(zpl_file_rope_iovec(&f, iov, 8), 3);
+        EQUALS((iov[0].data == first), true);
+        EQUALS((iov[1].data == test + 5), true);
+
+        /* overwriting the borrowed chunk copies it instead of touching the source */
+        zpl_file_write_at(&f, "w", 1, 6);
+        zpl_file_read_at(&f, buf, zpl_file_size(&f), 0);
+        STREQUALS(buf, "Hello world! Bye!");
+        STREQUALS(test, "Hello World!");
+
+        zpl_file out;
+        zpl_file_stream_new(&out, zpl_heap());
+        EQUALS(zpl_file_rope_write_to(&f, &out), true);
+        STRCEQUALS((char*)zpl_file_stream_buf(&out, 0), "Hello world! Bye!", len + 5);
+        zpl_file_close(&out);
+
+        /* OS files receive all chunks through writev */
+        EQUALS(zpl_file_temp(&out), ZPL_FILE_ERROR_NONE);
+        EQUALS(zpl_file_rope_write_to(&f, &out), true);
+        EQUALS(zpl_file_size(&out), len + 5);
+        zpl_memset(buf, 0, zpl_size_of(buf));
+        zpl_file_read_at(&out, buf, len + 5, 0);
+        STREQUALS(buf, "Hello world! Bye!");
+        zpl_file_close(&out);
+        zpl_file_close(&f);
+    });
 });
@@ -0,0 +1,333 @@
+typedef struct {
+    zpl_strmatch_hit hits[4096];
+    zpl_isize count;
+} strmatch_hits;
+
+static zpl_b32 strmatch_collect(zpl_strmatch_hit const *hit, void *user_data) {
+    strmatch_hits *h = cast(strmatch_hits *)user_data;
+    if (h->count < zpl_count_of(h->hits)) h->hits[h->count] = *hit;
+    h->count++;
+    return true;
+}
+
+MODULE(string, {
+    IT("scans strings the same way with every instruction set", {
+        zpl_simd_level levels[] = { ZPL_SIMD_SCALAR, ZPL_SIMD_SSE2, ZPL_SIMD_AVX2, ZPL_SIMD_NEON };
+        zpl_simd_level prev = zpl_simd_level_get();
+        char const alphabet[] = " \t\n\r\vab,;:xyz";
+        char buf[200];
+        zpl_isize mismatches = 0;
+        zpl_u32 seed = 7;
+
+        for (zpl_isize l = 0; l < zpl_count_of(levels); l++) {
+            zpl_simd_level_set(levels[l]);
+            for (zpl_isize off = 0; off < 40; off++) {
+                for (zpl_isize len = 0; len < 130; len++) {
+                    char *s = buf + off;
+                    for (zpl_isize i = 0; i < zpl_size_of(buf); i++) {
+                        seed = seed * 1103515245 + 12345;
+                        buf[i] = alphabet[(seed >> 16) % (zpl_size_of(alphabet) - 1)];
+                    }
+                    /* mostly leading whitespace, so trimming crosses block boundaries */
+                    for (zpl_isize i = 0; i < len / 2; i++) s[i] = (i % 3) ? ' ' : '\t';
+                    s[len] = '\0';
+
+                    char const *e, *sp = s, *spn = s, *any = s;
+                    for (e = s; *e && *e != 'x'; e++) {}
+                    while (zpl_char_is_space(*sp)) sp++;
+                    while (zpl_char_is_space(*spn) && *spn != '\n') spn++;
+                    while (*any && *any != ',' && *any != ';' && *any != 'z') any++;
+
+                    mismatches += zpl_strlen(s) != len;
+                    mismatches += zpl_str_skip(s, 'x') != e;
+                    mismatches += zpl_str_trim(s, false) != sp;
+                    mismatches += zpl_str_trim(s, true) != spn;
+                    mismatches += zpl_str_skip_any(s, ",;z") != any;
+
+                    char const *first = NULL, *last = NULL;
+                    for (zpl_isize i = 0; i < len; i++) {
+                        if (s[i] == 'a') { last = s + i; if (!first) first = s + i; }
+                    }
+                    mismatches += zpl_memchr(s, 'a', len) != first;
+                    mismatches += zpl_memrchr(s, 'a', len) != last;
+
+                    char const *any_of = NULL;
+                    for (zpl_isize i = 0; i < len && !any_of; i++) {
+                        if (s[i] == ',' || s[i] == ';' || s[i] == 'z') any_of = s + i;
+                    }
+                    mismatches += zpl_memchr_any(s, len, cast(zpl_u8 const *)",;z", 3) != any_of;
+                }
+            }
+        }
+
+        zpl_simd_level_set(prev);
+        EQUALS(mismatches, 0);
+        EQUALS(zpl_simd_level_get(), prev);
+    });
+
+    IT("validates and transcodes UTF-8", {
+        zpl_u8 const text[] = "z\xc5\xaf\xc5\x88 \xe2\x82\xac \xf0\x9f\x98\x80!";
+        zpl_isize n = zpl_size_of(text) - 1;
+        zpl_u16 u16[32];
+        zpl_rune u32[32];
+        zpl_u8 back[64];
+
+        EQUALS(zpl_utf8_validate(text, n), n);
+        EQUALS(zpl_utf8_utf16_length(text, n), 9);
+        EQUALS(zpl_utf8_utf32_length(text, n), 8);
+        EQUALS(zpl_utf8_to_utf16(u16, text, n), 9);
+        EQUALS(u16[6], 0xd83d);
+        EQUALS(u16[7], 0xde00);
+        EQUALS(zpl_utf16_utf8_length(u16, 9), n);
+        EQUALS(zpl_utf16_to_utf8(back, u16, 9), n);
+        EQUALS(zpl_memcompare(back, text, n), 0);
+        EQUALS(zpl_utf8_to_utf32(u32, text, n), 8);
+        EQUALS(u32[4], 0x20ac);
+        EQUALS(u32[6], 0x1f600);
+        EQUALS(zpl_utf32_utf8_length(u32, 8), n);
+        EQUALS(zpl_utf32_to_utf8(back, u32, 8), n);
+        EQUALS(zpl_memcompare(back, text, n), 0);
+
+        /* overlong, surrogate, above U+10FFFF, stray continuation, truncated */
+        EQUALS(zpl_utf8_validate((zpl_u8 const *)"ab\xc0\xaf", 4), 2);
+        EQUALS(zpl_utf8_validate((zpl_u8 const *)"\xe0\x80\xaf", 3), 0);
+        EQUALS(zpl_utf8_validate((zpl_u8 const *)"a\xed\xa0\x80", 4), 1);
+        EQUALS(zpl_utf8_validate((zpl_u8 const *)"\xf4\x90\x80\x80", 4), 0);
+        EQUALS(zpl_utf8_validate((zpl_u8 const *)"abc\x80", 4), 3);
+        EQUALS(zpl_utf8_validate((zpl_u8 const *)"abc\xe2\x82", 5), 3);
+        EQUALS(zpl_utf8_to_utf16(u16, (zpl_u8 const *)"a\xed\xa0\x80", 4), -1);
+        u16[0] = 'a', u16[1] = 0xdc00;
+        EQUALS(zpl_utf16_to_utf8(back, u16, 2), -1);
+        u32[0] = 0xd800;
+        EQUALS(zpl_utf32_to_utf8(back, u32, 1), -1);
+
+        /* the NUL-terminated wrappers are built on the bulk conversions */
+        NEQUALS(zpl_utf8_to_ucs2(u16, zpl_count_of(u16), text), NULL);
+        EQUALS(u16[9], 0);
+        EQUALS(zpl_utf8_to_ucs2(u16, 9, text), NULL);
+        STREQUALS((char const *)zpl_ucs2_to_utf8(back, zpl_count_of(back), u16), (char const *)text);
+    });
+
+    IT("validates UTF-8 the same way with every instruction set", {
+        zpl_simd_level levels[] = { ZPL_SIMD_SCALAR, ZPL_SIMD_SSE2, ZPL_SIMD_AVX2, ZPL_SIMD_NEON };
+        zpl_rune const samples[] = { 'a', ' ', 0x7f, 0x80, 0x7ff, 0x800, 0x20ac, 0xd7ff, 0xe000, 0xfffd, 0xffff, 0x10000, 0x1f600, 0x10ffff };
+        zpl_simd_level prev = zpl_simd_level_get();
+        zpl_local_persist zpl_u8 buf[600], back[600];
+        zpl_local_persist zpl_u16 u16[600];
+        zpl_isize mismatches = 0;
+        zpl_u32 seed = 11;
+
+        for (zpl_isize round = 0; round < 2000; round++) {
+            zpl_isize len = 0, target, expected, units;
+            zpl_simd_level_set(levels[round % zpl_count_of(levels)]);
+            seed = seed * 1103515245 + 12345;
+            target = (seed >> 16) % 300;
+            while (len < target) {
+                seed = seed * 1103515245 + 12345;
+                /* long ASCII runs so whole blocks take the fast path */
+                if ((seed >> 16) % 4 == 0) {
+                    for (zpl_isize k = (seed >> 20) % 40; k > 0; k--) buf[len++] = 'a' + cast(zpl_u8)(k % 26);
+                } else {
+                    len += zpl_utf8_encode_rune(buf + len, samples[(seed >> 16) % zpl_count_of(samples)]);
+                }
+            }
+            /* every other round gets a corrupted byte */
+            if (round % 2 && len > 0) {
+                seed = seed * 1103515245 + 12345;
+                buf[(seed >> 16) % len] = cast(zpl_u8)(seed >> 8);
+            }
+
+            for (expected = 0; expected < len;) {
+                zpl_rune c;
+                zpl_isize w = zpl_utf8_decode(buf + expected, len - expected, &c);
+                if (w == 1 && c == ZPL_RUNE_INVALID) break;
+                expected += w;
+            }
+            mismatches += zpl_utf8_validate(buf, len) != expected;
+            if (expected != len) continue;
+
+            units = zpl_utf8_utf16_length(buf, len);
+            mismatches += zpl_utf8_to_utf16(u16, buf, len) != units;
+            mismatches += zpl_utf16_utf8_length(u16, units) != len;
+            mismatches += zpl_utf16_to_utf8(back, u16, units) != len;
+            mismatches += zpl_memcompare(back, buf, len) != 0;
+        }
+
+        zpl_simd_level_set(prev);
+        EQUALS(mismatches, 0);
+    });
+
+    IT("keeps short strings inline and spills long ones to the heap", {
+        zpl_string_sso str = {0};
+        EQUALS(zpl_string_sso_length(&str), 0);
+        STREQUALS(zpl_string_sso_cstr(&str), "");
+
+        EQUALS(zpl_string_sso_set(&str, zpl_heap(), ZPL_STRVIEW_LIT("short key")), true);
+        EQUALS(zpl_string_sso_is_inline(&str), true);
+        EQUALS(zpl_string_sso_append(&str, zpl_heap(), ZPL_STRVIEW_LIT(" & value!!!!!")), true);
+        EQUALS(zpl_string_sso_length(&str), ZPL_STRING_SSO_CAPACITY);
+        EQUALS(zpl_string_sso_is_inline(&str), true);
+        STREQUALS(zpl_string_sso_cstr(&str), "short key & value!!!!!");
+
+        /* appending part of itself while spilling */
+        EQUALS(zpl_string_sso_append(&str, zpl_heap(), zpl_strview_make(zpl_string_sso_cstr(&str), 5)), true);
+        EQUALS(zpl_string_sso_is_inline(&str), false);
+        STREQUALS(zpl_string_sso_cstr(&str), "short key & value!!!!!short");
+        EQUALS(zpl_string_sso_append(&str, zpl_heap(), zpl_string_sso_view(&str)), true);
+        STREQUALS(zpl_string_sso_cstr(&str), "short key & value!!!!!shortshort key & value!!!!!short");
+
+        EQUALS(zpl_string_sso_set(&str, zpl_heap(), ZPL_STRVIEW_LIT("tiny")), true);
+        STREQUALS(zpl_string_sso_cstr(&str), "tiny");
+        EQUALS(zpl_string_sso_length(&str), 4);
+        zpl_string_sso_free(&str);
+        EQUALS(zpl_string_sso_is_inline(&str), true);
+
+        zpl_string s = zpl_string_make_view(zpl_heap(), ZPL_STRVIEW_LIT("key=value"));
+        EQUALS(zpl_strview_equals_cstr(zpl_strview_make(s, 3), "key"), true);
+        EQUALS(zpl_strview_equals_cstr(zpl_strview_make(s, 3), "ke"), false);
+        EQUALS(zpl_strview_are_equal(zpl_string_view(s), ZPL_STRVIEW_LIT("key=value")), true);
+        s = zpl_string_append_view(s, zpl_strview_make("!?", 1));
+        STREQUALS(s, "key=value!");
+        zpl_string_free(s);
+    });
+
+    IT("builds large strings in chunks", {
+        zpl_string_builder b;
+        zpl_string_builder_init(&b, zpl_heap(), 16);
+        zpl_string expected = zpl_string_make(zpl_heap(), "");
+        zpl_i32 i;
+
+        for (i = 0; i < 200; i++) {
+            EQUALS(zpl_string_builder_append_fmt(&b, "row %d: %s;", i, (i % 7) ? "ok" : "a value that spans more than one chunk"), true);
+            expected = zpl_string_append_fmt(expected, "row %d: %s;", i, (i % 7) ? "ok" : "a value that spans more than one chunk");
+            EQUALS(zpl_string_builder_appendc(&b, "|"), true);
+            expected = zpl_string_appendc(expected, "|");
+        }
+        EQUALS(zpl_string_builder_append_rune(&b, 0x20AC), true);
+        expected = zpl_string_append_rune(expected, 0x20AC);
+        EQUALS(zpl_string_builder_append_view(&b, ZPL_STRVIEW_LIT("0123456789abcdefghijklmnopqrstuvwxyz")), true);
+        expected = zpl_string_appendc(expected, "0123456789abcdefghijklmnopqrstuvwxyz");
+
+        EQUALS(zpl_string_builder_length(&b), zpl_string_length(expected));
+        zpl_string out = zpl_string_builder_to_string(&b, zpl_heap());
+        EQUALS(zpl_string_length(out), zpl_string_length(expected));
+        EQUALS(zpl_string_capacity(out), zpl_string_length(expected));
+        STREQUALS(out, expected);
+
+        zpl_file f;
+        zpl_file_stream_new(&f, zpl_heap());
+        EQUALS(zpl_string_builder_write_to(&b, &f), true);
+        EQUALS(zpl_file_size(&f), zpl_string_length(expected));
+        EQUALS(zpl_memcompare(zpl_file_stream_buf(&f, 0), expected, zpl_string_length(expected)), 0);
+        zpl_file_close(&f);
+
+        zpl_string_builder_clear(&b);
+        EQUALS(zpl_string_builder_length(&b), 0);
+        zpl_string_builder_appendc(&b, "again");
+        zpl_string_free(out);
+        out = zpl_string_builder_to_string(&b, zpl_heap());
+        STREQUALS(out, "again");
+
+        const char *parts[] = { "a", "bc", "", "def" };
+        zpl_string joined = zpl_string_join(zpl_heap(), parts, zpl_count_of(parts), ", ");
+        STREQUALS(joined, "a, bc, , def");
+        EQUALS(zpl_string_capacity(joined), zpl_string_length(joined));
+
+        zpl_string_free(joined);
+        zpl_string_free(out);
+        zpl_string_free(expected);
+        zpl_string_builder_free(&b);
+    });
+
+    IT("matches many literals at once, across buffer boundaries", {
+        zpl_strmatch m;
+        static strmatch_hits all, split;
+        zpl_strview words[] = { ZPL_STRVIEW_LIT("he"), ZPL_STRVIEW_LIT("she"), ZPL_STRVIEW_LIT("his"), ZPL_STRVIEW_LIT("hers") };
+        char const text[] = "ushers say his shell";
+
+        EQUALS(zpl_strmatch_compile(&m, zpl_heap(), words, zpl_count_of(words), 0), true);
+        EQUALS(zpl_strmatch_feed(&m, text, zpl_size_of(text) - 1, strmatch_collect, &all), true);
+        EQUALS(all.count, 6);
+        EQUALS(all.hits[0].pattern, 1); EQUALS(all.hits[0].offset, 1);
+        EQUALS(all.hits[1].pattern, 0); EQUALS(all.hits[1].offset, 2);
+        EQUALS(all.hits[2].pattern, 3); EQUALS(all.hits[2].offset, 2); EQUALS(all.hits[2].len, 4);
+        EQUALS(all.hits[3].pattern, 2); EQUALS(all.hits[3].offset, 11);
+        EQUALS(all.hits[4].pattern, 1); EQUALS(all.hits[4].offset, 15);
+        EQUALS(all.hits[5].pattern, 0); EQUALS(all.hits[5].offset, 16);
+
+        zpl_strmatch_reset(&m);
+        for (zpl_isize i = 0; i < zpl_size_of(text) - 1; i++) zpl_strmatch_feed(&m, text + i, 1, strmatch_collect, &split);
+        EQUALS(split.count, all.count);
+        EQUALS(zpl_memcompare(split.hits, all.hits, all.count * zpl_size_of(zpl_strmatch_hit)), 0);
+
+        zpl_strmatch_hit hit;
+        EQUALS(zpl_strmatch_find(&m, text, zpl_size_of(text) - 1, &hit), true);
+        EQUALS(hit.pattern, 1);
+        EQUALS(zpl_strmatch_find(&m, "nothing", 7, &hit), false);
+        zpl_strmatch_destroy(&m);
+
+        zpl_strview levels[] = { ZPL_STRVIEW_LIT("error"), ZPL_STRVIEW_LIT("WARN") };
+        EQUALS(zpl_strmatch_compile(&m, zpl_heap(), levels, zpl_count_of(levels), ZPL_STRMATCH_IGNORE_CASE), true);
+        EQUALS(zpl_strmatch_find(&m, "[12:00] Error: disk full", 24, &hit), true);
+        EQUALS(hit.pattern, 0); EQUALS(hit.offset, 8);
+        EQUALS(zpl_strmatch_find(&m, "warning", 7, &hit), true);
+        EQUALS(hit.pattern, 1);
+        zpl_strmatch_destroy(&m);
+
+        zpl_strview empty[] = { ZPL_STRVIEW_LIT("a"), zpl_strview_make("", 0) };
+        EQUALS(zpl_strmatch_compile(&m, zpl_heap(), empty, 2, 0), false);
+    });
+
+    IT("reports the same matches as a naive search", {
+        zpl_u32 seed = 11;
+        zpl_isize mismatches = 0;
+        char pool[64 * 6], text[400];
+        zpl_strview pats[64];
+
+        zpl_simd_level levels[] = { ZPL_SIMD_SCALAR, ZPL_SIMD_SSE2, ZPL_SIMD_AVX2, ZPL_SIMD_NEON };
+        zpl_simd_level prev = zpl_simd_level_get();
+
+        /* few patterns exercise the prefilter, many disable it */
+        for (zpl_isize round = 0; round < 32; round++) {
+            zpl_isize count = (round & 1) ? 64 : 1 + (round / 8) % 4, cases = 0;
+            zpl_strmatch m;
+            static strmatch_hits got;
+            zpl_zero_item(&got);
+            for (zpl_isize i = 0; i < count; i++) {
+                seed = seed * 1103515245 + 12345;
+                zpl_isize len = 1 + (seed >> 16) % 5;
+                for (zpl_isize j = 0; j < len; j++) {
+                    seed = seed * 1103515245 + 12345;
+                    pool[i * 6 + j] = "abcdefg"[(seed >> 16) % ((round & 2) ? 7 : 3)];
+                }
+                pats[i] = zpl_strview_make(pool + i * 6, len);
+            }
+            for (zpl_isize i = 0; i < zpl_size_of(text); i++) {
+                seed = seed * 1103515245 + 12345;
+                text[i] = "abcdefgxyz"[(seed >> 16) % 10];
+            }
+
+            zpl_simd_level_set(levels[(round / 2) % zpl_count_of(levels)]);
+            EQUALS(zpl_strmatch_compile(&m, zpl_heap(), pats, count, 0), true);
+            for (zpl_isize off = 0; off < zpl_size_of(text); off += 37) {
+                zpl_strmatch_feed(&m, text + off, zpl_min(37, zpl_size_of(text) - off), strmatch_collect, &got);
+            }
+
+            /* ordered by end position, then longest first, then by index */
+            for (zpl_isize end = 1; end <= zpl_size_of(text); end++) {
+                for (zpl_isize len = 5; len >= 1; len--) {
+                    if (len > end) continue;
+                    for (zpl_isize i = 0; i < count; i++) {
+                        if (pats[i].len != len || zpl_memcompare(text + end - len, pats[i].ptr, len)) continue;
+                        if (cases >= zpl_min(got.count, zpl_count_of(got.hits)) || got.hits[cases].pattern != i || got.hits[cases].offset != end - len) mismatches++;
+                        cases++;
+                    }
+                }
+            }
+            mismatches += (cases != got.count) + (got.count > zpl_count_of(got.hits));
+            zpl_strmatch_destroy(&m);
+        }
+        zpl_simd_level_set(prev);
+        EQUALS(mismatches, 0);
+    });
+});
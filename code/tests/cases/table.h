@@ -47,4 +47,22 @@ MODULE(table, {
 
         unit_table_destroy(&t1);
     });
+
+    IT("should find entries keyed by strings", {
+        static char const *const names[] = { "alpha", "beta", "gamma", "a somewhat longer key that spans several blocks of the hash" };
+        unit_table t1 = {0};
+        unit_table_init(&t1, zpl_heap());
+
+        for (int i = 0; i < 4; ++i) {
+            unit_table_set(&t1, ZPL_TABLE_HASH(names[i], zpl_strlen(names[i])), i);
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            EQUALS(i, *unit_table_get(&t1, ZPL_TABLE_HASH(names[i], zpl_strlen(names[i]))));
+        }
+        EQUALS((unit_table_get(&t1, ZPL_TABLE_HASH("delta", 5)) == NULL), true);
+        EQUALS((ZPL_TABLE_HASH("abc", 3) == zpl_hash64("abc", 3)), true);
+
+        unit_table_destroy(&t1);
+    });
 });
@@ -11,11 +11,15 @@
 #include "cases/alloc_pool.h"
 #include "cases/hashing.h"
 #include "cases/memory.h"
+#include "cases/string.h"
 #include "cases/table.h"
 #include "cases/time.h"
 #include "cases/stream.h"
+#include "cases/file.h"
 #include "cases/print.h"
 #include "cases/adt.h"
+#include "cases/log.h"
+#include "cases/opts.h"
 
 int main() {
     zpl_heap_stats_init();
@@ -25,12 +29,16 @@ int main() {
     UNIT_MODULE(hashing);
     UNIT_MODULE(time);
     UNIT_MODULE(stream);
+    UNIT_MODULE(file);
     UNIT_MODULE(memory);
+    UNIT_MODULE(string);
     UNIT_MODULE(table);
     UNIT_MODULE(print);
     UNIT_MODULE(json5_parser);
     UNIT_MODULE(csv_parser);
     UNIT_MODULE(adt);
+    UNIT_MODULE(log);
+    UNIT_MODULE(opts);
 
     int32_t ret_code = UNIT_RUN();
     zpl_heap_stats_check();
@@ -44,8 +44,8 @@ License:
 #define ZPL_H
 
 #define ZPL_VERSION_MAJOR 19
-#define ZPL_VERSION_MINOR 0
-#define ZPL_VERSION_PATCH 4
+#define ZPL_VERSION_MINOR 25
+#define ZPL_VERSION_PATCH 0
 #define ZPL_VERSION_PRE ""
 
 #include "zpl_hedley.h"
@@ -252,6 +252,7 @@ License:
 #        include "header/core/stringlib.h"
 #        include "header/core/file.h"
 #        include "header/core/file_stream.h"
+#        include "header/core/file_buffered.h"
 #        include "header/core/file_misc.h"
 #        include "header/core/file_tar.h"
 #        include "header/core/print.h"
@@ -321,6 +322,11 @@ License:
 
 #    if defined(ZPL_MODULE_JOBS)
 #        include "header/jobs.h"
+#        include "header/file_async.h"
+#    endif
+
+#    if defined(ZPL_MODULE_CORE)
+#        include "header/log.h" /* formats and writes through core */
 #    endif
 #else
 #    if !defined(zpl_thread_local)
@@ -414,6 +420,7 @@ License:
 #        include "source/core/stringlib.c"
 #        include "source/core/file.c"
 #        include "source/core/file_stream.c"
+#        include "source/core/file_buffered.c"
 #        include "source/core/file_misc.c"
 #        include "source/core/file_tar.c"
 #        include "source/core/print.c"
@@ -459,6 +466,11 @@ License:
 
 #    if defined(ZPL_MODULE_JOBS)
 #        include "source/jobs.c"
+#        include "source/file_async.c"
+#    endif
+
+#    if defined(ZPL_MODULE_CORE)
+#        include "source/log.c"
 #    endif
 #endif
 
@@ -533,6 +545,7 @@ License:
 // header/threading/sem.h
 // header/math.h
 // header/jobs.h
+// header/file_async.h
 // header/parsers/json.h
 // header/parsers/csv.h
 // header/dll.h
@@ -541,6 +554,7 @@ License:
 // header/core/memory_virtual.h
 // header/core/random.h
 // header/core/file_stream.h
+// header/core/file_buffered.h
 // header/core/string.h
 // header/core/misc.h
 // header/core/file.h
@@ -570,7 +584,9 @@ License:
 // source/parsers/csv.c
 // source/parsers/json.c
 // source/jobs.c
+// source/file_async.c
 // source/core/file_stream.c
+// source/core/file_buffered.c
 // source/core/stringlib.c
 // source/core/misc.c
 // source/core/file_misc.c